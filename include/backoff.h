@@ -0,0 +1,48 @@
+// Copyright (c) 2023 @dheijl (danny.heijl@telenet.be)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include <Arduino.h>
+
+typedef enum {
+    NetworkOk,
+    NetworkNoWifi,
+    NetworkNoPlayer,
+} NetworkResult;
+
+///
+/// consecutive network failures, kept across deep sleep and power off
+///
+typedef struct backoff_state {
+    uint32_t magic;
+    uint16_t wifi_failures;
+    uint16_t player_failures;
+    uint32_t offline_since; // get_rtc_seconds() of the first failure
+    uint32_t next_attempt; // no network before this time
+} BACKOFF_STATE;
+
+// true if this wake should not touch the network
+bool network_backoff();
+uint16_t network_failures();
+void record_network_result(NetworkResult result);
+// sleep at least until the next network attempt
+int backoff_sleep_time(int sleep_time);
+// "Offline since hh:mm", empty if online
+String offline_since();
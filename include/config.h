@@ -32,6 +32,8 @@ using std::vector;
 #undef DEBUG
 //#define DEBUG
 #undef DEBUGMPDMESSAGES
+// record all MPD traffic to /mpd.rec on the SD card, for replay_status_sessions()
+#undef DEBUGMPDRECORD
 
 #ifdef DEBUG
 #define DPRINT(x) Serial.println(x);
@@ -39,9 +41,19 @@ using std::vector;
 #define DPRINT(x)
 #endif
 
-typedef struct network_cfg {
+typedef struct wifi_network {
     const char* ssid;
     const char* psw;
+} WIFI_NETWORK;
+
+typedef vector<WIFI_NETWORK> WIFI_NETWORKS;
+
+static const size_t MAX_NETWORKS = 8;
+
+typedef struct network_cfg {
+    const char* ssid; // first of networks
+    const char* psw;
+    WIFI_NETWORKS networks;
     const char* ntp_server;
     const char* tz;
 } NETWORK_CFG;
@@ -63,6 +75,8 @@ typedef struct favourite {
 typedef vector<MPD_PLAYER*> PLAYERS;
 typedef vector<FAVOURITE*> FAVOURITES;
 
+static const size_t MAX_PLAYERS = 10;
+
 class Configuration {
 private:
     uint16_t player_index;
@@ -72,6 +86,8 @@ private:
     bool load_SD_config();
     bool load_FLASH_config();
     bool save_FLASH_config();
+    bool has_player(const char* hostname, uint16_t port);
+    void merge_discovered_players();
 
 public:
     const NETWORK_CFG& getNW_CFG();
@@ -79,7 +95,13 @@ public:
     const FAVOURITES& getFavourites();
     bool load_config();
     void set_player_index(uint16_t new_pl);
+    uint16_t get_player_index();
     const MPD_PLAYER& get_active_mpd();
+    const MPD_PLAYER& resolve_player(uint16_t index);
+    const MPD_PLAYER* revalidate_player(const char* hostname);
+    // bound each mDNS query, 0 restores the default
+    void set_resolve_timeout(uint32_t timeout_ms);
+    int discover_players();
 };
 
 extern Configuration& Config;
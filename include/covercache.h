@@ -0,0 +1,58 @@
+// Copyright (c) 2023 @dheijl (danny.heijl@telenet.be)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include <Arduino.h>
+
+// dithered covers on the SD card, evicted least recently used first
+static const int COVER_CACHE_ENTRIES = 64;
+static const uint32_t COVER_CACHE_MAX_BYTES = 4 * 1024 * 1024;
+// songs without a cover are asked again after a day
+static const uint32_t COVER_NONE_TTL = 24 * 3600;
+
+typedef enum {
+    CoverMiss,
+    CoverHit,
+    CoverNone, // known to have no (usable) cover
+} CoverLookup;
+
+typedef struct cover_cache_entry {
+    uint32_t key; // MpdConnection::GetCoverKey()
+    uint32_t size; // 0: no cover
+    uint32_t used; // value of the use counter at the last hit
+    uint32_t stored_at; // get_rtc_seconds()
+} COVER_CACHE_ENTRY;
+
+typedef struct cover_cache_index {
+    uint32_t magic;
+    uint32_t uses;
+    COVER_CACHE_ENTRY entries[COVER_CACHE_ENTRIES];
+} COVER_CACHE_INDEX;
+
+///
+/// covers as they are shown (the packed 4 bit canvas), so that a wake only has to copy
+/// a blob from SD instead of fetching and decoding the picture again
+///
+class CoverCache {
+public:
+    static CoverLookup load(uint32_t key, uint8_t* buf, size_t size);
+    // size 0 records that there is no cover for key
+    static bool store(uint32_t key, const uint8_t* buf, size_t size);
+};
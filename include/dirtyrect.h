@@ -0,0 +1,87 @@
+// Copyright (c) 2023 @dheijl (danny.heijl@telenet.be)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// the status canvas is compared in bands of this many rows
+static const int DIRTY_BAND_ROWS = 16;
+// more separate regions than this are pushed as one
+static const int MAX_DIRTY_REGIONS = 6;
+
+typedef struct dirty_region {
+    uint16_t y;
+    uint16_t h;
+} DIRTY_REGION;
+
+///
+/// finds the row bands of a packed 4 bit frame that differ from the previous frame.
+/// Only a hash per band of the previous frame is kept, small enough for RTC memory,
+/// so the comparison also works after a deep sleep without the old pixels.
+///
+class DirtyBands {
+private:
+    static uint32_t hash_band(const uint8_t* p, size_t len)
+    {
+        uint32_t hash = 2166136261u;
+        for (size_t i = 0; i < len; ++i) {
+            hash = (hash ^ p[i]) * 16777619u;
+        }
+        return hash;
+    }
+
+public:
+    static int band_count(int height)
+    {
+        return (height + DIRTY_BAND_ROWS - 1) / DIRTY_BAND_ROWS;
+    }
+    ///
+    /// update hashes (band_count(height) entries) to frame and return the changed regions.
+    /// With valid false the previous hashes are unknown and the whole frame is one region.
+    ///
+    static int diff(const uint8_t* frame, int width, int height, uint32_t* hashes, bool valid, DIRTY_REGION* regions)
+    {
+        size_t stride = width / 2;
+        int count = 0;
+        int bands = band_count(height);
+        for (int b = 0; b < bands; ++b) {
+            int y = b * DIRTY_BAND_ROWS;
+            int h = (y + DIRTY_BAND_ROWS) <= height ? DIRTY_BAND_ROWS : height - y;
+            uint32_t hash = hash_band(frame + (y * stride), h * stride);
+            if (valid && (hash == hashes[b])) {
+                continue;
+            }
+            hashes[b] = hash;
+            if ((count > 0) && (regions[count - 1].y + regions[count - 1].h == y)) {
+                // adjacent to the previous region
+                regions[count - 1].h += h;
+            } else if (count < MAX_DIRTY_REGIONS) {
+                regions[count].y = y;
+                regions[count].h = h;
+                ++count;
+            } else {
+                // too many updates: extend the last one
+                regions[count - 1].h = (y + h) - regions[count - 1].y;
+            }
+        }
+        return count;
+    }
+};
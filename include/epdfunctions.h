@@ -22,6 +22,7 @@
 #include <Arduino.h>
 #include <vector>
 
+#include "menubitmap.h"
 #include "menuline.h"
 
 typedef vector<String> StatusLines;
@@ -29,9 +30,23 @@ typedef vector<String> StatusLines;
 const uint16_t TOPLINE_Y = 0;
 const uint16_t CANVAS_Y = 40;
 const uint16_t BOTTOMLINE_Y = 920;
+// cover art, in the lower part of the status canvas
+const uint16_t COVER_SIZE = 300;
+const uint16_t COVER_X = 120;
+const uint16_t COVER_Y = 600;
+// band of a menu line around its text (menu lines are 40 pixels apart)
+const uint16_t MENU_LINE_MARGIN = 6;
+const uint16_t MENU_LINE_HEIGHT = 36;
 
-void epd_init();
+void epd_init(bool clear);
 void epd_print_topline(const String& s);
 void epd_print_canvas(const StatusLines& sl);
-void epd_draw_menu(const MenuLines& lines, const int selected);
+bool epd_draw_cover(const uint8_t* data, size_t len, uint32_t key);
+uint8_t* epd_cover_buffer(size_t& size);
+void epd_push_cover(uint32_t key);
+bool epd_cover_shown(uint32_t key);
+void epd_hide_cover();
+void epd_save_state();
+void epd_draw_menu(const MenuLines& lines, const int selected, MenuBitmap& bitmap);
+void epd_draw_menu_selection(const MenuLines& lines, const int previous, const int selected, MenuBitmap& bitmap);
 void epd_print_bottomline(const String& s);
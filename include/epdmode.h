@@ -0,0 +1,63 @@
+// Copyright (c) 2023 @dheijl (danny.heijl@telenet.be)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include <Arduino.h>
+#include <M5EPD.h>
+
+typedef enum {
+    RegionTopline,
+    RegionCanvas,
+    RegionBottomline,
+    RegionCover,
+    EPD_REGION_COUNT,
+} EpdRegion;
+
+// the daily full cleanup is done on the first update in this hour
+static const uint8_t EPD_QUIET_HOUR = 3;
+// fast updates after which the counts are written even if the frame state is not
+static const uint16_t EPD_MODE_SAVE_EVERY = 8;
+
+///
+/// fast updates per region since its last GC16, kept across deep sleep and power off
+///
+typedef struct epd_mode_state {
+    uint32_t magic;
+    uint16_t fast_updates[EPD_REGION_COUNT];
+    uint16_t cleanup_day; // get_rtc_seconds() / 86400 of the last quiet hour cleanup
+} EPD_MODE_STATE;
+
+///
+/// picks the cheapest waveform for an update: A2 or DU for black and white text,
+/// GL16 for grays, and a flashing GC16 that clears the ghosting once a region has
+/// had enough fast updates or in the quiet hour
+///
+class WaveformScheduler {
+public:
+    // true if the next update of the region will be a GC16 of the whole region
+    static bool cleanup_due(EpdRegion region);
+    // call only for an update that is pushed, it is counted
+    // cleanup is set if the whole region must be pushed, not just what changed
+    static m5epd_update_mode_t next_mode(EpdRegion region, bool grayscale, bool& cleanup);
+    // after a full clear of the panel
+    static void reset();
+    // frame_written: the frame state is written in this pass anyway
+    static void save(bool frame_written);
+};
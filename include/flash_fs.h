@@ -33,4 +33,8 @@ public:
     static bool read_wifi(NETWORK_CFG& ap);
     static bool read_players(PLAYERS& players);
     static bool read_favourites(FAVOURITES& favourites);
+
+    // players found by browsing _mpd._tcp, kept apart from the configured ones
+    static bool write_discovered_players(const PLAYERS& players);
+    static bool read_discovered_players(PLAYERS& players);
 };
@@ -0,0 +1,370 @@
+// Copyright (c) 2023 @dheijl (danny.heijl@telenet.be)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <JPEGDEC.h>
+#include <PNGdec.h>
+
+///
+/// receives the dithered image row by row, as ink levels: 0 = white ... 15 = black,
+/// the colors of an M5EPD_Canvas
+///
+class Gray4Sink {
+public:
+    virtual ~Gray4Sink() { }
+    // size of the image that follows, before the first row
+    virtual void begin(int, int) { }
+    virtual void put_row(int y, const uint8_t* levels, int width) = 0;
+};
+
+///
+/// 4 bits per pixel framebuffer with the M5EPD_Canvas layout (even x in the high nibble),
+/// to run the pipeline natively
+///
+class Gray4Framebuffer : public Gray4Sink {
+private:
+    uint8_t* fb;
+    int width;
+    int height;
+
+public:
+    Gray4Framebuffer(int width, int height)
+        : width(width)
+        , height(height)
+    {
+        this->fb = (uint8_t*)calloc((width * height + 1) / 2, 1);
+    }
+    ~Gray4Framebuffer()
+    {
+        free(this->fb);
+    }
+    Gray4Framebuffer(const Gray4Framebuffer&) = delete;
+    Gray4Framebuffer& operator=(const Gray4Framebuffer&) = delete;
+
+    void put_row(int y, const uint8_t* levels, int w) override
+    {
+        if ((this->fb == NULL) || (y < 0) || (y >= this->height)) {
+            return;
+        }
+        for (int x = 0; (x < w) && (x < this->width); ++x) {
+            int index = (y * this->width + x) >> 1;
+            if (x & 1) {
+                this->fb[index] = (this->fb[index] & 0xf0) | levels[x];
+            } else {
+                this->fb[index] = (this->fb[index] & 0x0f) | (levels[x] << 4);
+            }
+        }
+    }
+    uint8_t get(int x, int y) const
+    {
+        uint8_t b = this->fb[(y * this->width + x) >> 1];
+        return (x & 1) ? (b & 0x0f) : (b >> 4);
+    }
+    const uint8_t* data() const
+    {
+        return this->fb;
+    }
+};
+
+typedef struct image_stats {
+    int src_width;
+    int src_height;
+    int scale; // 1, 2, 4 or 8: reduction done by the JPEG decoder itself
+    int width; // of the result
+    int height;
+    size_t peak_bytes; // working memory of the pipeline, without the decoder object
+} IMAGE_STATS;
+
+///
+/// decode a JPEG or PNG from memory, downscale it to fit a box and dither it to 16 gray
+/// levels (Floyd-Steinberg). Decoded rows are consumed as they arrive: the working
+/// set is one decoder strip plus a few rows at the output width.
+///
+class ImageDither {
+private:
+    static const int MAX_STRIP_ROWS = 16; // JPEG MCU height
+    Gray4Sink* sink;
+    // geometry
+    int sw; // source width and height, after the decoder's own scaling
+    int sh;
+    int dw; // output
+    int dh;
+    // decoder strip: JPEG delivers MCU blocks, possibly only part of a strip at a time
+    uint8_t* strip;
+    int strip_y;
+    int strip_rows;
+    int strip_filled; // columns of the current strip received so far
+    // box filter
+    uint32_t* acc;
+    uint16_t* acc_cols; // source columns per output column
+    int acc_rows;
+    int out_y;
+    // dither
+    int16_t* err_cur;
+    int16_t* err_next;
+    uint8_t* levels;
+    size_t mem;
+    // PNG rows as RGB565
+    uint16_t* png_line;
+    PNG* png;
+
+    void* alloc(size_t size)
+    {
+        this->mem += size;
+        return calloc(size, 1);
+    }
+    void release()
+    {
+        free(this->strip);
+        free(this->acc);
+        free(this->acc_cols);
+        free(this->err_cur);
+        free(this->err_next);
+        free(this->levels);
+        free(this->png_line);
+        this->strip = NULL;
+        this->acc = NULL;
+        this->acc_cols = NULL;
+        this->err_cur = NULL;
+        this->err_next = NULL;
+        this->levels = NULL;
+        this->png_line = NULL;
+    }
+    // fit w x h in the box without upscaling, keeping the aspect ratio
+    static void fit(int& w, int& h, int box_w, int box_h)
+    {
+        if ((w > box_w) || (h > box_h)) {
+            if ((long)w * box_h > (long)h * box_w) {
+                h = (int)(((long)h * box_w) / w);
+                w = box_w;
+            } else {
+                w = (int)(((long)w * box_h) / h);
+                h = box_h;
+            }
+        }
+    }
+    bool setup(int src_w, int src_h, int box_w, int box_h, int strip_rows)
+    {
+        this->sw = src_w;
+        this->sh = src_h;
+        this->dw = src_w;
+        this->dh = src_h;
+        fit(this->dw, this->dh, box_w, box_h);
+        if ((this->dw <= 0) || (this->dh <= 0)) {
+            return false;
+        }
+        this->mem = 0;
+        this->strip_rows = strip_rows;
+        this->strip = (uint8_t*)this->alloc((size_t)src_w * strip_rows);
+        this->acc = (uint32_t*)this->alloc(this->dw * sizeof(uint32_t));
+        this->acc_cols = (uint16_t*)this->alloc(this->dw * sizeof(uint16_t));
+        this->err_cur = (int16_t*)this->alloc((this->dw + 2) * sizeof(int16_t));
+        this->err_next = (int16_t*)this->alloc((this->dw + 2) * sizeof(int16_t));
+        this->levels = (uint8_t*)this->alloc(this->dw);
+        if ((this->strip == NULL) || (this->acc == NULL) || (this->acc_cols == NULL) || (this->err_cur == NULL)
+            || (this->err_next == NULL) || (this->levels == NULL)) {
+            return false;
+        }
+        for (int x = 0; x < src_w; ++x) {
+            ++this->acc_cols[(long)x * this->dw / src_w];
+        }
+        this->sink->begin(this->dw, this->dh);
+        this->strip_y = 0;
+        this->strip_filled = 0;
+        this->acc_rows = 0;
+        this->out_y = 0;
+        return true;
+    }
+    // quantize one output row to 16 levels, diffusing the error to the right and down
+    void emit_row()
+    {
+        for (int x = 0; x < this->dw; ++x) {
+            int v = (int)(this->acc[x] / ((uint32_t)this->acc_cols[x] * this->acc_rows)) + this->err_cur[x + 1];
+            v = v < 0 ? 0 : (v > 255 ? 255 : v);
+            int q = (v * 15 + 127) / 255;
+            int e = v - (q * 17);
+            this->err_cur[x + 2] += (e * 7) / 16;
+            this->err_next[x] += (e * 3) / 16;
+            this->err_next[x + 1] += (e * 5) / 16;
+            this->err_next[x + 2] += e / 16;
+            // gray 15 is white, ink 15 is black
+            this->levels[x] = 15 - q;
+            this->acc[x] = 0;
+        }
+        this->sink->put_row(this->out_y, this->levels, this->dw);
+        int16_t* t = this->err_cur;
+        this->err_cur = this->err_next;
+        this->err_next = t;
+        memset(this->err_next, 0, (this->dw + 2) * sizeof(int16_t));
+        this->acc_rows = 0;
+        ++this->out_y;
+    }
+    // one full-width source row of 8 bit gray
+    void add_row(int sy, const uint8_t* row)
+    {
+        if ((sy >= this->sh) || (this->out_y >= this->dh)) {
+            return;
+        }
+        int dy = (int)((long)sy * this->dh / this->sh);
+        if ((dy != this->out_y) && (this->acc_rows > 0)) {
+            this->emit_row();
+        }
+        for (int x = 0; x < this->sw; ++x) {
+            this->acc[(long)x * this->dw / this->sw] += row[x];
+        }
+        ++this->acc_rows;
+        if (sy == this->sh - 1) {
+            this->emit_row();
+        }
+    }
+    void add_block(int x, int y, int w, int h, const uint8_t* pixels, int pitch)
+    {
+        if (y != this->strip_y) {
+            this->strip_y = y;
+            this->strip_filled = 0;
+        }
+        h = h < this->strip_rows ? h : this->strip_rows;
+        w = (x + w) <= this->sw ? w : this->sw - x;
+        if (w <= 0) {
+            return;
+        }
+        for (int r = 0; r < h; ++r) {
+            memcpy(this->strip + (r * this->sw) + x, pixels + (r * pitch), w);
+        }
+        this->strip_filled += w;
+        if (this->strip_filled >= this->sw) {
+            for (int r = 0; r < h; ++r) {
+                this->add_row(y + r, this->strip + (r * this->sw));
+            }
+        }
+    }
+
+    static int jpeg_draw(JPEGDRAW* draw)
+    {
+        auto self = (ImageDither*)draw->pUser;
+        self->add_block(draw->x, draw->y, draw->iWidth, draw->iHeight, (const uint8_t*)draw->pPixels, draw->iWidth);
+        return 1;
+    }
+    static void png_draw(PNGDRAW* draw)
+    {
+        auto self = (ImageDither*)draw->pUser;
+        // transparent parts on white
+        self->png->getLineAsRGB565(draw, self->png_line, PNG_RGB565_LITTLE_ENDIAN, 0xffffffff);
+        uint8_t* gray = self->strip;
+        for (int x = 0; x < self->sw; ++x) {
+            uint16_t c = self->png_line[x];
+            int r = (c >> 8) & 0xf8;
+            int g = (c >> 3) & 0xfc;
+            int b = (c << 3) & 0xf8;
+            gray[x] = (uint8_t)((r * 77 + g * 150 + b * 29) >> 8);
+        }
+        self->add_row(draw->y, gray);
+    }
+
+public:
+    ImageDither(Gray4Sink* sink)
+        : sink(sink)
+        , strip(NULL)
+        , acc(NULL)
+        , acc_cols(NULL)
+        , err_cur(NULL)
+        , err_next(NULL)
+        , levels(NULL)
+        , mem(0)
+        , png_line(NULL)
+        , png(NULL)
+    {
+    }
+    ~ImageDither()
+    {
+        this->release();
+    }
+    ImageDither(const ImageDither&) = delete;
+    ImageDither& operator=(const ImageDither&) = delete;
+
+    static bool is_jpeg(const uint8_t* data, size_t len)
+    {
+        return (len > 3) && (data[0] == 0xff) && (data[1] == 0xd8) && (data[2] == 0xff);
+    }
+    static bool is_png(const uint8_t* data, size_t len)
+    {
+        return (len > 8) && (memcmp(data, "\x89PNG", 4) == 0);
+    }
+
+    ///
+    /// decode data and write at most box_w x box_h dithered pixels to the sink
+    ///
+    bool draw(const uint8_t* data, size_t len, int box_w, int box_h, IMAGE_STATS& stats)
+    {
+        memset(&stats, 0, sizeof(stats));
+        bool ok = false;
+        if (is_jpeg(data, len)) {
+            // the decoder object is large: not on the stack
+            JPEGDEC* jpeg = new JPEGDEC();
+            if (jpeg->openRAM((uint8_t*)data, (int)len, jpeg_draw)) {
+                stats.src_width = jpeg->getWidth();
+                stats.src_height = jpeg->getHeight();
+                // let the IDCT do the coarse reduction, as long as the result still covers the output
+                int fit_w = stats.src_width;
+                int fit_h = stats.src_height;
+                fit(fit_w, fit_h, box_w, box_h);
+                int scale = 1;
+                while ((scale < 8) && (stats.src_width / (scale * 2) >= fit_w) && (stats.src_height / (scale * 2) >= fit_h)) {
+                    scale *= 2;
+                }
+                static const int options[] = { 0, 0, JPEG_SCALE_HALF, 0, JPEG_SCALE_QUARTER, 0, 0, 0, JPEG_SCALE_EIGHTH };
+                stats.scale = scale;
+                int w = (stats.src_width + scale - 1) / scale;
+                int h = (stats.src_height + scale - 1) / scale;
+                if (this->setup(w, h, box_w, box_h, MAX_STRIP_ROWS)) {
+                    jpeg->setPixelType(EIGHT_BIT_GRAYSCALE);
+                    jpeg->setUserPointer(this);
+                    ok = jpeg->decode(0, 0, options[scale]) == 1;
+                }
+                jpeg->close();
+            }
+            delete jpeg;
+        } else if (is_png(data, len)) {
+            this->png = new PNG();
+            if (this->png->openRAM((uint8_t*)data, (int)len, png_draw) == PNG_SUCCESS) {
+                stats.src_width = this->png->getWidth();
+                stats.src_height = this->png->getHeight();
+                stats.scale = 1;
+                if (this->setup(stats.src_width, stats.src_height, box_w, box_h, 1)) {
+                    this->png_line = (uint16_t*)this->alloc(stats.src_width * sizeof(uint16_t));
+                    ok = (this->png_line != NULL) && (this->png->decode(this, 0) == PNG_SUCCESS);
+                }
+                this->png->close();
+            }
+            delete this->png;
+            this->png = NULL;
+        }
+        stats.width = this->dw;
+        stats.height = this->out_y;
+        stats.peak_bytes = this->mem;
+        ok = ok && (this->out_y == this->dh);
+        this->release();
+        return ok;
+    }
+};
@@ -0,0 +1,44 @@
+// Copyright (c) 2023 @dheijl (danny.heijl@telenet.be)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include <Arduino.h>
+
+// resolved addresses are trusted for a day, and re-validated earlier when a connect fails
+static const uint32_t MDNS_CACHE_TTL = 24 * 3600;
+static const int MDNS_CACHE_SIZE = 8;
+// a full mDNS label (63 bytes) with ".local", longer names are kept truncated
+static const size_t MDNS_HOST_SIZE = 63 + sizeof(".local");
+
+typedef struct mdns_cache_entry {
+    char host[MDNS_HOST_SIZE];
+    uint32_t ip;
+    uint32_t resolved_at; // get_rtc_seconds()
+} MDNS_CACHE_ENTRY;
+
+///
+/// hostname -> ip cache that survives deep sleep (RTC memory) and power off (NVS)
+///
+class MDNS_Cache {
+public:
+    static bool lookup(const char* host, IPAddress& ip);
+    static void store(const char* host, const IPAddress& ip);
+    static void forget(const char* host);
+};
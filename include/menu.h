@@ -23,6 +23,7 @@
 
 #include "config.h"
 #include "epdfunctions.h"
+#include "mpdresponse.h"
 
 class SubMenu {
 private:
@@ -30,20 +31,29 @@ private:
     uint16_t y;
     uint16_t y_incr;
     MenuLines lines;
+    MenuBitmap bitmap;
 
 public:
-    SubMenu(uint16_t y_incr)
+    // cached false: a menu that is shown once, e.g. a queue or library page, keeps no bitmap
+    SubMenu(uint16_t y_incr, bool cached = true)
         : x(10)
         , y(10)
+        , bitmap(cached)
     {
         this->y_incr = y_incr;
     }
     ~SubMenu()
+    {
+        this->clear();
+    }
+    void clear()
     {
         for (auto ml = this->lines.begin(); ml != this->lines.end(); ++ml) {
             delete *ml;
         }
         this->lines.clear();
+        this->bitmap.clear();
+        this->y = 10;
     }
     size_t size()
     {
@@ -53,10 +63,15 @@ public:
     {
         this->lines.reserve(n);
     }
+    const char* line(size_t i)
+    {
+        return this->lines[i]->text;
+    }
     void add_line(const char* line)
     {
         this->lines.push_back(new MENULINE { this->x, this->y, line });
         this->y += this->y_incr;
+        this->bitmap.clear();
     }
     int display_menu();
 };
@@ -67,8 +82,15 @@ private:
     SubMenu PlayerMenu;
     vector<SubMenu*> FavouriteMenus;
     void toggle_start_stop();
+    void create_player_menu();
     void select_player();
+    void browse_queue();
+    bool select_library_entry(int level, const MPD_LIBRARY_ENTRY* artist, const MPD_LIBRARY_ENTRY* album, MPD_LIBRARY_ENTRY& picked);
+    void browse_library();
+    void show_dashboard();
+    const FAVOURITE* pick_favourite(int page);
     void select_favourite(int page);
+    void play_group();
 
 public:
     static const int MAXLINES = 20;
@@ -0,0 +1,67 @@
+// Copyright (c) 2023 @dheijl (danny.heijl@telenet.be)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+#include <Arduino.h>
+#include <vector>
+
+using std::vector;
+
+// PSRAM for all menu bitmaps together: a page is 237,600 bytes, a highlighted line 9,720
+const size_t MENU_BITMAP_BUDGET = 1024 * 1024;
+
+///
+/// a menu page as packed 4 bit pixels in PSRAM, with the highlighted band of each
+/// line rendered the first time it is selected. All menu bitmaps share
+/// MENU_BITMAP_BUDGET: the least recently used ones are dropped to make room.
+/// A disabled bitmap (a menu that is shown once) keeps nothing, so that it does
+/// not push out the pages of the menus that come back.
+///
+class MenuBitmap {
+private:
+    bool enabled;
+    uint8_t* page;
+    vector<uint8_t*> highlighted;
+    size_t bytes;
+    uint32_t last_used;
+
+    void touch();
+    void make_room(size_t size);
+    uint8_t* copy(const uint8_t* pixels, size_t size);
+
+public:
+    MenuBitmap(bool enabled = true);
+    ~MenuBitmap();
+    MenuBitmap(const MenuBitmap&) = delete;
+    MenuBitmap& operator=(const MenuBitmap&) = delete;
+
+    bool is_enabled()
+    {
+        return this->enabled;
+    }
+    void clear();
+    // the page without a selection, NULL if not rendered yet
+    const uint8_t* get_page();
+    bool set_page(const uint8_t* pixels, size_t size);
+    // the band of line i when selected, NULL if not rendered yet
+    const uint8_t* get_line(size_t i);
+    bool set_line(size_t i, const uint8_t* pixels, size_t size);
+};
@@ -0,0 +1,273 @@
+// Copyright (c) 2023 @dheijl (danny.heijl@telenet.be)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+// no PSRAM: plain heap
+#define heap_caps_malloc(size, caps) malloc(size)
+#define heap_caps_realloc(p, size, caps) realloc(p, size)
+#define heap_caps_free(p) free(p)
+#endif
+
+///
+/// reusable receive buffer: it only grows, and moves to PSRAM once a reply
+/// no longer fits in a small internal RAM block
+///
+class MpdBuffer {
+private:
+    static const size_t INITIAL_SIZE = 4096;
+    static const size_t PSRAM_THRESHOLD = 16384;
+    static const size_t MAX_SIZE = 512 * 1024;
+    char* buf;
+    size_t cap;
+    size_t len;
+    bool in_psram;
+    uint32_t allocs;
+
+public:
+    MpdBuffer()
+        : buf(NULL)
+        , cap(0)
+        , len(0)
+        , in_psram(false)
+        , allocs(0)
+    {
+    }
+    ~MpdBuffer()
+    {
+        if (this->buf != NULL) {
+            heap_caps_free(this->buf);
+        }
+    }
+    MpdBuffer(const MpdBuffer&) = delete;
+    MpdBuffer& operator=(const MpdBuffer&) = delete;
+
+    void clear()
+    {
+        this->len = 0;
+    }
+    // make room for at least n more bytes (plus a terminating NUL)
+    bool reserve(size_t n)
+    {
+        size_t needed = this->len + n + 1;
+        if (needed <= this->cap) {
+            return true;
+        }
+        if (needed > MAX_SIZE) {
+            return false;
+        }
+        size_t new_cap = this->cap == 0 ? INITIAL_SIZE : this->cap;
+        while (new_cap < needed) {
+            new_cap *= 2;
+        }
+        new_cap = new_cap < MAX_SIZE ? new_cap : MAX_SIZE;
+        char* new_buf = NULL;
+        if (new_cap >= PSRAM_THRESHOLD) {
+            // don't move a large buffer back and forth: once in PSRAM, stay there
+            new_buf = (char*)heap_caps_realloc(this->buf, new_cap, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+            if (new_buf != NULL) {
+                this->in_psram = true;
+            }
+        }
+        if (new_buf == NULL) {
+            new_buf = (char*)heap_caps_realloc(this->buf, new_cap, MALLOC_CAP_8BIT);
+        }
+        if (new_buf == NULL) {
+            return false;
+        }
+        this->buf = new_buf;
+        this->cap = new_cap;
+        ++this->allocs;
+        return true;
+    }
+    // free space after the data, valid after a successful reserve()
+    char* tail()
+    {
+        return this->buf + this->len;
+    }
+    void commit(size_t n)
+    {
+        this->len += n;
+        this->buf[this->len] = '\0';
+    }
+    // drop the first n bytes, keeping the rest (a partial line) at the start
+    void consume(size_t n)
+    {
+        if (n >= this->len) {
+            this->len = 0;
+        } else if (n > 0) {
+            memmove(this->buf, this->buf + n, this->len - n);
+            this->len -= n;
+        }
+        if (this->buf != NULL) {
+            this->buf[this->len] = '\0';
+        }
+    }
+    const char* data() const
+    {
+        return this->buf;
+    }
+    size_t size() const
+    {
+        return this->len;
+    }
+    bool is_psram() const
+    {
+        return this->in_psram;
+    }
+    size_t capacity() const
+    {
+        return this->cap;
+    }
+    // number of (re)allocations so far
+    uint32_t allocations() const
+    {
+        return this->allocs;
+    }
+    ///
+    /// true if the data ends with a complete MPD terminator line:
+    /// "OK", "OK MPD x.y.z" (greeting) or "ACK [error@command_listNum] {command} message"
+    ///
+    bool is_complete() const
+    {
+        if ((this->len == 0) || (this->buf[this->len - 1] != '\n')) {
+            return false;
+        }
+        // find the start of the last line
+        size_t start = this->len - 1;
+        while ((start > 0) && (this->buf[start - 1] != '\n')) {
+            --start;
+        }
+        const char* line = this->buf + start;
+        size_t line_len = this->len - 1 - start;
+        if ((line_len == 2) && (strncmp(line, "OK", 2) == 0)) {
+            return true;
+        }
+        if ((line_len > 3) && (strncmp(line, "OK ", 3) == 0) && (start == 0)) {
+            return true;
+        }
+        if ((line_len > 4) && (strncmp(line, "ACK ", 4) == 0)) {
+            return true;
+        }
+        return false;
+    }
+};
+
+///
+/// destination of a binary reply (album art): allocated once in PSRAM at the size
+/// MPD announces, and then filled chunk by chunk straight from the socket
+///
+class MpdPicture {
+private:
+    static const size_t MAX_SIZE = 1024 * 1024;
+    uint8_t* buf;
+    size_t cap;
+    size_t len;
+    size_t total;
+    char mime[32];
+
+public:
+    MpdPicture()
+        : buf(NULL)
+        , cap(0)
+        , len(0)
+        , total(0)
+    {
+        this->mime[0] = '\0';
+    }
+    ~MpdPicture()
+    {
+        if (this->buf != NULL) {
+            heap_caps_free(this->buf);
+        }
+    }
+    MpdPicture(const MpdPicture&) = delete;
+    MpdPicture& operator=(const MpdPicture&) = delete;
+
+    void clear()
+    {
+        this->len = 0;
+        this->total = 0;
+        this->mime[0] = '\0';
+    }
+    // room for a picture of total_size bytes, the buffer is kept for the next one
+    bool begin(size_t total_size)
+    {
+        if ((total_size == 0) || (total_size > MAX_SIZE)) {
+            return false;
+        }
+        if (total_size > this->cap) {
+            if (this->buf != NULL) {
+                heap_caps_free(this->buf);
+            }
+            this->buf = (uint8_t*)heap_caps_malloc(total_size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+            this->cap = this->buf != NULL ? total_size : 0;
+            if (this->buf == NULL) {
+                return false;
+            }
+        }
+        this->len = 0;
+        this->total = total_size;
+        return true;
+    }
+    uint8_t* tail()
+    {
+        return this->buf + this->len;
+    }
+    void commit(size_t n)
+    {
+        this->len += n;
+    }
+    void set_type(const char* type, size_t type_len)
+    {
+        type_len = type_len < sizeof(this->mime) - 1 ? type_len : sizeof(this->mime) - 1;
+        memcpy(this->mime, type, type_len);
+        this->mime[type_len] = '\0';
+    }
+    const uint8_t* data() const
+    {
+        return this->buf;
+    }
+    // bytes received so far
+    size_t size() const
+    {
+        return this->len;
+    }
+    size_t total_size() const
+    {
+        return this->total;
+    }
+    // mime type, only sent by readpicture
+    const char* type() const
+    {
+        return this->mime;
+    }
+    bool is_complete() const
+    {
+        return (this->total > 0) && (this->len == this->total);
+    }
+};
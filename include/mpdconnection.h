@@ -0,0 +1,951 @@
+// Copyright (c) 2023 @dheijl (danny.heijl@telenet.be)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#include "mpdbuffer.h"
+#include "mpdqueue.h"
+#include "mpdresponse.h"
+#include "mpdtransport.h"
+#include "textlayout.h"
+
+using std::string;
+using std::vector;
+
+static const constexpr char* MPD_CURRENTSONG = "currentsong\n";
+static const constexpr char* MPD_STATUS = "status\n";
+static const constexpr char* MPD_START = "play\n";
+static const constexpr char* MPD_STOP = "stop\n";
+static const constexpr char* MPD_CLEAR = "clear\n";
+static const constexpr char* MPD_ADD = "add";
+static const constexpr char* MPD_PLAYLISTINFO = "playlistinfo %u:%u\n";
+static const constexpr char* MPD_PLAYPOS = "play %u\n";
+static const constexpr char* MPD_IDLE = "idle player mixer playlist options\n";
+static const constexpr char* MPD_NOIDLE = "noidle\n";
+static const constexpr char* MPD_LIST_BEGIN = "command_list_ok_begin\n";
+static const constexpr char* MPD_LIST_END = "command_list_end\n";
+static const constexpr char* MPD_BINARYLIMIT = "binarylimit 65536\n";
+static const constexpr char* MPD_READPICTURE = "readpicture";
+static const constexpr char* MPD_ALBUMART = "albumart";
+// default timeouts in ms
+static const uint32_t MPD_CONNECT_TIMEOUT = 3000;
+static const uint32_t MPD_READ_TIMEOUT = 5000;
+
+// status lines of the last MpdConnection command
+typedef vector<string> MpdStatusLines;
+
+typedef enum {
+    MpdPictureOk,
+    MpdPictureNone, // the player answered that there is no picture
+    MpdPictureError, // no answer, a broken reply or no memory: try again later
+} MpdPictureResult;
+
+///
+/// wire statistics of an MpdConnection, to measure how long an operation keeps the radio busy
+///
+typedef struct mpd_stats {
+    uint32_t connects;
+    uint32_t round_trips;
+    uint32_t bytes_sent;
+    uint32_t bytes_received;
+    uint32_t elapsed_ms;
+    uint32_t buffer_reallocs; // receive buffer (re)allocations, not all heap allocations
+    uint32_t buffer_size;
+} MPD_STATS;
+
+class MpdConnection {
+private:
+    MpdTransport* transport;
+    bool own_transport;
+    MpdStatusLines status;
+    string last_error;
+    MpdBuffer rbuf;
+    uint32_t read_timeout;
+    uint32_t connect_timeout;
+    uint32_t deadline;
+    bool has_deadline;
+    bool idling;
+    MPD_STATS stats;
+    uint32_t allocs_at_reset;
+    bool binary_limit_sent;
+    string current_file;
+    uint32_t cover_key;
+    void send(const char* data, size_t len)
+    {
+        this->stats.bytes_sent += this->transport->write((const uint8_t*)data, len);
+    }
+    void send(const char* command)
+    {
+        this->send(command, strlen(command));
+    }
+    // ms left until the deadline, 0 once it has passed
+    uint32_t deadline_left()
+    {
+        int32_t left = (int32_t)(this->deadline - mpd_millis());
+        return left > 0 ? (uint32_t)left : 0;
+    }
+    // how long to wait for more data: the read timeout since start, but never past the deadline
+    uint32_t wait_time(uint32_t start)
+    {
+        uint32_t elapsed = mpd_millis() - start;
+        uint32_t wait = elapsed < this->read_timeout ? this->read_timeout - elapsed : 0;
+        if (this->has_deadline) {
+            uint32_t left = this->deadline_left();
+            wait = left < wait ? left : wait;
+        }
+        return wait;
+    }
+    // read a complete reply (up to and including the OK/ACK line) into rbuf
+    size_t read_data()
+    {
+        this->rbuf.clear();
+        this->stats.round_trips++;
+        uint32_t start = mpd_millis();
+        while (true) {
+            int avail = this->transport->available();
+            if (avail > 0) {
+                if (!this->rbuf.reserve(avail)) {
+                    this->status.push_back("response too large");
+                    return 0;
+                }
+                int n = this->transport->read((uint8_t*)this->rbuf.tail(), avail);
+                if (n > 0) {
+                    this->stats.bytes_received += n;
+                    this->rbuf.commit(n);
+                    if (this->rbuf.is_complete()) {
+                        return this->rbuf.size();
+                    }
+                }
+            } else if (!this->transport->connected()) {
+                this->status.push_back("connection closed");
+                return 0;
+            }
+            uint32_t wait = this->wait_time(start);
+            if (wait == 0) {
+                this->status.push_back(this->rbuf.size() == 0 ? "no response" : "incomplete response");
+                return 0;
+            }
+            this->transport->wait_for_data(wait);
+        }
+    }
+
+    ///
+    /// read a reply of any size line by line: every complete line is decoded by the
+    /// response as it arrives and only a partial line is kept in the buffer
+    ///
+    bool read_stream(MpdResponse& response)
+    {
+        static const size_t STREAM_CHUNK = 2048;
+        this->rbuf.clear();
+        this->stats.round_trips++;
+        uint32_t start = mpd_millis();
+        while (true) {
+            int avail = this->transport->available();
+            if (avail > 0) {
+                size_t chunk = (size_t)avail < STREAM_CHUNK ? (size_t)avail : STREAM_CHUNK;
+                if (!this->rbuf.reserve(chunk)) {
+                    this->status.push_back("response line too large");
+                    return false;
+                }
+                int n = this->transport->read((uint8_t*)this->rbuf.tail(), chunk);
+                if (n > 0) {
+                    this->stats.bytes_received += n;
+                    this->rbuf.commit(n);
+                    MpdLineReader reader(this->rbuf.data(), this->rbuf.size());
+                    MpdSpan line;
+                    size_t done = 0;
+                    while (reader.next(line) && (line.ptr + line.len < this->rbuf.data() + this->rbuf.size())) {
+                        done = (line.ptr - this->rbuf.data()) + line.len + 1;
+                        if (response.feed_line(line)) {
+                            return response.getResponseType() == MpdOKType;
+                        }
+                    }
+                    this->rbuf.consume(done);
+                    // the deadline applies to gaps in the stream, not to its total length
+                    start = mpd_millis();
+                }
+            } else if (!this->transport->connected()) {
+                this->status.push_back("connection closed");
+                return false;
+            }
+            uint32_t wait = this->wait_time(start);
+            if (wait == 0) {
+                this->status.push_back("incomplete response");
+                return false;
+            }
+            this->transport->wait_for_data(wait);
+        }
+    }
+
+    // read a little more into rbuf, false on a timeout or a closed connection
+    bool fill_rbuf(uint32_t& start)
+    {
+        // small reads, so that binary data following a header mostly stays in the socket
+        static const size_t FILL_CHUNK = 256;
+        while (true) {
+            int avail = this->transport->available();
+            if (avail > 0) {
+                size_t chunk = (size_t)avail < FILL_CHUNK ? (size_t)avail : FILL_CHUNK;
+                if (!this->rbuf.reserve(chunk)) {
+                    this->status.push_back("response line too large");
+                    return false;
+                }
+                int n = this->transport->read((uint8_t*)this->rbuf.tail(), chunk);
+                if (n > 0) {
+                    this->stats.bytes_received += n;
+                    this->rbuf.commit(n);
+                    start = mpd_millis();
+                    return true;
+                }
+            } else if (!this->transport->connected()) {
+                this->status.push_back("connection closed");
+                return false;
+            }
+            uint32_t wait = this->wait_time(start);
+            if (wait == 0) {
+                this->status.push_back("incomplete response");
+                return false;
+            }
+            this->transport->wait_for_data(wait);
+        }
+    }
+
+    // read exactly n bytes straight into dst, bypassing rbuf
+    bool read_exact(uint8_t* dst, size_t n, uint32_t& start)
+    {
+        while (n > 0) {
+            int avail = this->transport->available();
+            if (avail > 0) {
+                int got = this->transport->read(dst, (size_t)avail < n ? (size_t)avail : n);
+                if (got > 0) {
+                    this->stats.bytes_received += got;
+                    dst += got;
+                    n -= got;
+                    start = mpd_millis();
+                    continue;
+                }
+            } else if (!this->transport->connected()) {
+                this->status.push_back("connection closed");
+                return false;
+            }
+            uint32_t wait = this->wait_time(start);
+            if (wait == 0) {
+                this->status.push_back("incomplete binary response");
+                return false;
+            }
+            this->transport->wait_for_data(wait);
+        }
+        return true;
+    }
+
+    ///
+    /// one albumart/readpicture exchange at the current size of pic:
+    /// "size: S", "type: T" (readpicture only), "binary: N", N bytes, "\n", "OK".
+    /// returns 1 after a chunk, 0 if there is no picture, -1 on errors
+    ///
+    int read_picture_chunk(const char* command, const char* uri, MpdPicture& pic)
+    {
+        string cmd(command);
+        append_arg(cmd, uri);
+        cmd += " " + std::to_string(pic.size()) + "\n";
+        this->send(cmd.c_str(), cmd.length());
+        this->rbuf.clear();
+        this->stats.round_trips++;
+        uint32_t start = mpd_millis();
+        size_t parsed = 0;
+        long total = -1;
+        long chunk = -1;
+        while (chunk < 0) {
+            const char* line_start = this->rbuf.data() + parsed;
+            const char* nl = this->rbuf.size() > parsed ? (const char*)memchr(line_start, '\n', this->rbuf.size() - parsed) : NULL;
+            if (nl == NULL) {
+                if (!this->fill_rbuf(start)) {
+                    return -1;
+                }
+                continue;
+            }
+            MpdSpan line { line_start, (size_t)(nl - line_start) };
+            parsed += line.len + 1;
+            if (line.equals("OK")) {
+                // readpicture: no embedded picture
+                return 0;
+            } else if (line.starts_with("ACK ")) {
+                this->last_error = string(line.ptr, line.len);
+                // albumart: no cover file (ACK_ERROR_NO_EXIST), readpicture: unknown before MPD 0.22
+                if (line.starts_with("ACK [50@") || ((strcmp(command, MPD_READPICTURE) == 0) && line.starts_with("ACK [5@"))) {
+                    return 0;
+                }
+                this->status.push_back("picture: " + this->last_error);
+                return -1;
+            } else if (line.starts_with("size: ")) {
+                total = MpdSpan { line.ptr + 6, line.len - 6 }.to_long();
+            } else if (line.starts_with("type: ")) {
+                pic.set_type(line.ptr + 6, line.len - 6);
+            } else if (line.starts_with("binary: ")) {
+                chunk = MpdSpan { line.ptr + 8, line.len - 8 }.to_long();
+            }
+        }
+        if ((pic.size() == 0) && (total > 0) && !pic.begin((size_t)total)) {
+            this->status.push_back("picture too large");
+            return -1;
+        }
+        if ((total != (long)pic.total_size()) || (chunk <= 0) || (pic.size() + chunk > pic.total_size())) {
+            this->status.push_back("bad picture chunk");
+            return -1;
+        }
+        // the start of the data may already be in rbuf, the rest comes straight from the socket
+        size_t have = this->rbuf.size() - parsed;
+        have = have < (size_t)chunk ? have : (size_t)chunk;
+        memcpy(pic.tail(), this->rbuf.data() + parsed, have);
+        pic.commit(have);
+        parsed += have;
+        if ((have < (size_t)chunk) && !this->read_exact(pic.tail(), chunk - have, start)) {
+            return -1;
+        }
+        pic.commit(chunk - have);
+        // exactly "\n" after the data, then "OK"
+        static const char TRAILER[] = "\nOK\n";
+        static const size_t TRAILER_LEN = sizeof(TRAILER) - 1;
+        this->rbuf.consume(parsed);
+        while (this->rbuf.size() < TRAILER_LEN) {
+            if (!this->fill_rbuf(start)) {
+                return -1;
+            }
+        }
+        if ((this->rbuf.size() != TRAILER_LEN) || (memcmp(this->rbuf.data(), TRAILER, TRAILER_LEN) != 0)) {
+            this->status.push_back("bad picture chunk end");
+            // the replies can no longer be told apart
+            this->transport->stop();
+            return -1;
+        }
+        this->rbuf.clear();
+        return 1;
+    }
+
+    // append a quoted and escaped command argument
+    static void append_arg(string& cmd, const char* arg)
+    {
+        cmd += " \"";
+        for (auto p = arg; *p != '\0'; ++p) {
+            if ((*p == '"') || (*p == '\\')) {
+                cmd += '\\';
+            }
+            cmd += *p;
+        }
+        cmd += '"';
+    }
+
+    // status lines for a "status" reply, returns true if playing
+    bool report_status(const MpdSpan& reply)
+    {
+        this->status.push_back(" ");
+        MpdStatus mpd_status(reply.ptr, reply.len);
+        auto format = mpd_status.getFormat();
+        if (mpd_status.isPlaying()) {
+            this->status.push_back("Playing (" + string(format) + ")");
+        } else {
+            this->status.push_back("Stopped (" + string(format) + ")");
+        }
+        this->last_error = mpd_status.getError();
+        if (!this->last_error.empty()) {
+            this->status.push_back("*ERR: " + this->last_error);
+        }
+        return mpd_status.isPlaying();
+    }
+    static uint32_t fnv1a(uint32_t hash, const char* s, size_t len)
+    {
+        for (size_t i = 0; i < len; ++i) {
+            hash = (hash ^ (uint8_t)s[i]) * 16777619u;
+        }
+        return hash;
+    }
+    // songs of an album share their cover: hash album and artist, or else the directory.
+    // 0 for streams and an empty queue, they have no cover
+    static uint32_t song_cover_key(const char* file, const char* album, const char* artist)
+    {
+        if ((file[0] == '\0') || (strstr(file, "://") != NULL)) {
+            return 0;
+        }
+        uint32_t hash = 2166136261u;
+        if (album[0] != '\0') {
+            hash = fnv1a(hash, album, strlen(album));
+            hash = fnv1a(hash, "|", 1);
+            hash = fnv1a(hash, artist, strlen(artist));
+        } else {
+            auto slash = strrchr(file, '/');
+            hash = fnv1a(hash, file, slash != NULL ? slash - file : 0);
+        }
+        return hash != 0 ? hash : 1;
+    }
+    // status lines for a "currentsong" reply
+    void report_current_song(const MpdSpan& reply)
+    {
+        MpdCurrentSong mpd_cs(reply.ptr, reply.len);
+        auto curfile = mpd_cs.getFile();
+        this->current_file = curfile;
+        // the album artist, so that the songs of a compilation share one cover
+        auto& song = mpd_cs.getSong();
+        this->cover_key = song_cover_key(curfile, song.album, song.albumartist[0] != '\0' ? song.albumartist : song.artist);
+        // the end of the path, without cutting a UTF-8 character in two
+        auto tail = TextLayout::utf8_tail(curfile, 26);
+        string file = (tail == curfile) ? string(curfile) : "..." + string(tail);
+        this->status.push_back(file);
+        this->status.push_back(" ");
+        auto name = mpd_cs.getName();
+        if (name[0] != '\0') {
+            this->status.push_back(name);
+        }
+        this->status.push_back(" ");
+        auto title = mpd_cs.getTitle();
+        if (title[0] != '\0') {
+            this->status.push_back(title);
+        }
+        auto artist = mpd_cs.getArtist();
+        if (artist[0] != '\0') {
+            this->status.push_back(artist);
+        }
+    }
+    // status line for a simple command reply, returns true if OK
+    bool report_command(const MpdSpan& reply)
+    {
+        MpdSimpleCommand mpd_command(reply.ptr, reply.len);
+        this->status.push_back(mpd_command.GetResult());
+        return mpd_command.getResponseType() == MpdOKType;
+    }
+    ///
+    /// send n commands (each terminated by a newline) as one command list with a
+    /// single write, read the reply once and split it into the per-command sections,
+    /// each ending with its "list_OK" or "ACK" line.
+    /// returns the number of commands that succeeded, or -1 if there was no reply.
+    ///
+    int run_command_list(const char* const* commands, int n, MpdSpan* results)
+    {
+        string batch(MPD_LIST_BEGIN);
+        for (int i = 0; i < n; ++i) {
+            batch += commands[i];
+            results[i] = MpdSpan { NULL, 0 };
+        }
+        batch += MPD_LIST_END;
+        this->send(batch.c_str(), batch.length());
+        size_t len = read_data();
+        if (len == 0) {
+            return -1;
+        }
+        MpdLineReader reader(this->rbuf.data(), len);
+        MpdSpan line;
+        const char* section = this->rbuf.data();
+        int i = 0;
+        while ((i < n) && reader.next(line)) {
+            if (line.equals("list_OK") || line.starts_with("ACK")) {
+                const char* section_end = line.ptr + line.len + 1;
+                results[i] = MpdSpan { section, (size_t)(section_end - section) };
+                section = section_end;
+                if (line.starts_with("ACK")) {
+                    break;
+                }
+                ++i;
+            }
+        }
+        return i;
+    }
+
+protected:
+public:
+    MpdConnection()
+        : transport(new MpdDefaultTransport())
+        , own_transport(true)
+        , read_timeout(MPD_READ_TIMEOUT)
+        , connect_timeout(MPD_CONNECT_TIMEOUT)
+        , deadline(0)
+        , has_deadline(false)
+        , idling(false)
+        , binary_limit_sent(false)
+        , cover_key(0)
+    {
+        this->ResetStats();
+    }
+
+    // use an external transport (not owned), e.g. a fake server
+    MpdConnection(MpdTransport* transport)
+        : transport(transport)
+        , own_transport(false)
+        , read_timeout(MPD_READ_TIMEOUT)
+        , connect_timeout(MPD_CONNECT_TIMEOUT)
+        , deadline(0)
+        , has_deadline(false)
+        , idling(false)
+        , binary_limit_sent(false)
+        , cover_key(0)
+    {
+        this->ResetStats();
+    }
+
+    ~MpdConnection()
+    {
+        if (this->own_transport) {
+            delete this->transport;
+        }
+    }
+
+    MpdConnection(const MpdConnection&) = delete;
+    MpdConnection& operator=(const MpdConnection&) = delete;
+
+    void ResetStats()
+    {
+        memset(&this->stats, 0, sizeof(this->stats));
+        this->allocs_at_reset = this->rbuf.allocations();
+    }
+
+    const MPD_STATS& GetStats()
+    {
+        this->stats.buffer_reallocs = this->rbuf.allocations() - this->allocs_at_reset;
+        this->stats.buffer_size = this->rbuf.capacity();
+        return this->stats;
+    }
+
+    void SetReadTimeout(uint32_t timeout_ms)
+    {
+        this->read_timeout = timeout_ms;
+    }
+
+    void SetConnectTimeout(uint32_t timeout_ms)
+    {
+        this->connect_timeout = timeout_ms;
+    }
+
+    ///
+    /// no connect or read of this connection goes past budget_ms from now, whatever
+    /// the timeouts: the work is cancelled as a timeout. 0 removes the deadline.
+    ///
+    void SetDeadline(uint32_t budget_ms)
+    {
+        this->has_deadline = budget_ms > 0;
+        this->deadline = mpd_millis() + budget_ms;
+    }
+
+    bool DeadlinePassed()
+    {
+        return this->has_deadline && (this->deadline_left() == 0);
+    }
+
+    MpdStatusLines& GetResponse()
+    {
+        return this->status;
+    }
+
+    string GetLastError()
+    {
+        return this->last_error;
+    }
+
+    bool Connect(const char* host, int port)
+    {
+        this->status.clear();
+        this->last_error.clear();
+        this->stats.connects++;
+        this->binary_limit_sent = false;
+        uint32_t timeout = this->connect_timeout;
+        if (this->has_deadline) {
+            uint32_t left = this->deadline_left();
+            if (left == 0) {
+                this->status.push_back("MPD deadline passed");
+                return false;
+            }
+            timeout = left < timeout ? left : timeout;
+        }
+        this->transport->set_connect_timeout(timeout);
+        if (this->transport->connect(host, port)) {
+            this->status.push_back("MPD @" + string(host) + ":" + std::to_string(port));
+            size_t len = read_data();
+            if (len == 0) {
+                return false;
+            }
+            MpdConnect con(this->rbuf.data(), len);
+            if (con.getResponseType() != MpdOKType) {
+                // not a greeting: show what came instead, e.g. an ACK
+                MpdLineReader reader(this->rbuf.data(), len);
+                MpdSpan line { NULL, 0 };
+                if (reader.next(line)) {
+                    this->last_error = string(line.ptr, line.len);
+                } else {
+                    // no complete line
+                    this->last_error = string(this->rbuf.data(), len);
+                }
+                this->status.push_back("MPD Version: " + this->last_error);
+                return false;
+            }
+            return true;
+        } else {
+            this->status.push_back("MPD Connection failed");
+            return false;
+        }
+    }
+    void Disconnect()
+    {
+        this->status.clear();
+        // this->status.push_back("Disconnect MPD");
+        this->idling = false;
+        this->transport->stop();
+    }
+
+    bool IsConnected()
+    {
+        return this->transport->connected();
+    }
+
+    bool IsIdling()
+    {
+        return this->idling;
+    }
+
+    ///
+    /// enter idle mode: MPD answers only when one of the subsystems changes
+    ///
+    void Idle()
+    {
+        this->status.clear();
+        this->send(MPD_IDLE);
+        this->idling = true;
+    }
+
+    ///
+    /// non-blocking check for an idle reply, returns a MpdIdleEvent bitmask,
+    /// MpdIdleNone if nothing changed yet, or -1 if the connection is lost.
+    /// after a change MPD has left idle mode, call Idle() again to re-enter it.
+    ///
+    int PollIdle()
+    {
+        if (!this->idling) {
+            return MpdIdleNone;
+        }
+        if (this->transport->available() == 0) {
+            if (!this->transport->connected()) {
+                this->idling = false;
+                return -1;
+            }
+            return MpdIdleNone;
+        }
+        this->idling = false;
+        size_t len = read_data();
+        if (len == 0) {
+            return -1;
+        }
+        MpdIdle mpd_idle(this->rbuf.data(), len);
+        return mpd_idle.getChanged();
+    }
+
+    ///
+    /// leave idle mode so that other commands can be sent
+    ///
+    bool NoIdle()
+    {
+        this->status.clear();
+        if (!this->idling) {
+            return true;
+        }
+        this->idling = false;
+        this->send(MPD_NOIDLE);
+        // MPD answers with the pending changes (if any) and OK
+        return read_data() > 0;
+    }
+
+    bool GetStatus()
+    {
+        this->status.clear();
+        this->send(MPD_STATUS);
+        size_t len = read_data();
+        if (len == 0) {
+            return false;
+        }
+        return report_status(MpdSpan { this->rbuf.data(), len });
+    }
+
+    bool IsPlaying()
+    {
+        this->status.clear();
+        this->send(MPD_STATUS);
+        size_t len = read_data();
+        if (len == 0) {
+            return false;
+        }
+        MpdStatus mpd_status(this->rbuf.data(), len);
+        this->status.push_back("MPD status: " + string(mpd_status.getStateName()));
+        return mpd_status.isPlaying();
+    }
+
+    bool GetCurrentSong()
+    {
+        this->status.clear();
+        this->send(MPD_CURRENTSONG);
+        size_t len = read_data();
+        if (len == 0) {
+            return false;
+        }
+        report_current_song(MpdSpan { this->rbuf.data(), len });
+        return true;
+    }
+
+    ///
+    /// status and currentsong in a single round trip, returns true if playing
+    ///
+    bool GetStatusAndSong()
+    {
+        this->status.clear();
+        static const char* const commands[] = { MPD_STATUS, MPD_CURRENTSONG };
+        MpdSpan results[2];
+        int ok = run_command_list(commands, 2, results);
+        if (ok < 0) {
+            return false;
+        }
+        bool playing = report_status(results[0]);
+        if (ok == 2) {
+            report_current_song(results[1]);
+        }
+        return playing;
+    }
+
+    // uri of the song in the last GetStatusAndSong()
+    const string& GetCurrentFile()
+    {
+        return this->current_file;
+    }
+    // cover cache key of that song, 0 if it can have no cover
+    uint32_t GetCoverKey()
+    {
+        return this->cover_key;
+    }
+
+    ///
+    /// cover art of a song into a PSRAM buffer: the embedded picture (readpicture),
+    /// else the cover file in its directory (albumart)
+    ///
+    MpdPictureResult GetAlbumArt(const char* uri, MpdPicture& pic)
+    {
+        this->status.clear();
+        if (!this->binary_limit_sent) {
+            // bigger chunks than the default 8 KB: fewer round trips (MPD 0.22.4+, older ones ACK it)
+            this->send(MPD_BINARYLIMIT);
+            read_data();
+            this->binary_limit_sent = true;
+        }
+        static const char* const commands[] = { MPD_READPICTURE, MPD_ALBUMART };
+        for (auto command : commands) {
+            pic.clear();
+            int result;
+            while ((result = read_picture_chunk(command, uri, pic)) > 0) {
+                if (pic.is_complete()) {
+                    return MpdPictureOk;
+                }
+            }
+            if (result < 0) {
+                return MpdPictureError;
+            }
+        }
+        this->status.push_back("no album art");
+        return MpdPictureNone;
+    }
+
+    bool Stop()
+    {
+        this->status.clear();
+        this->send(MPD_STOP);
+        size_t len = read_data();
+        if (len == 0) {
+            return false;
+        }
+        report_command(MpdSpan { this->rbuf.data(), len });
+        return true;
+    }
+
+    bool Play()
+    {
+        this->status.clear();
+        this->send(MPD_START);
+        size_t len = read_data();
+        if (len == 0) {
+            return false;
+        }
+        report_command(MpdSpan { this->rbuf.data(), len });
+        return true;
+    }
+
+    bool Clear()
+    {
+        this->status.clear();
+        this->send(MPD_CLEAR);
+        size_t len = read_data();
+        if (len == 0) {
+            return false;
+        }
+        report_command(MpdSpan { this->rbuf.data(), len });
+        return true;
+    }
+
+    bool Add_Url(const char* url)
+    {
+        this->status.clear();
+        string add_cmd(MPD_ADD);
+        append_arg(add_cmd, url);
+        add_cmd += "\n";
+        this->send(add_cmd.c_str(), add_cmd.length());
+        size_t len = read_data();
+        if (len == 0) {
+            return false;
+        }
+        report_command(MpdSpan { this->rbuf.data(), len });
+        return true;
+    }
+
+    ///
+    /// typed status and current song in a single round trip, without status lines
+    ///
+    bool GetPlayerSummary(MPD_STATUS_DATA& state, MPD_SONG_DATA& song)
+    {
+        this->status.clear();
+        static const char* const commands[] = { MPD_STATUS, MPD_CURRENTSONG };
+        MpdSpan results[2];
+        int ok = run_command_list(commands, 2, results);
+        if (ok < 2) {
+            return false;
+        }
+        MpdStatus mpd_status(results[0].ptr, results[0].len);
+        state = mpd_status.getStatus();
+        MpdCurrentSong mpd_cs(results[1].ptr, results[1].len);
+        song = mpd_cs.getSong();
+        return true;
+    }
+
+    ///
+    /// status only, for the playlist version and length
+    ///
+    bool GetQueueState(MPD_STATUS_DATA& state)
+    {
+        this->status.clear();
+        this->send(MPD_STATUS);
+        size_t len = read_data();
+        if (len == 0) {
+            return false;
+        }
+        MpdStatus mpd_status(this->rbuf.data(), len);
+        state = mpd_status.getStatus();
+        return mpd_status.getResponseType() == MpdOKType;
+    }
+
+    ///
+    /// status and the queue window [start, end) in a single round trip
+    ///
+    bool GetQueueWindow(uint32_t start, uint32_t end, MPD_STATUS_DATA& state, MPD_QUEUE_ENTRY* entries, int capacity, int& count)
+    {
+        this->status.clear();
+        count = 0;
+        char window_cmd[48];
+        snprintf(window_cmd, sizeof(window_cmd), MPD_PLAYLISTINFO, start, end);
+        const char* const commands[] = { MPD_STATUS, window_cmd };
+        MpdSpan results[2];
+        int ok = run_command_list(commands, 2, results);
+        if (ok < 1) {
+            return false;
+        }
+        MpdStatus mpd_status(results[0].ptr, results[0].len);
+        state = mpd_status.getStatus();
+        if (ok == 2) {
+            MpdQueueInfo info(results[1].ptr, results[1].len, entries, capacity);
+            count = info.getCount();
+        }
+        return true;
+    }
+
+    ///
+    /// one page of "list tag [filter_tag filter_value]", starting at page->offset.
+    /// list has no window, so the reply is streamed and entries outside the page skipped.
+    ///
+    bool ListTag(const char* tag, const char* filter_tag, const char* filter_value, MPD_LIBRARY_PAGE* page)
+    {
+        this->status.clear();
+        string cmd = string("list ") + tag;
+        if (filter_tag != NULL) {
+            cmd += string(" ") + filter_tag;
+            append_arg(cmd, filter_value);
+        }
+        cmd += "\n";
+        this->send(cmd.c_str(), cmd.length());
+        MpdLibraryList result(page, page->offset, false);
+        return read_stream(result);
+    }
+
+    ///
+    /// one page of songs from "find" or "search" (command) with one or two tag/value
+    /// pairs, starting at page->offset. MPD limits the reply with a window.
+    ///
+    bool FindSongs(const char* command, const char* tag1, const char* value1, const char* tag2, const char* value2, MPD_LIBRARY_PAGE* page)
+    {
+        this->status.clear();
+        string cmd = string(command) + " " + tag1;
+        append_arg(cmd, value1);
+        if (tag2 != NULL) {
+            cmd += string(" ") + tag2;
+            append_arg(cmd, value2);
+        }
+        // one extra entry tells us if there is a next page
+        char window[40];
+        snprintf(window, sizeof(window), " window %u:%u\n", page->offset, page->offset + LIBRARY_PAGE_SIZE + 1);
+        cmd += window;
+        this->send(cmd.c_str(), cmd.length());
+        MpdLibraryList result(page, 0, true);
+        return read_stream(result);
+    }
+
+    bool PlayPos(uint32_t pos)
+    {
+        this->status.clear();
+        char play_cmd[24];
+        snprintf(play_cmd, sizeof(play_cmd), MPD_PLAYPOS, pos);
+        this->send(play_cmd);
+        size_t len = read_data();
+        if (len == 0) {
+            return false;
+        }
+        return report_command(MpdSpan { this->rbuf.data(), len });
+    }
+
+    ///
+    /// clear, add and play in a single round trip
+    ///
+    bool PlayUrl(const char* url)
+    {
+        this->status.clear();
+        string add_cmd(MPD_ADD);
+        append_arg(add_cmd, url);
+        add_cmd += "\n";
+        const char* const commands[] = { MPD_CLEAR, add_cmd.c_str(), MPD_START };
+        MpdSpan results[3];
+        int ok = run_command_list(commands, 3, results);
+        if (ok < 0) {
+            return false;
+        }
+        for (int i = 0; i < 3; ++i) {
+            report_command(results[i]);
+        }
+        return ok == 3;
+    }
+};
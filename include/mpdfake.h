@@ -0,0 +1,391 @@
+// Copyright (c) 2023 @dheijl (danny.heijl@telenet.be)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#ifndef ARDUINO
+#include <unistd.h>
+#endif
+
+#include "mpdtransport.h"
+
+using std::string;
+using std::vector;
+
+///
+/// behaviour of the simulated MPD server
+///
+typedef struct fake_mpd_cfg {
+    uint32_t rtt_ms; // delay between a request and the first byte of its reply
+    size_t segment_size; // max bytes returned by a single read
+    size_t title_size; // size of the Title tag in currentsong, to vary reply sizes
+    const char* ack_command; // answer this command with an ACK (NULL: never)
+    size_t library_size; // number of entries returned by list, find and search
+    size_t picture_size; // size of the embedded picture of every song (0: none)
+} FAKE_MPD_CFG;
+
+///
+/// in-process MPD protocol simulator that plugs in as an MpdTransport: greeting,
+/// status, currentsong, playlistinfo, list, find, search, play, stop, clear, add,
+/// binarylimit, readpicture, albumart, command lists and idle/noidle
+///
+class FakeMpdServer : public MpdTransport {
+private:
+    FAKE_MPD_CFG cfg;
+    bool is_connected;
+    string in;
+    string out;
+    size_t out_pos;
+    uint32_t ready_at;
+    // command list state
+    bool in_list;
+    bool list_ok;
+    vector<string> list;
+    // idle state
+    bool idling;
+    int pending_changes;
+    // player state
+    bool playing;
+    vector<string> queue;
+    uint32_t playlist_version;
+    size_t binary_limit;
+    // statistics
+    uint32_t requests;
+    uint32_t bytes_in;
+    uint32_t bytes_out;
+
+    static void sleep_ms(uint32_t ms)
+    {
+#ifdef ARDUINO
+        vTaskDelay(ms);
+#else
+        usleep(ms * 1000);
+#endif
+    }
+    void reply(const string& data)
+    {
+        if (this->out_pos >= this->out.length()) {
+            this->out.clear();
+            this->out_pos = 0;
+        }
+        if (this->out.empty()) {
+            this->ready_at = mpd_millis() + this->cfg.rtt_ms;
+        }
+        this->out += data;
+    }
+    static string command_name(const string& line)
+    {
+        auto p = line.find(' ');
+        return p == string::npos ? line : line.substr(0, p);
+    }
+    void changed(int subsystems)
+    {
+        this->pending_changes |= subsystems;
+        if (this->idling) {
+            this->idling = false;
+            this->reply(this->idle_changes() + "OK\n");
+        }
+    }
+    string idle_changes()
+    {
+        string result;
+        if (this->pending_changes & 1) {
+            result += "changed: player\n";
+        }
+        if (this->pending_changes & 4) {
+            result += "changed: playlist\n";
+        }
+        this->pending_changes = 0;
+        return result;
+    }
+    // execute a single command, returns an ACK line or the reply body without OK
+    bool execute(const string& line, int list_num, string& body)
+    {
+        string cmd = command_name(line);
+        if ((this->cfg.ack_command != NULL) && (cmd == this->cfg.ack_command)) {
+            body = "ACK [5@" + std::to_string(list_num) + "] {" + cmd + "} injected failure\n";
+            return false;
+        }
+        if (cmd == "status") {
+            body = "volume: 50\nrepeat: 0\nrandom: 0\nsingle: 0\nconsume: 0\n";
+            body += "playlist: " + std::to_string(this->playlist_version) + "\n";
+            body += "playlistlength: " + std::to_string(this->queue.size()) + "\n";
+            body += string("state: ") + (this->playing ? "play" : "stop") + "\n";
+            if (!this->queue.empty()) {
+                body += "song: 0\nsongid: 1\n";
+            }
+            if (this->playing) {
+                body += "elapsed: 12.345\nbitrate: 320\naudio: 44100:16:2\n";
+            }
+        } else if (cmd == "currentsong") {
+            if (!this->queue.empty()) {
+                body = "file: " + this->queue[0] + "\n";
+                body += "Title: " + string(this->cfg.title_size, 't') + "\n";
+                body += "Name: Fake Radio\nPos: 0\nId: 1\n";
+            }
+        } else if (cmd == "playlistinfo") {
+            size_t start = 0;
+            size_t end = this->queue.size();
+            if (line.length() > 13) {
+                sscanf(line.c_str() + 13, "%zu:%zu", &start, &end);
+            }
+            if ((start > this->queue.size()) || (start > end)) {
+                body = "ACK [2@" + std::to_string(list_num) + "] {playlistinfo} Bad song index\n";
+                return false;
+            }
+            end = end < this->queue.size() ? end : this->queue.size();
+            for (size_t i = start; i < end; ++i) {
+                body += "file: " + this->queue[i] + "\n";
+                body += "Title: " + string(this->cfg.title_size, 't') + "\n";
+                body += "Pos: " + std::to_string(i) + "\nId: " + std::to_string(i + 1) + "\n";
+            }
+        } else if (cmd == "list") {
+            string tag = line.substr(5, line.find(' ', 5) == string::npos ? string::npos : line.find(' ', 5) - 5);
+            for (size_t i = 0; i < this->cfg.library_size; ++i) {
+                body += tag + ": " + tag + " " + std::to_string(i) + "\n";
+            }
+        } else if ((cmd == "find") || (cmd == "search")) {
+            size_t start = 0;
+            size_t end = this->cfg.library_size;
+            auto w = line.find(" window ");
+            if (w != string::npos) {
+                sscanf(line.c_str() + w + 8, "%zu:%zu", &start, &end);
+            }
+            end = end < this->cfg.library_size ? end : this->cfg.library_size;
+            for (size_t i = start; i < end; ++i) {
+                body += "file: music/song " + std::to_string(i) + ".flac\n";
+                body += "Title: Song " + std::to_string(i) + "\n";
+            }
+        } else if (cmd == "play") {
+            if (this->queue.empty()) {
+                body = "ACK [2@" + std::to_string(list_num) + "] {play} Bad song index\n";
+                return false;
+            }
+            this->playing = true;
+            this->changed(1);
+        } else if (cmd == "stop") {
+            this->playing = false;
+            this->changed(1);
+        } else if (cmd == "clear") {
+            this->queue.clear();
+            this->playing = false;
+            this->playlist_version++;
+            this->changed(1 | 4);
+        } else if (cmd == "add") {
+            string uri = line.length() > 4 ? line.substr(4) : "";
+            if ((uri.length() >= 2) && (uri[0] == '"')) {
+                uri = uri.substr(1, uri.length() - 2);
+            }
+            this->queue.push_back(uri);
+            this->playlist_version++;
+            this->changed(4);
+        } else if (cmd == "binarylimit") {
+            this->binary_limit = std::stoul(line.substr(12));
+        } else if (cmd == "readpicture") {
+            if (this->cfg.picture_size > 0) {
+                size_t offset = std::stoul(line.substr(line.rfind(' ') + 1));
+                size_t n = this->cfg.picture_size - offset;
+                n = n < this->binary_limit ? n : this->binary_limit;
+                body = "size: " + std::to_string(this->cfg.picture_size) + "\ntype: image/jpeg\n";
+                body += "binary: " + std::to_string(n) + "\n";
+                for (size_t i = 0; i < n; ++i) {
+                    body += (char)((offset + i) & 0xff);
+                }
+                body += "\n";
+            }
+        } else if (cmd == "albumart") {
+            body = "ACK [50@" + std::to_string(list_num) + "] {albumart} No file exists\n";
+            return false;
+        } else {
+            body = "ACK [5@" + std::to_string(list_num) + "] {" + cmd + "} unknown command \"" + cmd + "\"\n";
+            return false;
+        }
+        return true;
+    }
+    void process_line(const string& line)
+    {
+        if (this->in_list) {
+            if (line == "command_list_end") {
+                this->in_list = false;
+                ++this->requests;
+                string result;
+                int num = 0;
+                for (auto& l : this->list) {
+                    string body;
+                    bool ok = this->execute(l, num++, body);
+                    result += body;
+                    if (!ok) {
+                        this->reply(result);
+                        return;
+                    }
+                    if (this->list_ok) {
+                        result += "list_OK\n";
+                    }
+                }
+                this->reply(result + "OK\n");
+            } else {
+                this->list.push_back(line);
+            }
+            return;
+        }
+        if ((line == "command_list_begin") || (line == "command_list_ok_begin")) {
+            this->in_list = true;
+            this->list_ok = (line == "command_list_ok_begin");
+            this->list.clear();
+            return;
+        }
+        ++this->requests;
+        string cmd = command_name(line);
+        if (cmd == "idle") {
+            if (this->pending_changes != 0) {
+                this->reply(this->idle_changes() + "OK\n");
+            } else {
+                this->idling = true;
+            }
+            return;
+        }
+        if (cmd == "noidle") {
+            if (this->idling) {
+                this->idling = false;
+                this->reply("OK\n");
+            }
+            return;
+        }
+        string body;
+        if (this->execute(line, 0, body)) {
+            body += "OK\n";
+        }
+        this->reply(body);
+    }
+
+public:
+    FakeMpdServer(const FAKE_MPD_CFG& cfg)
+        : cfg(cfg)
+        , is_connected(false)
+        , out_pos(0)
+        , ready_at(0)
+        , in_list(false)
+        , list_ok(false)
+        , idling(false)
+        , pending_changes(0)
+        , playing(false)
+        , playlist_version(1)
+        , binary_limit(8192)
+    {
+        this->ResetStats();
+    }
+
+    bool connect(const char*, uint16_t) override
+    {
+        this->is_connected = true;
+        this->in.clear();
+        this->out.clear();
+        this->out_pos = 0;
+        this->in_list = false;
+        this->idling = false;
+        // TCP handshake plus greeting
+        this->ready_at = mpd_millis() + this->cfg.rtt_ms;
+        this->out = "OK MPD 0.23.5\n";
+        return true;
+    }
+    void stop() override
+    {
+        this->is_connected = false;
+    }
+    bool connected() override
+    {
+        return this->is_connected;
+    }
+    int available() override
+    {
+        if (!this->is_connected || (mpd_millis() < this->ready_at)) {
+            return 0;
+        }
+        size_t n = this->out.length() - this->out_pos;
+        if ((this->cfg.segment_size > 0) && (n > this->cfg.segment_size)) {
+            n = this->cfg.segment_size;
+        }
+        return (int)n;
+    }
+    int read(uint8_t* buf, size_t size) override
+    {
+        size_t n = (size_t)this->available();
+        n = n < size ? n : size;
+        memcpy(buf, this->out.data() + this->out_pos, n);
+        this->out_pos += n;
+        this->bytes_out += n;
+        return (int)n;
+    }
+    size_t write(const uint8_t* buf, size_t size) override
+    {
+        if (!this->is_connected) {
+            return 0;
+        }
+        this->bytes_in += size;
+        this->in.append((const char*)buf, size);
+        size_t p;
+        while ((p = this->in.find('\n')) != string::npos) {
+            string line = this->in.substr(0, p);
+            this->in.erase(0, p + 1);
+            this->process_line(line);
+        }
+        return size;
+    }
+    void wait_for_data(uint32_t timeout_ms) override
+    {
+        uint32_t now = mpd_millis();
+        if ((this->out_pos < this->out.length()) && (this->ready_at > now)) {
+            uint32_t wait = this->ready_at - now;
+            sleep_ms(wait < timeout_ms ? wait : timeout_ms);
+        } else if (this->out_pos >= this->out.length()) {
+            // nothing pending: a real socket would block for the whole timeout
+            sleep_ms(timeout_ms);
+        }
+    }
+
+    // simulate a change made by another client, e.g. to wake up idle
+    void external_change(bool start_playing)
+    {
+        this->playing = start_playing;
+        this->changed(1);
+    }
+    void ResetStats()
+    {
+        this->requests = 0;
+        this->bytes_in = 0;
+        this->bytes_out = 0;
+    }
+    // number of request/response exchanges (a command list counts as one)
+    uint32_t GetRequests()
+    {
+        return this->requests;
+    }
+    uint32_t GetBytesIn()
+    {
+        return this->bytes_in;
+    }
+    uint32_t GetBytesOut()
+    {
+        return this->bytes_out;
+    }
+};
@@ -0,0 +1,53 @@
+// Copyright (c) 2023 @dheijl (danny.heijl@telenet.be)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include <Arduino.h>
+
+#include "config.h"
+#include "mpdresponse.h"
+
+///
+/// an operation on one player, run in its own task so that all players are handled
+/// concurrently and a dead player only costs its own timeout
+///
+typedef struct player_job {
+    const MPD_PLAYER* player;
+    uint32_t timeout_ms;
+    const char* url; // NULL: get status, otherwise clear/add/play this url
+    // results
+    bool connected;
+    bool ok;
+    MPD_STATUS_DATA status;
+    char title[64];
+    uint32_t play_us; // when the play command list was sent
+    // internal
+    EventGroupHandle_t events;
+    EventBits_t done_bit;
+    EventBits_t ready_bit;
+} PLAYER_JOB;
+
+static const int MAX_PLAYER_JOBS = 11;
+
+///
+/// run the jobs in parallel and wait until all of them have finished.
+/// play jobs first connect, and then all send their command list at the same moment.
+///
+void run_player_jobs(PLAYER_JOB* jobs, int njobs);
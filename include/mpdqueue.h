@@ -0,0 +1,115 @@
+// Copyright (c) 2023 @dheijl (danny.heijl@telenet.be)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#include "mpdresponse.h"
+
+// queue entries per screen, leaves room for the previous/next/return lines
+static const int QUEUE_PAGE_SIZE = 16;
+static const int QUEUE_CACHE_PAGES = 4;
+
+typedef struct mpd_queue_page {
+    int page; // -1: unused
+    int count;
+    uint32_t last_used;
+    MPD_QUEUE_ENTRY entries[QUEUE_PAGE_SIZE];
+} MPD_QUEUE_PAGE;
+
+///
+/// small LRU cache of queue pages, valid for one MPD playlist version
+///
+class MpdQueueCache {
+private:
+    MPD_QUEUE_PAGE pages[QUEUE_CACHE_PAGES];
+    uint32_t version;
+    uint32_t length;
+    uint32_t tick;
+
+public:
+    MpdQueueCache()
+        : version(0)
+        , length(0)
+        , tick(0)
+    {
+        this->invalidate();
+    }
+    void invalidate()
+    {
+        for (auto& p : this->pages) {
+            p.page = -1;
+            p.count = 0;
+            p.last_used = 0;
+        }
+    }
+    // the playlist version from status: any change makes all cached pages stale,
+    // except the page that was fetched together with this status
+    void set_version(uint32_t new_version, uint32_t new_length, MPD_QUEUE_PAGE* keep = NULL)
+    {
+        if (new_version != this->version) {
+            for (auto& p : this->pages) {
+                if (&p != keep) {
+                    p.page = -1;
+                    p.count = 0;
+                }
+            }
+            this->version = new_version;
+        }
+        this->length = new_length;
+    }
+    uint32_t get_version()
+    {
+        return this->version;
+    }
+    uint32_t get_length()
+    {
+        return this->length;
+    }
+    MPD_QUEUE_PAGE* find(int page)
+    {
+        for (auto& p : this->pages) {
+            if (p.page == page) {
+                p.last_used = ++this->tick;
+                return &p;
+            }
+        }
+        return NULL;
+    }
+    // a free or least recently used slot for a page that is about to be fetched
+    MPD_QUEUE_PAGE* slot(int page)
+    {
+        MPD_QUEUE_PAGE* lru = &this->pages[0];
+        for (auto& p : this->pages) {
+            if (p.page < 0) {
+                lru = &p;
+                break;
+            }
+            if (p.last_used < lru->last_used) {
+                lru = &p;
+            }
+        }
+        lru->page = page;
+        lru->count = 0;
+        lru->last_used = ++this->tick;
+        return lru;
+    }
+};
@@ -0,0 +1,425 @@
+// Copyright (c) 2023 @dheijl (danny.heijl@telenet.be)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "mpdconnection.h"
+#include "mpdsession.h"
+#include "mpdtransport.h"
+
+using std::string;
+using std::vector;
+
+///
+/// session file: "MPDREC1\n", then records of
+/// type (1 byte), ms since the start of the recording (4 bytes LE), length (4 bytes LE), data
+///
+static const char MPD_REC_MAGIC[] = "MPDREC1\n";
+
+typedef enum {
+    MpdRecConnect = 'C', // data: "host:port"
+    MpdRecWrite = 'W', // bytes sent to MPD
+    MpdRecRead = 'R', // bytes received from MPD, as the socket returned them
+    MpdRecStop = 'S',
+} MpdRecordType;
+
+typedef struct mpd_record {
+    uint8_t type;
+    uint32_t at_ms;
+    string data;
+} MPD_RECORD;
+
+///
+/// transport decorator that records all traffic of another transport to a session file
+///
+class RecordingTransport : public MpdTransport {
+private:
+    MpdTransport* inner;
+    FILE* out;
+    uint32_t start;
+    bool in_session; // a connect was recorded without its stop
+
+    static void put_u32(uint8_t* p, uint32_t v)
+    {
+        p[0] = v & 0xff;
+        p[1] = (v >> 8) & 0xff;
+        p[2] = (v >> 16) & 0xff;
+        p[3] = (v >> 24) & 0xff;
+    }
+    void record(uint8_t type, const void* data, size_t len)
+    {
+        if (this->out == NULL) {
+            return;
+        }
+        uint8_t header[9];
+        header[0] = type;
+        put_u32(header + 1, mpd_millis() - this->start);
+        put_u32(header + 5, (uint32_t)len);
+        fwrite(header, 1, sizeof(header), this->out);
+        if (len > 0) {
+            fwrite(data, 1, len, this->out);
+        }
+    }
+
+    // one stop per session, the Disconnect() after a failed connect stops again
+    void end_session()
+    {
+        if (this->in_session) {
+            this->record(MpdRecStop, NULL, 0);
+            this->in_session = false;
+        }
+    }
+
+public:
+    RecordingTransport(MpdTransport* inner)
+        : inner(inner)
+        , out(NULL)
+        , start(0)
+        , in_session(false)
+    {
+    }
+    ~RecordingTransport()
+    {
+        this->close();
+    }
+    RecordingTransport(const RecordingTransport&) = delete;
+    RecordingTransport& operator=(const RecordingTransport&) = delete;
+
+    // append to a session file, a new file gets the magic first
+    bool open(const char* path)
+    {
+        this->close();
+        this->out = fopen(path, "ab");
+        if (this->out == NULL) {
+            return false;
+        }
+        if (ftell(this->out) == 0) {
+            fwrite(MPD_REC_MAGIC, 1, sizeof(MPD_REC_MAGIC) - 1, this->out);
+        }
+        this->start = mpd_millis();
+        return true;
+    }
+    bool is_open()
+    {
+        return this->out != NULL;
+    }
+    void close()
+    {
+        if (this->out != NULL) {
+            fclose(this->out);
+            this->out = NULL;
+        }
+    }
+
+    bool connect(const char* host, uint16_t port) override
+    {
+        string target = string(host) + ":" + std::to_string(port);
+        this->record(MpdRecConnect, target.data(), target.length());
+        this->in_session = true;
+        if (!this->inner->connect(host, port)) {
+            this->end_session();
+            return false;
+        }
+        return true;
+    }
+    void stop() override
+    {
+        this->end_session();
+        // a session must survive a power off right after it
+        if (this->out != NULL) {
+            fflush(this->out);
+        }
+        this->inner->stop();
+    }
+    bool connected() override
+    {
+        return this->inner->connected();
+    }
+    int available() override
+    {
+        return this->inner->available();
+    }
+    int read(uint8_t* buf, size_t size) override
+    {
+        int n = this->inner->read(buf, size);
+        if (n > 0) {
+            this->record(MpdRecRead, buf, n);
+        }
+        return n;
+    }
+    size_t write(const uint8_t* buf, size_t size) override
+    {
+        size_t n = this->inner->write(buf, size);
+        if (n > 0) {
+            this->record(MpdRecWrite, buf, n);
+        }
+        return n;
+    }
+    void wait_for_data(uint32_t timeout_ms) override
+    {
+        this->inner->wait_for_data(timeout_ms);
+    }
+    void set_connect_timeout(uint32_t timeout_ms) override
+    {
+        this->inner->set_connect_timeout(timeout_ms);
+    }
+};
+
+///
+/// plays back a recorded session as the MPD peer, as fast as possible: replies
+/// become available as soon as the requests before them have been written
+///
+class ReplayTransport : public MpdTransport {
+private:
+    vector<MPD_RECORD> records;
+    size_t next;
+    size_t pos; // in the data of records[next]
+    bool is_connected;
+    uint32_t mismatches;
+
+    static uint32_t get_u32(const uint8_t* p)
+    {
+        return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+    }
+    bool at(uint8_t type)
+    {
+        return (this->next < this->records.size()) && (this->records[this->next].type == type);
+    }
+    void advance()
+    {
+        ++this->next;
+        this->pos = 0;
+    }
+
+public:
+    ReplayTransport()
+        : next(0)
+        , pos(0)
+        , is_connected(false)
+        , mismatches(0)
+    {
+    }
+
+    bool load(FILE* in)
+    {
+        this->records.clear();
+        this->next = 0;
+        this->pos = 0;
+        char magic[sizeof(MPD_REC_MAGIC) - 1];
+        if ((fread(magic, 1, sizeof(magic), in) != sizeof(magic)) || (memcmp(magic, MPD_REC_MAGIC, sizeof(magic)) != 0)) {
+            return false;
+        }
+        uint8_t header[9];
+        while (fread(header, 1, sizeof(header), in) == sizeof(header)) {
+            MPD_RECORD rec;
+            rec.type = header[0];
+            rec.at_ms = get_u32(header + 1);
+            rec.data.resize(get_u32(header + 5));
+            if ((rec.data.length() > 0) && (fread(&rec.data[0], 1, rec.data.length(), in) != rec.data.length())) {
+                // truncated by a power off during recording
+                break;
+            }
+            this->records.push_back(rec);
+        }
+        return true;
+    }
+    const vector<MPD_RECORD>& get_records()
+    {
+        return this->records;
+    }
+    // number of connects left to replay
+    size_t sessions_left()
+    {
+        size_t n = 0;
+        for (size_t i = this->next; i < this->records.size(); ++i) {
+            if (this->records[i].type == MpdRecConnect) {
+                ++n;
+            }
+        }
+        return n;
+    }
+    // the recorded "host:port" of the next session, "" if there is none
+    string next_target()
+    {
+        for (size_t i = this->next; i < this->records.size(); ++i) {
+            if (this->records[i].type == MpdRecConnect) {
+                return this->records[i].data;
+            }
+        }
+        return string();
+    }
+    // sessions where the client wrote something else than was recorded
+    uint32_t get_mismatches()
+    {
+        return this->mismatches;
+    }
+
+    // the recorded target is not checked, replays may run anywhere
+    bool connect(const char*, uint16_t) override
+    {
+        while ((this->next < this->records.size()) && !this->at(MpdRecConnect)) {
+            this->advance();
+        }
+        if (!this->at(MpdRecConnect)) {
+            return false;
+        }
+        this->advance();
+        // a recorded connect failure
+        this->is_connected = !this->at(MpdRecStop);
+        return this->is_connected;
+    }
+    void stop() override
+    {
+        this->is_connected = false;
+        while ((this->next < this->records.size()) && !this->at(MpdRecConnect)) {
+            this->advance();
+        }
+    }
+    bool connected() override
+    {
+        return this->is_connected && (this->at(MpdRecRead) || this->at(MpdRecWrite));
+    }
+    int available() override
+    {
+        if (!this->is_connected || !this->at(MpdRecRead)) {
+            return 0;
+        }
+        return (int)(this->records[this->next].data.length() - this->pos);
+    }
+    int read(uint8_t* buf, size_t size) override
+    {
+        size_t n = (size_t)this->available();
+        n = n < size ? n : size;
+        if (n > 0) {
+            memcpy(buf, this->records[this->next].data.data() + this->pos, n);
+            this->pos += n;
+            if (this->pos == this->records[this->next].data.length()) {
+                this->advance();
+            }
+        }
+        return (int)n;
+    }
+    size_t write(const uint8_t* buf, size_t size) override
+    {
+        if (!this->is_connected) {
+            return 0;
+        }
+        size_t done = 0;
+        while ((done < size) && this->at(MpdRecWrite)) {
+            auto& data = this->records[this->next].data;
+            size_t n = data.length() - this->pos;
+            n = n < (size - done) ? n : (size - done);
+            if (memcmp(data.data() + this->pos, buf + done, n) != 0) {
+                break;
+            }
+            this->pos += n;
+            done += n;
+            if (this->pos == data.length()) {
+                this->advance();
+            }
+        }
+        if (done < size) {
+            // the client diverged from the recording: end this session instead of
+            // letting it wait for replies that will never come
+            ++this->mismatches;
+            this->is_connected = false;
+        }
+        return size;
+    }
+    void wait_for_data(uint32_t) override
+    {
+    }
+};
+
+// heap allocations so far, e.g. from a counting operator new in a native test
+typedef size_t (*MpdAllocationCount)();
+
+typedef struct mpd_replay_report {
+    uint32_t sessions;
+    uint32_t elapsed_us; // decoding and client logic only, the network is not replayed
+    uint32_t recorded_ms; // what the same sessions took on the wire
+    uint32_t allocations; // heap allocations of all sessions, 0 if they are not counted
+    MPD_STATS stats; // wire statistics of the last session
+    uint32_t mismatches;
+    MpdStatusLines lines; // of every session, as the status screen shows them
+} MPD_REPLAY_REPORT;
+
+///
+/// replay a session file of status reads (one "status" + "currentsong" command list
+/// per connect, as on every wake) through the MpdSession status sequence of
+/// show_mpd_status()
+///
+inline bool replay_status_sessions(FILE* in, MPD_REPLAY_REPORT& report, MpdAllocationCount allocations = NULL)
+{
+    ReplayTransport replay;
+    if (!replay.load(in)) {
+        return false;
+    }
+    memset(&report.stats, 0, sizeof(report.stats));
+    report.sessions = 0;
+    report.elapsed_us = 0;
+    report.recorded_ms = 0;
+    report.allocations = 0;
+    report.lines.clear();
+    auto& records = replay.get_records();
+    const MPD_RECORD* session_start = NULL;
+    for (auto& rec : records) {
+        if (rec.type == MpdRecConnect) {
+            session_start = &rec;
+        } else if ((rec.type == MpdRecStop) && (session_start != NULL)) {
+            // from the connect of this session to its first stop
+            report.recorded_ms += rec.at_ms - session_start->at_ms;
+            session_start = NULL;
+        }
+    }
+    MpdConnection con(&replay);
+    MpdSession session(con);
+    while (replay.sessions_left() > 0) {
+        // the recorded target, so that the lines are the ones the device showed
+        string target = replay.next_target();
+        size_t colon = target.rfind(':');
+        string host = target.substr(0, colon);
+        uint16_t port = colon != string::npos ? (uint16_t)atoi(target.c_str() + colon + 1) : 0;
+        MpdStatusLines response;
+        MpdStatusLines shown;
+        size_t allocated = allocations != NULL ? allocations() : 0;
+        uint32_t start = mpd_micros();
+        session.begin_op();
+        if (session.open(host.c_str(), port)) {
+            session.status(response);
+        } else {
+            con.Disconnect();
+        }
+        MpdSession::format(response, shown);
+        report.stats = session.end_op();
+        report.elapsed_us += mpd_micros() - start;
+        if (allocations != NULL) {
+            report.allocations += allocations() - allocated;
+        }
+        report.lines.insert(report.lines.end(), shown.begin(), shown.end());
+        ++report.sessions;
+    }
+    report.mismatches = replay.get_mismatches();
+    return true;
+}
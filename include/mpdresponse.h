@@ -0,0 +1,633 @@
+// Copyright (c) 2023 @dheijl (danny.heijl@telenet.be)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <strings.h>
+
+// MPD replies are decoded in place: the receive buffer is split into lines and
+// key/value spans, and only the keys we know about are copied into the fixed
+// fields of the typed responses below. No heap allocation takes place.
+
+enum MpdResponseType {
+    MpdOKType,
+    MpdACKType,
+    MpdErrorType,
+};
+
+enum MpdResponseKind {
+    MpdUninitializedKind,
+    MpdConnectKind,
+    MpdCurrentSongKind,
+    MpdStatusKind,
+    MpdCommandType,
+    MpdFailureKind,
+};
+
+enum MpdPlayState {
+    MpdStateUnknown,
+    MpdStatePlay,
+    MpdStatePause,
+    MpdStateStop,
+};
+
+// subsystems reported by "idle"
+enum MpdIdleEvent {
+    MpdIdleNone = 0,
+    MpdIdlePlayer = 1,
+    MpdIdleMixer = 2,
+    MpdIdlePlaylist = 4,
+    MpdIdleOptions = 8,
+    MpdIdleOther = 16,
+};
+
+///
+/// non-owning view on a part of the receive buffer
+///
+struct MpdSpan {
+    const char* ptr;
+    size_t len;
+
+    // MPD keys are case sensitive, but we match them case insensitive as before
+    bool equals(const char* s) const
+    {
+        return (strlen(s) == this->len) && (strncasecmp(this->ptr, s, this->len) == 0);
+    }
+    bool starts_with(const char* s) const
+    {
+        size_t n = strlen(s);
+        return (n <= this->len) && (strncmp(this->ptr, s, n) == 0);
+    }
+    // copy into a fixed size field, truncating if needed
+    void copy_to(char* dst, size_t size) const
+    {
+        size_t n = this->len < size - 1 ? this->len : size - 1;
+        memcpy(dst, this->ptr, n);
+        dst[n] = '\0';
+    }
+    long to_long() const
+    {
+        long result = 0;
+        size_t i = 0;
+        bool negative = (this->len > 0) && (this->ptr[0] == '-');
+        if (negative) {
+            ++i;
+        }
+        for (; i < this->len && this->ptr[i] >= '0' && this->ptr[i] <= '9'; ++i) {
+            result = (result * 10) + (this->ptr[i] - '0');
+        }
+        return negative ? -result : result;
+    }
+    float to_float() const
+    {
+        float result = 0.0f;
+        size_t i = 0;
+        for (; i < this->len && this->ptr[i] >= '0' && this->ptr[i] <= '9'; ++i) {
+            result = (result * 10.0f) + (float)(this->ptr[i] - '0');
+        }
+        if (i < this->len && this->ptr[i] == '.') {
+            float scale = 0.1f;
+            for (++i; i < this->len && this->ptr[i] >= '0' && this->ptr[i] <= '9'; ++i) {
+                result += (float)(this->ptr[i] - '0') * scale;
+                scale *= 0.1f;
+            }
+        }
+        return result;
+    }
+};
+
+///
+/// splits a reply into lines without copying
+///
+class MpdLineReader {
+private:
+    const char* pos;
+    const char* end;
+
+public:
+    MpdLineReader(const char* data, size_t len)
+        : pos(data)
+        , end(data + len)
+    {
+    }
+    bool next(MpdSpan& line)
+    {
+        if (this->pos >= this->end) {
+            return false;
+        }
+        auto nl = (const char*)memchr(this->pos, '\n', this->end - this->pos);
+        line.ptr = this->pos;
+        if (nl == NULL) {
+            line.len = this->end - this->pos;
+            this->pos = this->end;
+        } else {
+            line.len = nl - this->pos;
+            this->pos = nl + 1;
+        }
+        return true;
+    }
+};
+
+class MpdResponse {
+private:
+    MpdResponseType ResponseType;
+
+protected:
+    MpdResponseKind ResponseKind;
+    // called for every "key: value" line of the reply
+    virtual void set_item(const MpdSpan&, const MpdSpan&) { }
+    // called for the terminating "OK ..." or "list_OK" line
+    virtual void set_ok(const MpdSpan&) { }
+    void parse(const char* data, size_t len)
+    {
+        this->ResponseType = MpdErrorType;
+        MpdLineReader reader(data, len);
+        MpdSpan line;
+        while (reader.next(line)) {
+            if (this->feed_line(line)) {
+                return;
+            }
+        }
+    }
+
+public:
+    MpdResponse()
+        : ResponseType(MpdErrorType)
+        , ResponseKind(MpdUninitializedKind)
+    {
+    }
+    virtual ~MpdResponse() { }
+    ///
+    /// decode a single line, returns true once the terminating OK or ACK line is seen.
+    /// used directly to decode a reply while it is being received.
+    ///
+    bool feed_line(const MpdSpan& line)
+    {
+        if (line.starts_with("ACK")) {
+            this->ResponseType = MpdACKType;
+            return true;
+        }
+        if (line.starts_with("OK") || line.equals("list_OK")) {
+            this->ResponseType = MpdOKType;
+            this->set_ok(line);
+            return true;
+        }
+        auto sep = (const char*)memchr(line.ptr, ':', line.len);
+        if ((sep != NULL) && ((size_t)(sep - line.ptr) + 1 < line.len) && (sep[1] == ' ')) {
+            MpdSpan key { line.ptr, (size_t)(sep - line.ptr) };
+            MpdSpan value { sep + 2, line.len - key.len - 2 };
+            this->set_item(key, value);
+        }
+        return false;
+    }
+    MpdResponseType getResponseType()
+    {
+        return this->ResponseType;
+    }
+    MpdResponseKind getResponseKind()
+    {
+        return this->ResponseKind;
+    }
+};
+
+class MpdConnect : public MpdResponse {
+private:
+    char Version[24];
+    void set_ok(const MpdSpan& line) override
+    {
+        // greeting: "OK MPD 0.23.5"
+        static const constexpr char* prefix = "OK MPD ";
+        if (line.starts_with(prefix)) {
+            MpdSpan v { line.ptr + strlen(prefix), line.len - strlen(prefix) };
+            v.copy_to(this->Version, sizeof(this->Version));
+        }
+    }
+
+public:
+    MpdConnect(const char* data, size_t len)
+    {
+        this->Version[0] = '\0';
+        this->parse(data, len);
+        this->ResponseKind = MpdConnectKind;
+    }
+    const char* getVersion()
+    {
+        return this->Version;
+    }
+};
+
+typedef struct mpd_song_data {
+    char file[256];
+    char title[128];
+    char artist[128];
+    char albumartist[128];
+    char name[128];
+    char album[128];
+} MPD_SONG_DATA;
+
+class MpdCurrentSong : public MpdResponse {
+private:
+    MPD_SONG_DATA song;
+    void set_item(const MpdSpan& key, const MpdSpan& value) override
+    {
+        if (key.equals("file")) {
+            value.copy_to(this->song.file, sizeof(this->song.file));
+        } else if (key.equals("Title")) {
+            value.copy_to(this->song.title, sizeof(this->song.title));
+        } else if (key.equals("Artist")) {
+            value.copy_to(this->song.artist, sizeof(this->song.artist));
+        } else if (key.equals("AlbumArtist")) {
+            value.copy_to(this->song.albumartist, sizeof(this->song.albumartist));
+        } else if (key.equals("Name")) {
+            value.copy_to(this->song.name, sizeof(this->song.name));
+        } else if (key.equals("Album")) {
+            value.copy_to(this->song.album, sizeof(this->song.album));
+        }
+    }
+
+public:
+    MpdCurrentSong(const char* data, size_t len)
+    {
+        memset(&this->song, 0, sizeof(this->song));
+        this->parse(data, len);
+        if (this->getResponseType() == MpdOKType) {
+            this->ResponseKind = MpdCurrentSongKind;
+        } else {
+            this->ResponseKind = MpdFailureKind;
+        }
+    }
+    const MPD_SONG_DATA& getSong()
+    {
+        return this->song;
+    }
+    const char* getFile()
+    {
+        return this->song.file;
+    }
+    const char* getName()
+    {
+        return this->song.name;
+    }
+    const char* getTitle()
+    {
+        return this->song.title;
+    }
+    const char* getArtist()
+    {
+        return this->song.artist[0] != '\0' ? this->song.artist : this->song.albumartist;
+    }
+    const char* getAlbum()
+    {
+        return this->song.album;
+    }
+};
+
+typedef struct mpd_status_data {
+    MpdPlayState state;
+    float elapsed;
+    float duration;
+    uint32_t songid;
+    int32_t song;
+    uint32_t playlist;
+    uint32_t playlistlength;
+    int16_t volume;
+    uint16_t bitrate;
+    char audio[32];
+    char error[128];
+} MPD_STATUS_DATA;
+
+class MpdStatus : public MpdResponse {
+private:
+    MPD_STATUS_DATA status;
+    void set_item(const MpdSpan& key, const MpdSpan& value) override
+    {
+        if (key.equals("state")) {
+            if (value.equals("play")) {
+                this->status.state = MpdStatePlay;
+            } else if (value.equals("pause")) {
+                this->status.state = MpdStatePause;
+            } else if (value.equals("stop")) {
+                this->status.state = MpdStateStop;
+            }
+        } else if (key.equals("elapsed")) {
+            this->status.elapsed = value.to_float();
+        } else if (key.equals("duration")) {
+            this->status.duration = value.to_float();
+        } else if (key.equals("audio")) {
+            value.copy_to(this->status.audio, sizeof(this->status.audio));
+        } else if (key.equals("error")) {
+            value.copy_to(this->status.error, sizeof(this->status.error));
+        } else if (key.equals("songid")) {
+            this->status.songid = (uint32_t)value.to_long();
+        } else if (key.equals("song")) {
+            this->status.song = (int32_t)value.to_long();
+        } else if (key.equals("playlist")) {
+            this->status.playlist = (uint32_t)value.to_long();
+        } else if (key.equals("playlistlength")) {
+            this->status.playlistlength = (uint32_t)value.to_long();
+        } else if (key.equals("volume")) {
+            this->status.volume = (int16_t)value.to_long();
+        } else if (key.equals("bitrate")) {
+            this->status.bitrate = (uint16_t)value.to_long();
+        }
+    }
+
+public:
+    MpdStatus(const char* data, size_t len)
+    {
+        memset(&this->status, 0, sizeof(this->status));
+        this->status.state = MpdStateUnknown;
+        this->status.song = -1;
+        this->status.volume = -1;
+        this->parse(data, len);
+        if (this->getResponseType() == MpdOKType) {
+            this->ResponseKind = MpdStatusKind;
+        } else {
+            this->ResponseKind = MpdFailureKind;
+        }
+    }
+    const MPD_STATUS_DATA& getStatus()
+    {
+        return this->status;
+    }
+    MpdPlayState getState()
+    {
+        return this->status.state;
+    }
+    bool isPlaying()
+    {
+        return this->status.state == MpdStatePlay;
+    }
+    // the "state" value as MPD sent it, empty if there was none
+    const char* getStateName()
+    {
+        switch (this->status.state) {
+        case MpdStatePlay:
+            return "play";
+        case MpdStatePause:
+            return "pause";
+        case MpdStateStop:
+            return "stop";
+        default:
+            return "";
+        }
+    }
+    float getElapsed()
+    {
+        return this->status.elapsed;
+    }
+    float getDuration()
+    {
+        return this->status.duration;
+    }
+    const char* getFormat()
+    {
+        return this->status.audio;
+    }
+    const char* getError()
+    {
+        return this->status.error;
+    }
+};
+
+class MpdSimpleCommand : public MpdResponse {
+public:
+    MpdSimpleCommand(const char* data, size_t len)
+    {
+        this->parse(data, len);
+        if (this->getResponseType() == MpdOKType) {
+            this->ResponseKind = MpdCommandType;
+        } else {
+            this->ResponseKind = MpdFailureKind;
+        }
+    }
+    const char* GetResult()
+    {
+        return this->getResponseType() == MpdOKType ? "OK" : "ERROR ";
+    }
+};
+
+class MpdIdle : public MpdResponse {
+private:
+    int changed;
+    void set_item(const MpdSpan& key, const MpdSpan& value) override
+    {
+        if (!key.equals("changed")) {
+            return;
+        }
+        if (value.equals("player")) {
+            this->changed |= MpdIdlePlayer;
+        } else if (value.equals("mixer")) {
+            this->changed |= MpdIdleMixer;
+        } else if (value.equals("playlist")) {
+            this->changed |= MpdIdlePlaylist;
+        } else if (value.equals("options")) {
+            this->changed |= MpdIdleOptions;
+        } else {
+            this->changed |= MpdIdleOther;
+        }
+    }
+
+public:
+    MpdIdle(const char* data, size_t len)
+        : changed(MpdIdleNone)
+    {
+        this->parse(data, len);
+        if (this->getResponseType() == MpdOKType) {
+            this->ResponseKind = MpdCommandType;
+        } else {
+            this->ResponseKind = MpdFailureKind;
+        }
+    }
+    // bitmask of MpdIdleEvent
+    int getChanged()
+    {
+        return this->changed;
+    }
+};
+
+typedef struct mpd_queue_entry {
+    uint32_t pos;
+    uint32_t id;
+    char title[64];
+} MPD_QUEUE_ENTRY;
+
+///
+/// "playlistinfo start:end" reply, decoded into a caller supplied array of entries
+///
+class MpdQueueInfo : public MpdResponse {
+private:
+    MPD_QUEUE_ENTRY* entries;
+    int capacity;
+    int count;
+    bool has_title;
+    bool skipping;
+    void set_item(const MpdSpan& key, const MpdSpan& value) override
+    {
+        // every song starts with its file
+        if (key.equals("file")) {
+            if (this->count >= this->capacity) {
+                this->skipping = true;
+                return;
+            }
+            auto e = &this->entries[this->count++];
+            memset(e, 0, sizeof(*e));
+            // the file name is the fallback title: keep the tail of the path or url
+            size_t n = value.len < sizeof(e->title) - 1 ? value.len : sizeof(e->title) - 1;
+            MpdSpan tail { value.ptr + value.len - n, n };
+            tail.copy_to(e->title, sizeof(e->title));
+            this->has_title = false;
+            return;
+        }
+        if ((this->count == 0) || this->skipping) {
+            return;
+        }
+        auto e = &this->entries[this->count - 1];
+        if (key.equals("Pos")) {
+            e->pos = (uint32_t)value.to_long();
+        } else if (key.equals("Id")) {
+            e->id = (uint32_t)value.to_long();
+        } else if (key.equals("Title")) {
+            value.copy_to(e->title, sizeof(e->title));
+            this->has_title = true;
+        } else if (key.equals("Name") && !this->has_title) {
+            value.copy_to(e->title, sizeof(e->title));
+        }
+    }
+
+public:
+    MpdQueueInfo(const char* data, size_t len, MPD_QUEUE_ENTRY* entries, int capacity)
+        : entries(entries)
+        , capacity(capacity)
+        , count(0)
+        , has_title(false)
+        , skipping(false)
+    {
+        this->parse(data, len);
+        if (this->getResponseType() == MpdOKType) {
+            this->ResponseKind = MpdCommandType;
+        } else {
+            this->ResponseKind = MpdFailureKind;
+        }
+    }
+    int getCount()
+    {
+        return this->count;
+    }
+};
+
+static const int LIBRARY_PAGE_SIZE = 16;
+
+typedef struct mpd_library_entry {
+    char name[64]; // for display only, may be truncated
+    char uri[192]; // the file, or the full tag value of a list entry to query with
+} MPD_LIBRARY_ENTRY;
+
+typedef struct mpd_library_page {
+    uint32_t offset;
+    int count;
+    bool more;
+    MPD_LIBRARY_ENTRY entries[LIBRARY_PAGE_SIZE];
+} MPD_LIBRARY_PAGE;
+
+///
+/// "list", "find" and "search" replies, decoded line by line while they stream in.
+/// only the entries [skip, skip + LIBRARY_PAGE_SIZE) are kept, so memory use does not
+/// depend on the size of the result.
+///
+class MpdLibraryList : public MpdResponse {
+private:
+    MPD_LIBRARY_PAGE* page;
+    bool songs;
+    uint32_t skip;
+    uint32_t index;
+    bool has_title;
+    MPD_LIBRARY_ENTRY* current()
+    {
+        if ((this->index <= this->skip) || (this->index > this->skip + LIBRARY_PAGE_SIZE)) {
+            return NULL;
+        }
+        return &this->page->entries[this->index - this->skip - 1];
+    }
+    // start a new entry, returns NULL if it is outside the page
+    MPD_LIBRARY_ENTRY* next_entry()
+    {
+        ++this->index;
+        auto e = this->current();
+        if (e != NULL) {
+            memset(e, 0, sizeof(*e));
+            this->page->count++;
+        } else if (this->index > this->skip + LIBRARY_PAGE_SIZE) {
+            this->page->more = true;
+        }
+        return e;
+    }
+    void set_item(const MpdSpan& key, const MpdSpan& value) override
+    {
+        if (!this->songs) {
+            // list: one "Tag: value" line per entry, skip the empty tag value
+            if (value.len > 0) {
+                auto e = this->next_entry();
+                if (e != NULL) {
+                    value.copy_to(e->name, sizeof(e->name));
+                    value.copy_to(e->uri, sizeof(e->uri));
+                }
+            }
+            return;
+        }
+        if (key.equals("file")) {
+            auto e = this->next_entry();
+            if (e != NULL) {
+                value.copy_to(e->uri, sizeof(e->uri));
+                size_t n = value.len < sizeof(e->name) - 1 ? value.len : sizeof(e->name) - 1;
+                MpdSpan tail { value.ptr + value.len - n, n };
+                tail.copy_to(e->name, sizeof(e->name));
+            }
+            this->has_title = false;
+            return;
+        }
+        auto e = this->current();
+        if (e == NULL) {
+            return;
+        }
+        if (key.equals("Title")) {
+            value.copy_to(e->name, sizeof(e->name));
+            this->has_title = true;
+        } else if (key.equals("Name") && !this->has_title) {
+            value.copy_to(e->name, sizeof(e->name));
+        }
+    }
+
+public:
+    // songs: find/search reply (entries start with "file"), otherwise a list reply
+    MpdLibraryList(MPD_LIBRARY_PAGE* page, uint32_t skip, bool songs)
+        : page(page)
+        , songs(songs)
+        , skip(skip)
+        , index(0)
+        , has_title(false)
+    {
+        this->page->count = 0;
+        this->page->more = false;
+        this->ResponseKind = MpdCommandType;
+    }
+};
@@ -0,0 +1,209 @@
+// Copyright (c) 2023 @dheijl (danny.heijl@telenet.be)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+#include <string.h>
+#include <string>
+
+#include "mpdconnection.h"
+
+using std::string;
+
+///
+/// the MPD exchanges of the wake operations, without the Arduino parts (wifi, config,
+/// display), so that MPD_Client and the native benchmarks run the same sequence:
+/// reuse or open the connection, run the commands, collect the response lines, and
+/// close or go back to idle
+///
+class MpdSession {
+private:
+    MpdConnection& con;
+    bool keep_open;
+    string connected_to;
+    MPD_STATS op_stats;
+    uint32_t op_start;
+
+    void append(MpdStatusLines& lines)
+    {
+        auto& response = this->con.GetResponse();
+        lines.insert(lines.end(), response.begin(), response.end());
+    }
+
+public:
+    MpdSession(MpdConnection& con)
+        : con(con)
+        , keep_open(false)
+        , op_start(0)
+    {
+        memset(&this->op_stats, 0, sizeof(this->op_stats));
+    }
+    MpdSession(const MpdSession&) = delete;
+    MpdSession& operator=(const MpdSession&) = delete;
+
+    ///
+    /// on USB power: keep the connection open between operations and idle
+    ///
+    void set_persistent(bool persistent)
+    {
+        this->keep_open = persistent;
+        if (!persistent) {
+            this->con.Disconnect();
+            this->connected_to.clear();
+        }
+    }
+    // the open connection broke, connect again on the next open()
+    void forget()
+    {
+        this->connected_to.clear();
+    }
+
+    void begin_op()
+    {
+        this->con.ResetStats();
+        this->op_start = mpd_millis();
+    }
+    const MPD_STATS& end_op()
+    {
+        this->op_stats = this->con.GetStats();
+        this->op_stats.elapsed_ms = mpd_millis() - this->op_start;
+        return this->op_stats;
+    }
+    // wire statistics of the last operation
+    const MPD_STATS& get_op_stats()
+    {
+        return this->op_stats;
+    }
+
+    ///
+    /// connect to the player, or reuse the open connection in persistent mode
+    ///
+    bool open(const char* ip, uint16_t port)
+    {
+        string target = string(ip) + ":" + std::to_string(port);
+        if (this->keep_open && this->con.IsConnected() && (target == this->connected_to)) {
+            if (this->con.NoIdle()) {
+                return true;
+            }
+        }
+        this->con.Disconnect();
+        this->connected_to.clear();
+        if (this->con.Connect(ip, port)) {
+            this->connected_to = target;
+            return true;
+        }
+        return false;
+    }
+
+    ///
+    /// disconnect, or in persistent mode keep the connection and go back to idle
+    ///
+    void close()
+    {
+        if (this->keep_open) {
+            this->con.Idle();
+        } else {
+            this->con.Disconnect();
+            this->connected_to.clear();
+        }
+    }
+
+    // the operations below run on an open() connection, close it and append the
+    // response lines to lines
+
+    ///
+    /// status and current song, returns true if playing
+    ///
+    bool status(MpdStatusLines& lines)
+    {
+        this->append(lines);
+        bool playing = this->con.GetStatusAndSong();
+        this->append(lines);
+        // attempt to capture the "Alsa underrun sending silence" error message
+        // but unfortunately it looks like mpd does only log the message, it never gets here
+        if (playing && (this->con.GetLastError().find("silence") != string::npos)) {
+            lines.push_back("*ALSA XRUN -> restarting play");
+            this->con.Stop();
+            this->con.Play();
+        }
+        this->close();
+        this->append(lines);
+        return playing;
+    }
+
+    bool toggle(MpdStatusLines& lines)
+    {
+        this->append(lines);
+        bool ok;
+        if (this->con.IsPlaying()) {
+            this->append(lines);
+            lines.push_back("Stop playing");
+            this->append(lines);
+            ok = this->con.Stop();
+            this->append(lines);
+        } else {
+            lines.push_back("Start playing");
+            ok = this->con.Play();
+            this->append(lines);
+        }
+        this->close();
+        this->append(lines);
+        return ok;
+    }
+
+    bool play_url(const char* url, MpdStatusLines& lines)
+    {
+        this->append(lines);
+        bool ok = this->con.PlayUrl(url);
+        this->append(lines);
+        this->close();
+        this->append(lines);
+        return ok;
+    }
+
+    bool play_pos(uint32_t pos, MpdStatusLines& lines)
+    {
+        this->append(lines);
+        bool ok = this->con.PlayPos(pos);
+        this->append(lines);
+        this->close();
+        this->append(lines);
+        return ok;
+    }
+
+    ///
+    /// the response lines as the status screen shows them: "artist - title" on two lines
+    ///
+    static void format(const MpdStatusLines& response, MpdStatusLines& lines)
+    {
+        for (auto& line : response) {
+            size_t p = line.find(" - ");
+            if (p == string::npos) {
+                lines.push_back(line);
+                continue;
+            }
+            lines.push_back(line.substr(0, p));
+            p += 3;
+            if ((p + 1) < line.length()) {
+                lines.push_back(line.substr(p));
+            }
+        }
+    }
+};
@@ -0,0 +1,263 @@
+// Copyright (c) 2023 @dheijl (danny.heijl@telenet.be)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include <WiFi.h>
+#include <WiFiClient.h>
+#include <lwip/sockets.h>
+#else
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+///
+/// byte stream to an MPD server, so that the protocol layer does not depend on WiFiClient
+///
+class MpdTransport {
+public:
+    virtual ~MpdTransport() { }
+    virtual bool connect(const char* host, uint16_t port) = 0;
+    virtual void stop() = 0;
+    virtual bool connected() = 0;
+    // number of bytes that can be read without blocking
+    virtual int available() = 0;
+    virtual int read(uint8_t* buf, size_t size) = 0;
+    virtual size_t write(const uint8_t* buf, size_t size) = 0;
+    // block until data is available or timeout_ms has passed
+    virtual void wait_for_data(uint32_t timeout_ms) = 0;
+    virtual void set_connect_timeout(uint32_t) { }
+};
+
+#ifdef ARDUINO
+
+inline uint32_t mpd_millis()
+{
+    return millis();
+}
+
+inline uint32_t mpd_micros()
+{
+    return micros();
+}
+
+class WiFiTransport : public MpdTransport {
+private:
+    WiFiClient Client;
+    uint32_t connect_timeout;
+
+public:
+    WiFiTransport()
+        : connect_timeout(3000)
+    {
+    }
+    bool connect(const char* host, uint16_t port) override
+    {
+        if (Client.connect(host, port, this->connect_timeout)) {
+            Client.setNoDelay(true);
+            return true;
+        }
+        return false;
+    }
+    void stop() override
+    {
+        Client.stop();
+    }
+    bool connected() override
+    {
+        return Client.connected();
+    }
+    int available() override
+    {
+        return Client.available();
+    }
+    int read(uint8_t* buf, size_t size) override
+    {
+        return Client.read(buf, size);
+    }
+    size_t write(const uint8_t* buf, size_t size) override
+    {
+        return Client.write(buf, size);
+    }
+    void wait_for_data(uint32_t timeout_ms) override
+    {
+        int fd = Client.fd();
+        if (fd < 0) {
+            vTaskDelay(1);
+            return;
+        }
+        fd_set rfds;
+        FD_ZERO(&rfds);
+        FD_SET(fd, &rfds);
+        struct timeval tv;
+        tv.tv_sec = timeout_ms / 1000;
+        tv.tv_usec = (timeout_ms % 1000) * 1000;
+        select(fd + 1, &rfds, NULL, NULL, &tv);
+    }
+    void set_connect_timeout(uint32_t timeout_ms) override
+    {
+        this->connect_timeout = timeout_ms;
+    }
+};
+
+typedef WiFiTransport MpdDefaultTransport;
+
+#else
+
+inline uint32_t mpd_millis()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((ts.tv_sec * 1000) + (ts.tv_nsec / 1000000));
+}
+
+inline uint32_t mpd_micros()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((ts.tv_sec * 1000000) + (ts.tv_nsec / 1000));
+}
+
+///
+/// plain BSD socket backend, to run the protocol layer natively
+///
+class PosixTransport : public MpdTransport {
+private:
+    int fd;
+
+public:
+    PosixTransport()
+        : fd(-1)
+    {
+    }
+    ~PosixTransport()
+    {
+        this->stop();
+    }
+    PosixTransport(const PosixTransport&) = delete;
+    PosixTransport& operator=(const PosixTransport&) = delete;
+
+    bool connect(const char* host, uint16_t port) override
+    {
+        this->stop();
+        struct addrinfo hints;
+        memset(&hints, 0, sizeof(hints));
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+        char service[8];
+        snprintf(service, sizeof(service), "%u", port);
+        struct addrinfo* res = NULL;
+        if (getaddrinfo(host, service, &hints, &res) != 0) {
+            return false;
+        }
+        for (auto ai = res; ai != NULL; ai = ai->ai_next) {
+            int s = ::socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+            if (s < 0) {
+                continue;
+            }
+            if (::connect(s, ai->ai_addr, ai->ai_addrlen) == 0) {
+                int one = 1;
+                setsockopt(s, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+                this->fd = s;
+                break;
+            }
+            ::close(s);
+        }
+        freeaddrinfo(res);
+        return this->fd >= 0;
+    }
+    void stop() override
+    {
+        if (this->fd >= 0) {
+            ::close(this->fd);
+            this->fd = -1;
+        }
+    }
+    bool connected() override
+    {
+        if (this->fd < 0) {
+            return false;
+        }
+        char c;
+        ssize_t n = recv(this->fd, &c, 1, MSG_PEEK | MSG_DONTWAIT);
+        if ((n == 0) || ((n < 0) && (errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR))) {
+            // orderly shutdown by the peer, or an error such as ECONNRESET
+            this->stop();
+            return false;
+        }
+        return true;
+    }
+    int available() override
+    {
+        int n = 0;
+        if ((this->fd < 0) || (ioctl(this->fd, FIONREAD, &n) < 0)) {
+            return 0;
+        }
+        return n;
+    }
+    int read(uint8_t* buf, size_t size) override
+    {
+        if (this->fd < 0) {
+            return -1;
+        }
+        return (int)recv(this->fd, buf, size, 0);
+    }
+    size_t write(const uint8_t* buf, size_t size) override
+    {
+        size_t sent = 0;
+        while ((this->fd >= 0) && (sent < size)) {
+            ssize_t n = send(this->fd, buf + sent, size - sent, MSG_NOSIGNAL);
+            if (n <= 0) {
+                break;
+            }
+            sent += n;
+        }
+        return sent;
+    }
+    void wait_for_data(uint32_t timeout_ms) override
+    {
+        if (this->fd < 0) {
+            return;
+        }
+        struct pollfd pfd;
+        pfd.fd = this->fd;
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+        poll(&pfd, 1, (int)timeout_ms);
+    }
+};
+
+typedef PosixTransport MpdDefaultTransport;
+
+#endif
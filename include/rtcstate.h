@@ -0,0 +1,84 @@
+// Copyright (c) 2023 @dheijl (danny.heijl@telenet.be)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+#include <Arduino.h>
+#include <Preferences.h>
+
+///
+/// a state in RTC memory (RTC_DATA_ATTR) with a copy in NVS: RTC memory survives deep
+/// sleep, but not the power off of M5.shutdown(), then the NVS copy is read back.
+/// The magic word tells whether the RTC copy is loaded; it may be a field of the state.
+///
+template <typename T>
+class RtcNvsState {
+private:
+    T& rtc;
+    uint32_t& magic;
+    const char* nvs_namespace;
+    const char* key;
+    uint32_t loaded_magic;
+
+public:
+    RtcNvsState(T& rtc, uint32_t& magic, const char* nvs_namespace, const char* key, uint32_t loaded_magic)
+        : rtc(rtc)
+        , magic(magic)
+        , nvs_namespace(nvs_namespace)
+        , key(key)
+        , loaded_magic(loaded_magic)
+    {
+    }
+    RtcNvsState(const RtcNvsState&) = delete;
+    RtcNvsState& operator=(const RtcNvsState&) = delete;
+
+    ///
+    /// the state, read from NVS after a power off (all zeros if NVS has none)
+    ///
+    T& load()
+    {
+        if (this->magic != this->loaded_magic) {
+            memset(&this->rtc, 0, sizeof(this->rtc));
+            Preferences prefs;
+            if (prefs.begin(this->nvs_namespace, true)) {
+                if (prefs.getBytesLength(this->key) == sizeof(this->rtc)) {
+                    prefs.getBytes(this->key, &this->rtc, sizeof(this->rtc));
+                }
+                prefs.end();
+            }
+            this->magic = this->loaded_magic;
+        }
+        return this->rtc;
+    }
+
+    ///
+    /// write the state to NVS, false on errors
+    ///
+    bool save()
+    {
+        Preferences prefs;
+        if (!prefs.begin(this->nvs_namespace, false)) {
+            return false;
+        }
+        bool ok = prefs.putBytes(this->key, &this->rtc, sizeof(this->rtc)) == sizeof(this->rtc);
+        prefs.end();
+        return ok;
+    }
+};
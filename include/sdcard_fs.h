@@ -31,4 +31,7 @@ public:
     static bool read_wifi(NETWORK_CFG& ap);
     static bool read_players(PLAYERS& players);
     static bool read_favourites(FAVOURITES& favourites);
+    // mount the card, nested mounts are counted: every mount() that succeeds needs an unmount()
+    static bool mount();
+    static void unmount();
 };
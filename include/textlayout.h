@@ -0,0 +1,294 @@
+// Copyright (c) 2023 @dheijl (danny.heijl@telenet.be)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+using std::string;
+using std::vector;
+
+///
+/// a piece of text at its position, in the glyph codes of the font (not UTF-8)
+///
+typedef struct text_run {
+    int16_t x;
+    int16_t y;
+    string text;
+} TEXT_RUN;
+
+typedef vector<TEXT_RUN> TextRuns;
+
+///
+/// width in pixels of a glyph of the font at one text size
+///
+class GlyphMeasure {
+public:
+    virtual ~GlyphMeasure() { }
+    virtual int glyph_width(uint8_t glyph) = 0;
+};
+
+///
+/// UTF-8 text to positioned lines for the built-in font (code page 437): decodes
+/// UTF-8, maps what the font lacks to the nearest ASCII, wraps at spaces and ends
+/// a text that does not fit its line budget with "...". Glyph widths are measured
+/// once per layout, so one layout per text size.
+///
+class TextLayout {
+private:
+    GlyphMeasure* measure;
+    int line_height;
+    int16_t widths[256];
+
+    // the next code point, U+FFFD for a malformed sequence
+    static uint32_t next_code_point(const char*& p)
+    {
+        uint8_t c = (uint8_t)*p++;
+        if (c < 0x80) {
+            return c;
+        }
+        int extra = 0;
+        uint32_t cp = 0;
+        if ((c & 0xe0) == 0xc0) {
+            extra = 1;
+            cp = c & 0x1f;
+        } else if ((c & 0xf0) == 0xe0) {
+            extra = 2;
+            cp = c & 0x0f;
+        } else if ((c & 0xf8) == 0xf0) {
+            extra = 3;
+            cp = c & 0x07;
+        } else {
+            return 0xfffd;
+        }
+        for (int i = 0; i < extra; ++i) {
+            if (((uint8_t)*p & 0xc0) != 0x80) {
+                return 0xfffd;
+            }
+            cp = (cp << 6) | ((uint8_t)*p++ & 0x3f);
+        }
+        return cp;
+    }
+    // append the glyph(s) of a code point
+    static void append_glyphs(uint32_t cp, string& glyphs)
+    {
+        // U+00C0 - U+00FF and U+0100 - U+017F without their accents
+        static const char* const latin1 = "AAAAAAACEEEEIIIIDNOOOOOxOUUUUYTsaaaaaaaceeeeiiiidnooooo/ouuuuyty";
+        static const char* const latin_ext_a = "AaAaAaCcCcCcCcDdDdEeEeEeEeEeGgGgGgGgHhHhIiIiIiIiIiIiJjKkkLlLlLlLlLlNnNnNnnNnOoOoOoOoRrRrRrSsSsSsSsTtTtTtUuUuUuUuUuUuWwYyYZzZzZzs";
+        // code page 437 glyphs of Latin-1 characters
+        static const uint16_t cp437[][2] = {
+            { 0xa1, 0xad }, { 0xa2, 0x9b }, { 0xa3, 0x9c }, { 0xa5, 0x9d }, { 0xaa, 0xa6 }, { 0xab, 0xae }, { 0xac, 0xaa },
+            { 0xb0, 0xf8 }, { 0xb1, 0xf1 }, { 0xb2, 0xfd }, { 0xb5, 0xe6 }, { 0xb7, 0xfa }, { 0xba, 0xa7 }, { 0xbb, 0xaf },
+            { 0xbc, 0xac }, { 0xbd, 0xab }, { 0xbf, 0xa8 }, { 0xc4, 0x8e }, { 0xc5, 0x8f }, { 0xc6, 0x92 }, { 0xc7, 0x80 },
+            { 0xc9, 0x90 }, { 0xd1, 0xa5 }, { 0xd6, 0x99 }, { 0xdc, 0x9a }, { 0xdf, 0xe1 }, { 0xe0, 0x85 }, { 0xe1, 0xa0 },
+            { 0xe2, 0x83 }, { 0xe4, 0x84 }, { 0xe5, 0x86 }, { 0xe6, 0x91 }, { 0xe7, 0x87 }, { 0xe8, 0x8a }, { 0xe9, 0x82 },
+            { 0xea, 0x88 }, { 0xeb, 0x89 }, { 0xec, 0x8d }, { 0xed, 0xa1 }, { 0xee, 0x8c }, { 0xef, 0x8b }, { 0xf1, 0xa4 },
+            { 0xf2, 0x95 }, { 0xf3, 0xa2 }, { 0xf4, 0x93 }, { 0xf6, 0x94 }, { 0xf7, 0xf6 }, { 0xf9, 0x97 }, { 0xfa, 0xa3 },
+            { 0xfb, 0x96 }, { 0xfc, 0x81 }, { 0xff, 0x98 },
+        };
+        if ((cp >= 0x20) && (cp < 0x7f)) {
+            glyphs += (char)cp;
+            return;
+        }
+        if ((cp >= 0xa0) && (cp <= 0xff)) {
+            for (auto& m : cp437) {
+                if (m[0] == cp) {
+                    glyphs += (char)m[1];
+                    return;
+                }
+            }
+            glyphs += cp >= 0xc0 ? latin1[cp - 0xc0] : (cp == 0xa0 ? ' ' : '?');
+            return;
+        }
+        if ((cp >= 0x100) && (cp <= 0x17f)) {
+            glyphs += latin_ext_a[cp - 0x100];
+            return;
+        }
+        switch (cp) {
+        case '\t':
+        case 0x2002: // spaces
+        case 0x2003:
+        case 0x2009:
+            glyphs += ' ';
+            break;
+        case 0x2010: // dashes
+        case 0x2013:
+        case 0x2014:
+            glyphs += '-';
+            break;
+        case 0x2018: // quotes
+        case 0x2019:
+        case 0x201a:
+        case 0x2032:
+            glyphs += '\'';
+            break;
+        case 0x201c:
+        case 0x201d:
+        case 0x201e:
+            glyphs += '"';
+            break;
+        case 0x2022:
+            glyphs += (char)0xf9;
+            break;
+        case 0x2026:
+            glyphs += "...";
+            break;
+        default:
+            if (cp >= 0x20) {
+                glyphs += '?';
+            }
+            // control characters are dropped
+            break;
+        }
+    }
+
+public:
+    TextLayout(GlyphMeasure* measure, int line_height)
+        : measure(measure)
+        , line_height(line_height)
+    {
+        for (auto& w : this->widths) {
+            w = -1;
+        }
+    }
+
+    ///
+    /// the glyphs of the built-in font for a UTF-8 string
+    ///
+    static string to_glyphs(const char* utf8)
+    {
+        string glyphs;
+        glyphs.reserve(strlen(utf8));
+        while (*utf8 != '\0') {
+            append_glyphs(next_code_point(utf8), glyphs);
+        }
+        return glyphs;
+    }
+    ///
+    /// the last max_chars characters of a UTF-8 string, without splitting a character
+    ///
+    static const char* utf8_tail(const char* utf8, size_t max_chars)
+    {
+        const char* p = utf8 + strlen(utf8);
+        size_t n = 0;
+        while ((p > utf8) && (n < max_chars)) {
+            --p;
+            if (((uint8_t)*p & 0xc0) != 0x80) {
+                ++n;
+            }
+        }
+        return p;
+    }
+
+    int glyph_width(uint8_t glyph)
+    {
+        if (this->widths[glyph] < 0) {
+            this->widths[glyph] = this->measure->glyph_width(glyph);
+        }
+        return this->widths[glyph];
+    }
+    int text_width(const string& glyphs)
+    {
+        int w = 0;
+        for (auto c : glyphs) {
+            w += this->glyph_width((uint8_t)c);
+        }
+        return w;
+    }
+
+    ///
+    /// wrap a UTF-8 text in lines of at most width pixels starting at (x, y), using at most
+    /// max_lines lines. Words longer than a line are broken. Returns the y below the text.
+    ///
+    int layout(const char* utf8, int x, int y, int width, int max_lines, TextRuns& runs)
+    {
+        string glyphs = to_glyphs(utf8);
+        string line;
+        int line_width = 0;
+        int lines = 0;
+        size_t i = 0;
+        bool truncated = false;
+        while (i < glyphs.size()) {
+            // the next word, with the spaces before it
+            size_t start = i;
+            while ((i < glyphs.size()) && (glyphs[i] == ' ')) {
+                ++i;
+            }
+            size_t word_start = i;
+            while ((i < glyphs.size()) && (glyphs[i] != ' ')) {
+                ++i;
+            }
+            string spaces = line.empty() ? "" : glyphs.substr(start, word_start - start);
+            string word = glyphs.substr(word_start, i - word_start);
+            int word_width = this->text_width(spaces) + this->text_width(word);
+            if (line_width + word_width <= width) {
+                line += spaces + word;
+                line_width += word_width;
+                continue;
+            }
+            if (!line.empty()) {
+                // the word goes to the next line
+                if (lines + 1 >= max_lines) {
+                    truncated = true;
+                    break;
+                }
+                runs.push_back(TEXT_RUN { (int16_t)x, (int16_t)(y + lines * this->line_height), line });
+                ++lines;
+                line.clear();
+                line_width = 0;
+            }
+            // a word longer than a line: break it
+            for (auto c : word) {
+                int w = this->glyph_width((uint8_t)c);
+                if ((line_width + w > width) && !line.empty()) {
+                    if (lines + 1 >= max_lines) {
+                        truncated = true;
+                        break;
+                    }
+                    runs.push_back(TEXT_RUN { (int16_t)x, (int16_t)(y + lines * this->line_height), line });
+                    ++lines;
+                    line.clear();
+                    line_width = 0;
+                }
+                line += c;
+                line_width += w;
+            }
+            if (truncated) {
+                break;
+            }
+        }
+        if (truncated) {
+            // make room for the ellipsis on the last line
+            int ellipsis = this->text_width("...");
+            while (!line.empty() && ((line_width + ellipsis > width) || (line.back() == ' '))) {
+                line_width -= this->glyph_width((uint8_t)line.back());
+                line.pop_back();
+            }
+            line += "...";
+        }
+        if (!line.empty() || (lines == 0)) {
+            runs.push_back(TEXT_RUN { (int16_t)x, (int16_t)(y + lines * this->line_height), line });
+            ++lines;
+        }
+        return y + lines * this->line_height;
+    }
+};
@@ -29,4 +29,5 @@ void shutdown_and_wake();
 bool on_battery();
 String get_status();
 String get_date_time();
+uint32_t get_rtc_seconds();
 vector<string> split(const string& s, char delim);
@@ -0,0 +1,77 @@
+// Copyright (c) 2023 @dheijl (danny.heijl@telenet.be)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include <Arduino.h>
+
+// hard ceiling on the awake time of an RTC wake
+static const uint32_t WAKE_BUDGET_MS = 20000;
+
+typedef enum {
+    PhaseConfig,
+    PhaseWifi,
+    PhaseResolve,
+    PhaseStatus,
+    PhaseRender,
+    PHASE_COUNT,
+} WakePhase;
+
+///
+/// overrun counters per phase, kept across deep sleep and power off
+///
+typedef struct wake_stats {
+    uint32_t magic;
+    uint16_t overruns[PHASE_COUNT];
+} WAKE_STATS;
+
+///
+/// splits the wake budget over the phases of a wake: each phase gets its share,
+/// but never more than what is left of the total
+///
+class WakeBudget {
+private:
+    uint32_t start;
+    uint32_t total;
+    WakePhase phase;
+    uint32_t phase_start;
+    uint32_t phase_budget;
+    bool overrun;
+
+public:
+    WakeBudget()
+        : start(0)
+        , total(0)
+        , phase(PhaseConfig)
+        , phase_start(0)
+        , phase_budget(0)
+        , overrun(false)
+    {
+    }
+    void begin(uint32_t total_ms);
+    // returns the budget of the phase in ms (0: nothing left)
+    uint32_t begin_phase(WakePhase phase);
+    // returns false (and counts an overrun) if the phase took longer than its budget
+    bool end_phase();
+    uint32_t remaining();
+    // true if any phase of this wake overran
+    bool degraded();
+};
+
+extern WakeBudget& Budget;
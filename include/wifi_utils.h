@@ -22,5 +22,6 @@
 #include "config.h"
 
 bool is_wifi_connected();
-bool start_wifi();
+// timeout_ms bounds all attempts together, 0 for no bound
+bool start_wifi(int attempts = 5, uint32_t timeout_ms = 0);
 void stop_wifi(bool wifi_off = false);
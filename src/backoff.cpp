@@ -0,0 +1,115 @@
+// Copyright (c) 2023 @dheijl (danny.heijl@telenet.be)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "backoff.h"
+
+#include "config.h"
+#include "rtcstate.h"
+#include "utils.h"
+
+static const constexpr char* NVS_BACKOFF = "backoff";
+static const uint32_t RTC_BACKOFF_MAGIC = 0x424b4f46;
+// 1, 2, 4, ... minutes after consecutive failures, at most an hour
+static const uint32_t BACKOFF_MIN = 60;
+static const uint32_t BACKOFF_MAX = 3600;
+
+RTC_DATA_ATTR static BACKOFF_STATE rtc_backoff;
+static RtcNvsState<BACKOFF_STATE> backoff_state(rtc_backoff, rtc_backoff.magic, NVS_BACKOFF, "state", RTC_BACKOFF_MAGIC);
+
+static BACKOFF_STATE& load_state()
+{
+    return backoff_state.load();
+}
+
+static void save_state()
+{
+    if (!backoff_state.save()) {
+        DPRINT("backoff prefs error");
+    }
+}
+
+bool network_backoff()
+{
+    auto& state = load_state();
+    if (network_failures() == 0) {
+        return false;
+    }
+    return (int32_t)(state.next_attempt - get_rtc_seconds()) > 0;
+}
+
+uint16_t network_failures()
+{
+    auto& state = load_state();
+    return state.wifi_failures + state.player_failures;
+}
+
+void record_network_result(NetworkResult result)
+{
+    auto& state = load_state();
+    if (result == NetworkOk) {
+        if (network_failures() > 0) {
+            state.wifi_failures = 0;
+            state.player_failures = 0;
+            state.offline_since = 0;
+            state.next_attempt = 0;
+            save_state();
+        }
+        return;
+    }
+    uint32_t now = get_rtc_seconds();
+    if (network_failures() == 0) {
+        state.offline_since = now;
+    }
+    if (result == NetworkNoWifi) {
+        ++state.wifi_failures;
+    } else {
+        ++state.player_failures;
+    }
+    uint16_t n = min(network_failures(), (uint16_t)7);
+    uint32_t wait = min(BACKOFF_MIN << (n - 1), BACKOFF_MAX);
+    state.next_attempt = now + wait;
+    DPRINT("network backoff " + String(wait) + "s after " + String(network_failures()) + " failures");
+    save_state();
+}
+
+int backoff_sleep_time(int sleep_time)
+{
+    if (!network_backoff()) {
+        return sleep_time;
+    }
+    int32_t wait = (int32_t)(load_state().next_attempt - get_rtc_seconds());
+    return max(sleep_time, (int)wait);
+}
+
+String offline_since()
+{
+    auto& state = load_state();
+    if (network_failures() == 0) {
+        return String();
+    }
+    uint32_t age = get_rtc_seconds() - state.offline_since;
+    const char* what = state.wifi_failures > 0 ? "No wifi" : "No player";
+    if (age >= 86400) {
+        return String(what) + " for " + String(age / 86400) + " days";
+    }
+    char since[8];
+    uint32_t t = state.offline_since % 86400;
+    snprintf(since, sizeof(since), "%02u:%02u", (unsigned)(t / 3600), (unsigned)((t % 3600) / 60));
+    return String(what) + " since " + since;
+}
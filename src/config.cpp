@@ -21,6 +21,7 @@
 
 #include "epdfunctions.h"
 #include "flash_fs.h"
+#include "mdnscache.h"
 #include "sdcard_fs.h"
 #include "utils.h"
 #include <ESPmDNS.h>
@@ -48,6 +49,7 @@ bool Configuration::load_config()
             return false;
         }
     }
+    this->merge_discovered_players();
     return true;
 }
 
@@ -56,41 +58,181 @@ void Configuration::set_player_index(uint16_t new_pl)
     this->player_index = new_pl;
 }
 
+uint16_t Configuration::get_player_index()
+{
+    return this->player_index;
+}
+
 const MPD_PLAYER& Configuration::get_active_mpd()
 {
-    auto player = &*(this->mpd_players[config.player_index]);
+    return this->resolve_player(this->player_index);
+}
+
+// the default of MDNS.queryHost()
+static const uint32_t MDNS_QUERY_TIMEOUT = 2000;
+static uint32_t mdns_timeout = MDNS_QUERY_TIMEOUT;
+
+void Configuration::set_resolve_timeout(uint32_t timeout_ms)
+{
+    mdns_timeout = timeout_ms > 0 ? timeout_ms : MDNS_QUERY_TIMEOUT;
+}
+
+///
+/// mDNS lookup of a .local hostname, the null ip if not found
+///
+static IPAddress query_mdns(const char* hostname)
+{
     auto null_ip = IPAddress((uint32_t)0);
-    // convert .local hostname to ip if needed
     if (!MDNS.begin("m5paper")) {
         epd_print_topline("MDNS begin failure!");
-        return *player;
+        return null_ip;
+    }
+    string localname = string(hostname);
+    auto pos = localname.find(".local");
+    auto ip = null_ip;
+    if (pos != std::string::npos) {
+        // ESP32 MDNS bug: .local suffix has to be stripped !
+        localname.erase(pos, localname.length());
+        //for (auto& c : localname) { c = toupper(c); }
+        epd_print_topline("MDNS lookup: " + String(localname.c_str()));
+        ip = MDNS.queryHost(localname.c_str(), mdns_timeout);
+    }
+    if (ip == null_ip) {
+        localname += ".local";
+        epd_print_topline("MDNS lookup: " + String(localname.c_str()));
+        ip = MDNS.queryHost(hostname, mdns_timeout);
     }
+    return ip;
+}
+
+///
+/// the player with its .local hostname resolved to an ip address,
+/// from the mDNS cache if possible
+///
+const MPD_PLAYER& Configuration::resolve_player(uint16_t index)
+{
+    auto player = &*(this->mpd_players[index]);
     if (player->player_ip == NULL) {
-        string localname = string(player->player_hostname);
-        auto pos = localname.find(".local");
-        auto ip = null_ip;
-        if (pos != std::string::npos) {
-            // ESP32 MDNS bug: .local suffix has to be stripped !
-            localname.erase(pos, localname.length());
-            //for (auto& c : localname) { c = toupper(c); }
-            epd_print_topline("MDNS lookup: " + String(localname.c_str()));
-            ip = MDNS.queryHost(localname.c_str());
+        IPAddress ip;
+        if (ip.fromString(player->player_hostname)) {
+            // a literal ip address needs no lookup
+            player->player_ip = strdup(player->player_hostname);
+        } else if (MDNS_Cache::lookup(player->player_hostname, ip)) {
+            DPRINT("MDNS cached IP: " + ip.toString());
+            player->player_ip = strdup(ip.toString().c_str());
+        } else {
+            ip = query_mdns(player->player_hostname);
+            if (ip != IPAddress((uint32_t)0)) {
+                epd_print_topline("MDNS IP: " + ip.toString());
+                MDNS_Cache::store(player->player_hostname, ip);
+                player->player_ip = strdup(ip.toString().c_str());
+            } else {
+                epd_print_topline("MDNS IP: not found");
+                player->player_ip = strdup(player->player_hostname);
+            }
+        }
+    }
+    return *player;
+}
+
+///
+/// a connect to the player failed: look up its hostname again in case it moved,
+/// returns the player if its address changed, else NULL
+///
+const MPD_PLAYER* Configuration::revalidate_player(const char* hostname)
+{
+    IPAddress ip;
+    if (ip.fromString(hostname)) {
+        return NULL;
+    }
+    for (auto player : this->mpd_players) {
+        if (strcmp(player->player_hostname, hostname) != 0) {
+            continue;
         }
-        if (ip == null_ip) {
-            localname += ".local";
-            epd_print_topline("MDNS lookup: " + String(localname.c_str()));
-            ip = MDNS.queryHost(player->player_hostname);
+        MDNS_Cache::forget(hostname);
+        ip = query_mdns(hostname);
+        if (ip == IPAddress((uint32_t)0)) {
+            return NULL;
         }
-        if (ip != null_ip) {
-            epd_print_topline("MDNS IP: " + ip.toString());
-            player->player_ip = strdup(ip.toString().c_str());
+        MDNS_Cache::store(hostname, ip);
+        String new_ip = ip.toString();
+        if ((player->player_ip != NULL) && (new_ip == player->player_ip)) {
+            return NULL;
         }
-        else {
-            epd_print_topline("MDNS IP: not found");
-            player->player_ip = strdup(player->player_hostname);
+        epd_print_topline("MDNS new IP: " + new_ip);
+        // the old string is not freed: copies of the player may still point to it
+        player->player_ip = strdup(new_ip.c_str());
+        return player;
+    }
+    return NULL;
+}
+
+bool Configuration::has_player(const char* hostname, uint16_t port)
+{
+    for (auto player : this->mpd_players) {
+        if ((player->player_port == port) && (strcmp(player->player_hostname, hostname) == 0)) {
+            return true;
         }
     }
-    return *player;
+    return false;
+}
+
+///
+/// add the players found by an earlier discovery, also when the SD card has a players.txt
+///
+void Configuration::merge_discovered_players()
+{
+    PLAYERS discovered;
+    NVS_Config::read_discovered_players(discovered);
+    for (auto player : discovered) {
+        if ((this->mpd_players.size() < MAX_PLAYERS) && !this->has_player(player->player_hostname, player->player_port)) {
+            this->mpd_players.push_back(player);
+        } else {
+            delete player;
+        }
+    }
+}
+
+///
+/// browse _mpd._tcp once and add the players that are not configured yet,
+/// returns the number of new players (-1 on error)
+///
+int Configuration::discover_players()
+{
+    if (!MDNS.begin("m5paper")) {
+        epd_print_topline("MDNS begin failure!");
+        return -1;
+    }
+    epd_print_topline("MDNS browse _mpd._tcp");
+    int n = MDNS.queryService("mpd", "tcp");
+    PLAYERS discovered;
+    NVS_Config::read_discovered_players(discovered);
+    int added = 0;
+    for (int i = 0; (i < n) && (this->mpd_players.size() < MAX_PLAYERS); ++i) {
+        String hostname = MDNS.hostname(i) + ".local";
+        IPAddress ip = MDNS.IP(i);
+        uint16_t port = MDNS.port(i);
+        // the browse already resolved it: later wakes need no lookup
+        MDNS_Cache::store(hostname.c_str(), ip);
+        if (this->has_player(hostname.c_str(), port)) {
+            continue;
+        }
+        auto mpd = new MPD_PLAYER();
+        mpd->player_name = strdup(MDNS.hostname(i).c_str());
+        mpd->player_hostname = strdup(hostname.c_str());
+        mpd->player_ip = strdup(ip.toString().c_str());
+        mpd->player_port = port;
+        this->mpd_players.push_back(mpd);
+        discovered.push_back(mpd);
+        epd_print_topline(String(mpd->player_name) + " " + ip.toString() + ":" + String(port));
+        ++added;
+    }
+    bool saved = (added == 0) || NVS_Config::write_discovered_players(discovered);
+    // the new players are owned by mpd_players now, the others were only read back
+    for (size_t i = 0; i < discovered.size() - added; ++i) {
+        delete discovered[i];
+    }
+    return saved ? added : -1;
 }
 
 const NETWORK_CFG& Configuration::getNW_CFG()
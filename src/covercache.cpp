@@ -0,0 +1,185 @@
+// Copyright (c) 2023 @dheijl (danny.heijl@telenet.be)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <SD.h>
+
+#include "covercache.h"
+
+#include "config.h"
+#include "sdcard_fs.h"
+#include "utils.h"
+
+static const uint32_t COVER_INDEX_MAGIC = 0x43565231;
+static const constexpr char* COVER_DIR = "/covers";
+static const constexpr char* COVER_INDEX = "/covers/index.dat";
+
+static bool begin_sd()
+{
+    if (!SD_Config::mount()) {
+        return false;
+    }
+    if (!SD.exists(COVER_DIR) && !SD.mkdir(COVER_DIR)) {
+        SD_Config::unmount();
+        return false;
+    }
+    return true;
+}
+
+static String blob_path(uint32_t key)
+{
+    char path[32];
+    snprintf(path, sizeof(path), "%s/%08x.g4", COVER_DIR, key);
+    return String(path);
+}
+
+static void read_index(COVER_CACHE_INDEX& index)
+{
+    File f = SD.open(COVER_INDEX, FILE_READ);
+    bool ok = f && (f.read((uint8_t*)&index, sizeof(index)) == sizeof(index)) && (index.magic == COVER_INDEX_MAGIC);
+    if (f) {
+        f.close();
+    }
+    if (!ok) {
+        memset(&index, 0, sizeof(index));
+        index.magic = COVER_INDEX_MAGIC;
+    }
+}
+
+static bool write_index(const COVER_CACHE_INDEX& index)
+{
+    File f = SD.open(COVER_INDEX, FILE_WRITE);
+    if (!f) {
+        DPRINT("cover index write error");
+        return false;
+    }
+    bool ok = f.write((const uint8_t*)&index, sizeof(index)) == sizeof(index);
+    f.close();
+    return ok;
+}
+
+static COVER_CACHE_ENTRY* find_entry(COVER_CACHE_INDEX& index, uint32_t key)
+{
+    for (auto& entry : index.entries) {
+        if (entry.key == key) {
+            return &entry;
+        }
+    }
+    return NULL;
+}
+
+///
+/// copy the cached cover for key into buf, which must be exactly the size it was stored with
+///
+CoverLookup CoverCache::load(uint32_t key, uint8_t* buf, size_t size)
+{
+    if ((key == 0) || !begin_sd()) {
+        return CoverMiss;
+    }
+    COVER_CACHE_INDEX index;
+    read_index(index);
+    CoverLookup result = CoverMiss;
+    auto entry = find_entry(index, key);
+    if (entry != NULL) {
+        if (entry->size == 0) {
+            // retried now and then, a cover may have been added since
+            result = (get_rtc_seconds() - entry->stored_at) < COVER_NONE_TTL ? CoverNone : CoverMiss;
+        } else if (entry->size == size) {
+            File f = SD.open(blob_path(key), FILE_READ);
+            if (f) {
+                result = f.read(buf, size) == size ? CoverHit : CoverMiss;
+                f.close();
+            }
+        }
+        if (result == CoverMiss) {
+            // stale: a lost blob, another cover size or an expired "no cover"
+            SD.remove(blob_path(key).c_str());
+            memset(entry, 0, sizeof(*entry));
+            write_index(index);
+        } else if ((result == CoverHit) && (entry->used != index.uses)) {
+            // only written if the LRU order changes: the same cover on every wake reads only
+            entry->used = ++index.uses;
+            write_index(index);
+        }
+    }
+    SD_Config::unmount();
+    return result;
+}
+
+///
+/// add a cover, evicting the least recently used ones until both the entry count
+/// and the total size are within bounds
+///
+bool CoverCache::store(uint32_t key, const uint8_t* buf, size_t size)
+{
+    if ((key == 0) || !begin_sd()) {
+        return false;
+    }
+    COVER_CACHE_INDEX index;
+    read_index(index);
+    auto entry = find_entry(index, key);
+    if (entry != NULL) {
+        memset(entry, 0, sizeof(*entry));
+    }
+    for (;;) {
+        uint32_t total = size;
+        COVER_CACHE_ENTRY* free_entry = NULL;
+        COVER_CACHE_ENTRY* lru = NULL;
+        for (auto& e : index.entries) {
+            if (e.key == 0) {
+                free_entry = free_entry == NULL ? &e : free_entry;
+                continue;
+            }
+            total += e.size;
+            if ((lru == NULL) || (e.used < lru->used)) {
+                lru = &e;
+            }
+        }
+        if ((free_entry != NULL) && (total <= COVER_CACHE_MAX_BYTES)) {
+            entry = free_entry;
+            break;
+        }
+        if (lru == NULL) {
+            // larger than the whole cache
+            SD_Config::unmount();
+            return false;
+        }
+        DPRINT("cover evict " + String(lru->key, HEX));
+        SD.remove(blob_path(lru->key).c_str());
+        memset(lru, 0, sizeof(*lru));
+    }
+    bool ok = true;
+    if (size > 0) {
+        File f = SD.open(blob_path(key), FILE_WRITE);
+        ok = f && (f.write(buf, size) == size);
+        if (f) {
+            f.close();
+        }
+    }
+    if (ok) {
+        entry->key = key;
+        entry->size = size;
+        entry->used = ++index.uses;
+        entry->stored_at = get_rtc_seconds();
+        ok = write_index(index);
+    } else {
+        SD.remove(blob_path(key).c_str());
+    }
+    SD_Config::unmount();
+    return ok;
+}
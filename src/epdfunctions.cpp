@@ -20,29 +20,129 @@
 #include <M5EPD.h>
 
 #include "config.h"
+#include "dirtyrect.h"
 #include "epdfunctions.h"
+#include "epdmode.h"
+#include "imgdither.h"
+#include "rtcstate.h"
+#include "textlayout.h"
 
 static M5EPD_Canvas topline(&M5.EPD); // 0 - 40
 static M5EPD_Canvas canvas(&M5.EPD); // 40 - 880
 static M5EPD_Canvas bottomline(&M5.EPD); // 920 - 40
+static M5EPD_Canvas cover(&M5.EPD); // 600 - 300, created on first use
 
-void epd_init()
+///
+/// glyph widths of the status canvas font
+///
+class CanvasMeasure : public GlyphMeasure {
+public:
+    int glyph_width(uint8_t glyph) override
+    {
+        char s[2] = { (char)glyph, '\0' };
+        return canvas.textWidth(String(s));
+    }
+};
+
+// the area and font of the status text: text size 3 of the 8 pixel built-in font
+static const int STATUS_X = 10;
+static const int STATUS_Y = 10;
+static const int STATUS_WIDTH = 520;
+static const int STATUS_BOTTOM = 870;
+static const int STATUS_LINE_HEIGHT = 24;
+static const int STATUS_LINE_GAP = 14;
+// a status line wraps to at most this many lines
+static const int STATUS_MAX_LINES = 2;
+
+static CanvasMeasure status_measure;
+static TextLayout status_layout(&status_measure, STATUS_LINE_HEIGHT);
+
+static const constexpr char* NVS_EPD = "epdframe";
+static const uint32_t RTC_FRAME_MAGIC = 0x46524d31;
+static const int CANVAS_BANDS = (880 + DIRTY_BAND_ROWS - 1) / DIRTY_BAND_ROWS;
+
+///
+/// what the panel shows: the panel keeps its image without power, so this is what a
+/// wake compares the new status with
+///
+typedef struct epd_frame_state {
+    uint32_t magic;
+    bool valid; // false: the canvas area does not show the hashed frame
+    uint32_t cover_key; // cover on the panel, 0 if none
+    uint32_t hashes[CANVAS_BANDS];
+} EPD_FRAME_STATE;
+
+RTC_DATA_ATTR static EPD_FRAME_STATE rtc_frame;
+static RtcNvsState<EPD_FRAME_STATE> frame_state(rtc_frame, rtc_frame.magic, NVS_EPD, "frame", RTC_FRAME_MAGIC);
+static bool frame_changed = false;
+
+static EPD_FRAME_STATE& load_frame()
+{
+    return frame_state.load();
+}
+
+static void invalidate_frame()
+{
+    auto& frame = load_frame();
+    frame_changed = frame_changed || frame.valid || (frame.cover_key != 0);
+    frame.valid = false;
+    frame.cover_key = 0;
+}
+
+///
+/// dithered rows straight into the cover canvas, centered
+///
+class CoverSink : public Gray4Sink {
+private:
+    int x0;
+    int y0;
+
+public:
+    CoverSink()
+        : x0(0)
+        , y0(0)
+    {
+    }
+    void begin(int width, int height) override
+    {
+        this->x0 = (COVER_SIZE - width) / 2;
+        this->y0 = (COVER_SIZE - height) / 2;
+    }
+    void put_row(int y, const uint8_t* levels, int width) override
+    {
+        for (int x = 0; x < width; ++x) {
+            cover.drawPixel(this->x0 + x, this->y0 + y, levels[x]);
+        }
+    }
+};
+
+///
+/// with clear false the panel keeps showing the previous frame, so that only what
+/// changed has to be updated
+///
+void epd_init(bool clear)
 {
     // init EPD
     M5.EPD.SetRotation(90);
     M5.TP.SetRotation(90);
-    M5.EPD.Clear(true);
-    // create canvases
+    if (clear) {
+        M5.EPD.Clear(true);
+        invalidate_frame();
+        WaveformScheduler::reset();
+    }
+    // create canvases, the text is already converted to font glyphs by TextLayout:
+    // decoding it again as UTF-8 would swallow glyphs like 0xE1 (ß) and 0xE6 (µ)
     topline.createCanvas(540, 40);
     topline.setTextSize(3);
+    topline.setAttribute(UTF8_SWITCH, false);
     topline.clear();
     canvas.createCanvas(540, 880);
     canvas.setTextSize(3);
+    canvas.setAttribute(UTF8_SWITCH, false);
     canvas.clear();
-    canvas.setTextArea(10, 10, 530, 870);
-    canvas.setTextWrap(true, false);
     bottomline.createCanvas(540, 40);
     bottomline.setTextSize(3);
+    bottomline.setAttribute(UTF8_SWITCH, false);
     bottomline.clear();
 }
 
@@ -50,45 +150,234 @@ void epd_print_topline(const String& s)
 {
     DPRINT(s);
     topline.clear();
-    topline.drawString(s, 10, 10);
-    topline.pushCanvas(0, TOPLINE_Y, UPDATE_MODE_DU4);
+    topline.drawString(TextLayout::to_glyphs(s.c_str()).c_str(), 10, 10);
+    bool cleanup;
+    topline.pushCanvas(0, TOPLINE_Y, WaveformScheduler::next_mode(RegionTopline, false, cleanup));
 }
 
 void epd_print_canvas(const StatusLines& sl)
 {
     canvas.clear();
-    canvas.setCursor(0, 0);
     canvas.setTextColor(15, 0);
+    TextRuns runs;
+    int y = STATUS_Y;
     for (auto line : sl) {
         DPRINT(line);
-        canvas.setCursor(canvas.getCursorX(), canvas.getCursorY() + 14);
-        canvas.println(line);
+        y = status_layout.layout(line.c_str(), STATUS_X, y + STATUS_LINE_GAP, STATUS_WIDTH, STATUS_MAX_LINES, runs);
+    }
+    for (auto& run : runs) {
+        if (run.y + STATUS_LINE_HEIGHT <= STATUS_BOTTOM) {
+            canvas.drawString(String(run.text.c_str()), run.x, run.y);
+        }
     }
-    canvas.pushCanvas(0, CANVAS_Y, UPDATE_MODE_A2);
+    // only push the bands that differ from what the panel shows, unless it is time for a cleanup
+    auto& frame = load_frame();
+    bool cleanup = WaveformScheduler::cleanup_due(RegionCanvas);
+    DIRTY_REGION regions[MAX_DIRTY_REGIONS];
+    auto fb = (const uint8_t*)canvas.frameBuffer();
+    int count = DirtyBands::diff(fb, canvas.width(), canvas.height(), frame.hashes, frame.valid && !cleanup, regions);
+    // a wake that pushes nothing does not count as an update
+    auto mode = (count > 0) ? WaveformScheduler::next_mode(RegionCanvas, false, cleanup) : UPDATE_MODE_NONE;
+    for (int i = 0; i < count; ++i) {
+        auto& r = regions[i];
+        M5.EPD.WritePartGram4bpp(0, CANVAS_Y + r.y, canvas.width(), r.h, fb + (r.y * canvas.width() / 2));
+        M5.EPD.UpdateArea(0, CANVAS_Y + r.y, canvas.width(), r.h, mode);
+        if ((CANVAS_Y + r.y < COVER_Y + COVER_SIZE) && (CANVAS_Y + r.y + r.h > COVER_Y)) {
+            frame.cover_key = 0;
+        }
+    }
+    DPRINT("canvas: " + String(count) + " regions");
+    frame_changed = frame_changed || (count > 0) || !frame.valid;
+    frame.valid = true;
 }
 
-void epd_draw_menu(const MenuLines& lines, const int selected)
+///
+/// decode a JPEG or PNG cover, dither it and show it with a full grayscale update
+///
+bool epd_draw_cover(const uint8_t* data, size_t len, uint32_t key)
 {
-    canvas.clear();
-    canvas.setCursor(0, 0);
-    int i = 0;
-    for (auto l : lines) {
-        DPRINT(l->text);
-        if (i++ == selected) {
-            canvas.setTextColor(0, 15);
-            canvas.drawString(String(l->text), l->x, l->y);
-            canvas.setTextColor(15, 0);
-        } else {
-            canvas.drawString(String(l->text), l->x, l->y);
+    size_t size;
+    if (epd_cover_buffer(size) == NULL) {
+        return false;
+    }
+    cover.clear();
+    CoverSink sink;
+    ImageDither dither(&sink);
+    IMAGE_STATS stats;
+    uint32_t start = micros();
+    bool ok = dither.draw(data, len, COVER_SIZE, COVER_SIZE, stats);
+    DPRINT("cover " + String(stats.src_width) + "x" + String(stats.src_height) + " -> " + String(stats.width) + "x"
+        + String(stats.height) + " in " + String((micros() - start) / 1000) + " ms, " + String(stats.peak_bytes) + " bytes");
+    if (ok) {
+        epd_push_cover(key);
+    }
+    return ok;
+}
+
+///
+/// the packed 4 bit pixels of the cover canvas, to save a dithered cover or restore it
+///
+uint8_t* epd_cover_buffer(size_t& size)
+{
+    if ((cover.width() == 0) && (cover.createCanvas(COVER_SIZE, COVER_SIZE) == NULL)) {
+        size = 0;
+        return NULL;
+    }
+    size = (COVER_SIZE * COVER_SIZE) / 2;
+    return (uint8_t*)cover.frameBuffer();
+}
+
+void epd_push_cover(uint32_t key)
+{
+    bool cleanup;
+    cover.pushCanvas(COVER_X, COVER_Y, WaveformScheduler::next_mode(RegionCover, true, cleanup));
+    auto& frame = load_frame();
+    frame_changed = frame_changed || (frame.cover_key != key);
+    frame.cover_key = key;
+}
+
+///
+/// replace a cover on the panel with the status canvas below it
+///
+void epd_hide_cover()
+{
+    auto& frame = load_frame();
+    if (frame.cover_key == 0) {
+        return;
+    }
+    int y = COVER_Y - CANVAS_Y;
+    auto fb = (const uint8_t*)canvas.frameBuffer();
+    M5.EPD.WritePartGram4bpp(0, COVER_Y, canvas.width(), COVER_SIZE, fb + (y * canvas.width() / 2));
+    // a gray waveform, A2 would leave a ghost of the grays
+    bool cleanup;
+    M5.EPD.UpdateArea(0, COVER_Y, canvas.width(), COVER_SIZE, WaveformScheduler::next_mode(RegionCover, true, cleanup));
+    frame.cover_key = 0;
+    frame_changed = true;
+}
+
+///
+/// true if the panel still shows the cover with this key
+///
+bool epd_cover_shown(uint32_t key)
+{
+    return (key != 0) && (load_frame().cover_key == key);
+}
+
+///
+/// keep the frame state over the power off of M5.shutdown(), only written if it changed
+///
+void epd_save_state()
+{
+    WaveformScheduler::save(frame_changed);
+    if (!frame_changed) {
+        return;
+    }
+    if (!frame_state.save()) {
+        DPRINT("epd prefs error");
+        return;
+    }
+    frame_changed = false;
+}
+
+static void draw_menu_line(const MENULINE* l, bool selected)
+{
+    String text = TextLayout::to_glyphs(l->text).c_str();
+    if (selected) {
+        canvas.setTextColor(0, 15);
+        canvas.drawString(text, l->x, l->y);
+        canvas.setTextColor(15, 0);
+    } else {
+        canvas.drawString(text, l->x, l->y);
+    }
+}
+
+///
+/// the band of line i in the canvas, from the bitmap or else rendered (and then kept)
+///
+static void restore_menu_line(const MenuLines& lines, int i, bool selected, MenuBitmap& bitmap)
+{
+    auto l = lines[i];
+    // the band of the line, 4 pixel aligned for the controller
+    int y = (l->y - MENU_LINE_MARGIN) & ~3;
+    if (y + MENU_LINE_HEIGHT > canvas.height()) {
+        return;
+    }
+    size_t stride = canvas.width() / 2;
+    auto band = (uint8_t*)canvas.frameBuffer() + (y * stride);
+    size_t size = MENU_LINE_HEIGHT * stride;
+    auto page = bitmap.get_page();
+    auto cached = selected ? bitmap.get_line(i) : (page != NULL ? page + (y * stride) : NULL);
+    if (cached != NULL) {
+        memcpy(band, cached, size);
+        return;
+    }
+    canvas.fillRect(0, y, canvas.width(), MENU_LINE_HEIGHT, 0);
+    draw_menu_line(l, selected);
+    if (selected && (page != NULL)) {
+        bitmap.set_line(i, band, size);
+    }
+}
+
+///
+/// a menu page with one line selected: rendered once, later copied from the bitmap
+///
+void epd_draw_menu(const MenuLines& lines, const int selected, MenuBitmap& bitmap)
+{
+    auto fb = (uint8_t*)canvas.frameBuffer();
+    size_t size = (canvas.width() * canvas.height()) / 2;
+    if (bitmap.get_page() != NULL) {
+        memcpy(fb, bitmap.get_page(), size);
+    } else {
+        canvas.clear();
+        canvas.setCursor(0, 0);
+        for (auto l : lines) {
+            DPRINT(l->text);
+            draw_menu_line(l, false);
+        }
+        if (bitmap.is_enabled() && !bitmap.set_page(fb, size)) {
+            DPRINT("no PSRAM for the menu bitmap");
         }
     }
-    canvas.pushCanvas(0, CANVAS_Y, UPDATE_MODE_A2);
+    if ((selected >= 0) && (selected < (int)lines.size())) {
+        restore_menu_line(lines, selected, true, bitmap);
+    }
+    bool cleanup;
+    canvas.pushCanvas(0, CANVAS_Y, WaveformScheduler::next_mode(RegionCanvas, false, cleanup));
+    invalidate_frame();
+}
+
+///
+/// move the highlight of a menu drawn by epd_draw_menu(): only the two lines are
+/// restored and pushed
+///
+void epd_draw_menu_selection(const MenuLines& lines, const int previous, const int selected, MenuBitmap& bitmap)
+{
+    bool cleanup;
+    auto mode = WaveformScheduler::next_mode(RegionCanvas, false, cleanup);
+    auto fb = (const uint8_t*)canvas.frameBuffer();
+    const int indexes[] = { previous, selected };
+    for (auto i : indexes) {
+        if ((i < 0) || (i >= (int)lines.size())) {
+            continue;
+        }
+        restore_menu_line(lines, i, i == selected, bitmap);
+        int y = (lines[i]->y - MENU_LINE_MARGIN) & ~3;
+        if (!cleanup && (y + MENU_LINE_HEIGHT <= canvas.height())) {
+            M5.EPD.WritePartGram4bpp(0, CANVAS_Y + y, canvas.width(), MENU_LINE_HEIGHT, fb + (y * canvas.width() / 2));
+            M5.EPD.UpdateArea(0, CANVAS_Y + y, canvas.width(), MENU_LINE_HEIGHT, mode);
+        }
+    }
+    if (cleanup) {
+        // the whole menu with the cleanup waveform
+        canvas.pushCanvas(0, CANVAS_Y, mode);
+    }
 }
 
 void epd_print_bottomline(const String& s)
 {
     DPRINT(s);
     bottomline.clear();
-    bottomline.drawString(s, 10, 0);
-    bottomline.pushCanvas(0, BOTTOMLINE_Y, UPDATE_MODE_DU4);
+    bottomline.drawString(TextLayout::to_glyphs(s.c_str()).c_str(), 10, 0);
+    bool cleanup;
+    bottomline.pushCanvas(0, BOTTOMLINE_Y, WaveformScheduler::next_mode(RegionBottomline, false, cleanup));
 }
@@ -0,0 +1,108 @@
+// Copyright (c) 2023 @dheijl (danny.heijl@telenet.be)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "epdmode.h"
+
+#include "config.h"
+#include "rtcstate.h"
+#include "utils.h"
+
+static const constexpr char* NVS_EPD_MODE = "epdmode";
+static const uint32_t RTC_MODE_MAGIC = 0x45504d31;
+static const constexpr char* region_names[EPD_REGION_COUNT] = { "topline", "canvas", "bottomline", "cover" };
+// fast updates before a GC16: the status canvas changes every minute while playing
+static const uint16_t fast_update_limit[EPD_REGION_COUNT] = { 60, 120, 60, 10 };
+// the fast waveform of a region for black and white content
+static const m5epd_update_mode_t fast_mode[EPD_REGION_COUNT] = { UPDATE_MODE_DU, UPDATE_MODE_A2, UPDATE_MODE_DU, UPDATE_MODE_DU };
+
+RTC_DATA_ATTR static EPD_MODE_STATE rtc_mode;
+static RtcNvsState<EPD_MODE_STATE> mode_state(rtc_mode, rtc_mode.magic, NVS_EPD_MODE, "state", RTC_MODE_MAGIC);
+static bool mode_changed = false;
+// fast updates counted in this wake and not yet written
+static uint16_t unsaved_updates = 0;
+
+static EPD_MODE_STATE& load_state()
+{
+    return mode_state.load();
+}
+
+///
+/// the quiet hour cleanup marks every region as due once a day
+///
+static EPD_MODE_STATE& check_quiet_hour()
+{
+    auto& state = load_state();
+    uint32_t now = get_rtc_seconds();
+    uint16_t today = now / 86400;
+    if ((((now / 3600) % 24) == EPD_QUIET_HOUR) && (state.cleanup_day != today)) {
+        // nobody is looking: clean every region on its next update
+        for (int i = 0; i < EPD_REGION_COUNT; ++i) {
+            state.fast_updates[i] = fast_update_limit[i];
+        }
+        state.cleanup_day = today;
+        mode_changed = true;
+    }
+    return state;
+}
+
+bool WaveformScheduler::cleanup_due(EpdRegion region)
+{
+    auto& state = check_quiet_hour();
+    return state.fast_updates[region] >= fast_update_limit[region];
+}
+
+m5epd_update_mode_t WaveformScheduler::next_mode(EpdRegion region, bool grayscale, bool& cleanup)
+{
+    auto& state = check_quiet_hour();
+    cleanup = state.fast_updates[region] >= fast_update_limit[region];
+    if (cleanup) {
+        DPRINT(String(region_names[region]) + ": GC16 after " + String(state.fast_updates[region]) + " fast updates");
+        state.fast_updates[region] = 0;
+        mode_changed = true;
+        return UPDATE_MODE_GC16;
+    }
+    ++state.fast_updates[region];
+    ++unsaved_updates;
+    return grayscale ? UPDATE_MODE_GL16 : fast_mode[region];
+}
+
+void WaveformScheduler::reset()
+{
+    auto& state = load_state();
+    memset(state.fast_updates, 0, sizeof(state.fast_updates));
+    mode_changed = true;
+}
+
+///
+/// written with the frame state, after a GC16, a reset or a new cleanup day, or once
+/// EPD_MODE_SAVE_EVERY fast updates are pending: the few updates of a wake that
+/// changes nothing on the panel are lost on a power off
+///
+void WaveformScheduler::save(bool frame_written)
+{
+    if (!mode_changed && ((unsaved_updates == 0) || (!frame_written && (unsaved_updates < EPD_MODE_SAVE_EVERY)))) {
+        return;
+    }
+    if (!mode_state.save()) {
+        DPRINT("epdmode prefs error");
+        return;
+    }
+    mode_changed = false;
+    unsaved_updates = 0;
+}
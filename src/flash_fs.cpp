@@ -30,6 +30,7 @@
 
 static const constexpr char* NVS_WIFI = "wifi";
 static const constexpr char* NVS_PLAYERS = "players";
+static const constexpr char* NVS_DISCOVERED = "discovered";
 static const constexpr char* NVS_FAVS = "favs";
 static const constexpr char* NVS_CUR_MPD = "curmpd";
 
@@ -50,6 +51,12 @@ bool NVS_Config::write_wifi(const NETWORK_CFG& nw_cfg)
     result = prefs.putString("psw", nw_cfg.psw) > 0;
     result = prefs.putString("ntp_server", nw_cfg.ntp_server) > 0;
     result = prefs.putString("tz", nw_cfg.tz) > 0;
+    // the other networks as ssid1/psw1, ssid2/psw2, ...
+    for (size_t i = 1; result && (i < nw_cfg.networks.size()); ++i) {
+        string n = std::to_string(i);
+        result = prefs.putString(("ssid" + n).c_str(), nw_cfg.networks[i].ssid) > 0;
+        result = result && (prefs.putString(("psw" + n).c_str(), nw_cfg.networks[i].psw) > 0);
+    }
     if (!result) {
         epd_print_topline("wifi prefs put error");
         vTaskDelay(2000);
@@ -71,6 +78,16 @@ bool NVS_Config::read_wifi(NETWORK_CFG& nw_cfg)
     String psw = prefs.getString("psw");
     String ntp_server = prefs.getString("ntp_server");
     String tz = prefs.getString("tz");
+    WIFI_NETWORKS networks;
+    for (size_t i = 1; i < MAX_NETWORKS; ++i) {
+        string n = std::to_string(i);
+        String extra_ssid = prefs.getString(("ssid" + n).c_str());
+        String extra_psw = prefs.getString(("psw" + n).c_str());
+        if (extra_ssid.isEmpty()) {
+            break;
+        }
+        networks.push_back(WIFI_NETWORK { strdup(extra_ssid.c_str()), strdup(extra_psw.c_str()) });
+    }
     prefs.end();
     DPRINT(ssid + "|" + psw);
     if (ssid.isEmpty() || psw.isEmpty()) {
@@ -85,16 +102,19 @@ bool NVS_Config::read_wifi(NETWORK_CFG& nw_cfg)
     nw_cfg.psw = strdup(psw.c_str());
     nw_cfg.ntp_server = strdup(ntp_server.c_str());
     nw_cfg.tz = strdup(tz.c_str());
+    nw_cfg.networks.clear();
+    nw_cfg.networks.push_back(WIFI_NETWORK { nw_cfg.ssid, nw_cfg.psw });
+    nw_cfg.networks.insert(nw_cfg.networks.end(), networks.begin(), networks.end());
     DPRINT("Wifi config: " + String(nw_cfg.ssid) + "|" + String(nw_cfg.psw));
     DPRINT("NTP config: " + String(nw_cfg.ntp_server) + "|" + String(nw_cfg.tz));
     return true;
 }
 
-bool NVS_Config::write_players(const PLAYERS& players)
+static bool write_player_list(const char* nvs_namespace, const PLAYERS& players)
 {
     Preferences prefs;
     bool result = false;
-    if (!prefs.begin(NVS_PLAYERS, false)) {
+    if (!prefs.begin(nvs_namespace, false)) {
         epd_print_topline("players prefs begin error");
         prefs.end();
         vTaskDelay(2000);
@@ -120,11 +140,15 @@ bool NVS_Config::write_players(const PLAYERS& players)
     return result;
 }
 
-bool NVS_Config::read_players(PLAYERS& players)
+static bool read_player_list(const char* nvs_namespace, PLAYERS& players, bool required)
 {
     Preferences prefs;
     bool result = false;
-    if (!prefs.begin(NVS_PLAYERS, true)) {
+    if (!prefs.begin(nvs_namespace, true)) {
+        if (!required) {
+            // optional list that was never written
+            return result;
+        }
         epd_print_topline("players prefs begin error");
         prefs.end();
         vTaskDelay(2000);
@@ -159,6 +183,26 @@ bool NVS_Config::read_players(PLAYERS& players)
     return result;
 }
 
+bool NVS_Config::write_players(const PLAYERS& players)
+{
+    return write_player_list(NVS_PLAYERS, players);
+}
+
+bool NVS_Config::read_players(PLAYERS& players)
+{
+    return read_player_list(NVS_PLAYERS, players, true);
+}
+
+bool NVS_Config::write_discovered_players(const PLAYERS& players)
+{
+    return write_player_list(NVS_DISCOVERED, players);
+}
+
+bool NVS_Config::read_discovered_players(PLAYERS& players)
+{
+    return read_player_list(NVS_DISCOVERED, players, false);
+}
+
 bool NVS_Config::write_favourites(const FAVOURITES& favourites)
 {
     Preferences prefs;
@@ -21,22 +21,29 @@
 
 #include <time.h>
 
+#include "backoff.h"
 #include "config.h"
 #include "epdfunctions.h"
 #include "menu.h"
 #include "mpdcli.h"
 #include "synctime.h"
 #include "utils.h"
+#include "wakebudget.h"
 #include "wifi_utils.h"
 
 static Menu menu;
 
 // 60 seconds WDT
 #define WDT_TIMEOUT 60
+// don't start talking to the player with less time than this left
+#define MIN_STATUS_BUDGET 500
+// a cover that is not in the SD card cache yet is only fetched with this much time left
+#define MIN_COVER_BUDGET 5000
 
 static bool restartByRTC = false;
 static bool is_playing = false;
 static int time_out = 0;
+static bool is_mains_mode = false;
 
 void setup()
 {
@@ -61,8 +68,11 @@ void setup()
     // start watchdog timer in case somethings hangs
     esp_task_wdt_init(WDT_TIMEOUT, true); // enable panic so ESP32 restarts
     esp_task_wdt_add(NULL); // add current thread to WDT watch
-    // setup EPD canvases
-    epd_init();
+    // the watchdog is the only bound on a power on, an RTC wake gets a much tighter budget
+    Budget.begin(restartByRTC ? WAKE_BUDGET_MS : WDT_TIMEOUT * 1000);
+    Budget.begin_phase(PhaseConfig);
+    // setup EPD canvases, a timer wake keeps the previous frame on the panel
+    epd_init(!restartByRTC);
     // try to load configuration from flash or SD
     while (!Config.load_config()) {
         epd_print_topline("No NVS-Config or SD-CONFIG");
@@ -70,8 +80,24 @@ void setup()
         M5.shutdown();
     }
     epd_print_topline("Config loaded");
+    Budget.end_phase();
 
-    if (!start_wifi()) {
+    if (restartByRTC && network_backoff()) {
+        // skip the network on this wake
+        StatusLines offline;
+        offline.push_back(get_date_time());
+        offline.push_back(get_status());
+        offline.push_back(" ");
+        offline.push_back(offline_since());
+        epd_print_canvas(offline);
+        shutdown_and_wake();
+    }
+    // after a failure a single attempt is enough, the backoff takes care of the rest
+    uint32_t wifi_budget = Budget.begin_phase(PhaseWifi);
+    bool wifi_ok = (wifi_budget > 0) && start_wifi(network_failures() > 0 ? 1 : 5, wifi_budget);
+    Budget.end_phase();
+    if (!wifi_ok) {
+        record_network_result(NetworkNoWifi);
         vTaskDelay(500);
         shutdown_and_wake();
     }
@@ -80,8 +106,41 @@ void setup()
         sync_time();
     }
 
-    auto res = mpd.show_mpd_status();
+    // a .local name may take two mDNS queries
+    Config.set_resolve_timeout(max(Budget.begin_phase(PhaseResolve) / 2, (uint32_t)1));
+    Config.get_active_mpd();
+    Budget.end_phase();
+    StatusLines res;
+    uint32_t status_budget = Budget.begin_phase(PhaseStatus);
+    if (status_budget >= MIN_STATUS_BUDGET) {
+        mpd.set_deadline(status_budget);
+        res = mpd.show_mpd_status();
+        record_network_result(mpd.is_reachable() ? NetworkOk : NetworkNoPlayer);
+        if (network_failures() > 0) {
+            res.push_back(offline_since());
+        }
+    } else {
+        // degraded: no time left to ask the player, just show the local status
+        res.push_back(get_date_time());
+        res.push_back(get_status());
+        res.push_back(" ");
+        res.push_back("Wake budget exceeded");
+    }
+    Budget.end_phase();
+    Budget.begin_phase(PhaseRender);
     epd_print_canvas(res);
+    if (mpd.is_reachable()) {
+        // a wake that already overran only shows a cached cover
+        bool fetch = !Budget.degraded() && (Budget.remaining() >= MIN_COVER_BUDGET);
+        mpd.set_deadline(max(Budget.remaining(), (uint32_t)1));
+        mpd.show_album_art(fetch);
+    } else {
+        epd_hide_cover();
+    }
+    Budget.end_phase();
+    // the menu and live updates are not bound by the wake budget
+    mpd.set_deadline(0);
+    Config.set_resolve_timeout(0);
     if (restartByRTC) {
         stop_wifi(true);
         vTaskDelay(200);
@@ -100,8 +159,24 @@ void loop()
 {
     if (time_out > 60) {
         esp_task_wdt_reset();
-        stop_wifi(true);
-        shutdown_and_wake();
+        time_out = 0;
+        if (on_battery()) {
+            mpd.set_persistent(false);
+            stop_wifi(true);
+            shutdown_and_wake();
+        }
+        // on USB power: stay awake with an open connection and let MPD tell us about changes
+        if (!is_mains_mode) {
+            is_mains_mode = true;
+            epd_print_bottomline("USB power: live updates");
+            mpd.set_persistent(true);
+        }
+        mpd.start_idle();
+    }
+    if (is_mains_mode && mpd.check_idle()) {
+        auto res = mpd.show_mpd_status();
+        epd_print_canvas(res);
+        mpd.show_album_art();
     }
     M5.update();
     if (M5.BtnL.wasPressed() || M5.BtnP.wasPressed() || M5.BtnR.wasPressed()) {
@@ -112,8 +187,11 @@ void loop()
         vTaskDelay(500);
         auto res = mpd.show_mpd_status();
         epd_print_canvas(res);
+        mpd.show_album_art();
         epd_print_bottomline("Press any button for Menu");
-        stop_wifi(false);
+        if (!is_mains_mode) {
+            stop_wifi(false);
+        }
         time_out = 0;
     }
     vTaskDelay(100);
@@ -0,0 +1,107 @@
+// Copyright (c) 2023 @dheijl (danny.heijl@telenet.be)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "mdnscache.h"
+
+#include "config.h"
+#include "rtcstate.h"
+#include "utils.h"
+
+static const constexpr char* NVS_MDNS = "mdns";
+static const uint32_t RTC_CACHE_MAGIC = 0x4d444e53;
+
+RTC_DATA_ATTR static uint32_t rtc_magic = 0;
+RTC_DATA_ATTR static MDNS_CACHE_ENTRY rtc_cache[MDNS_CACHE_SIZE];
+static RtcNvsState<MDNS_CACHE_ENTRY[MDNS_CACHE_SIZE]> cache_state(rtc_cache, rtc_magic, NVS_MDNS, "cache", RTC_CACHE_MAGIC);
+
+static void load_cache()
+{
+    cache_state.load();
+}
+
+static void save_cache()
+{
+    if (!cache_state.save()) {
+        DPRINT("mdns prefs error");
+    }
+}
+
+///
+/// compared as stored: a name longer than the host field matches on what fits
+///
+static MDNS_CACHE_ENTRY* find_entry(const char* host)
+{
+    for (auto& entry : rtc_cache) {
+        if ((entry.host[0] != '\0') && (strncmp(entry.host, host, sizeof(entry.host) - 1) == 0)) {
+            return &entry;
+        }
+    }
+    return NULL;
+}
+
+///
+/// the cached ip of host, if it was resolved less than MDNS_CACHE_TTL ago
+///
+bool MDNS_Cache::lookup(const char* host, IPAddress& ip)
+{
+    load_cache();
+    auto entry = find_entry(host);
+    if ((entry == NULL) || (entry->ip == 0)) {
+        return false;
+    }
+    uint32_t age = get_rtc_seconds() - entry->resolved_at;
+    if (age > MDNS_CACHE_TTL) {
+        DPRINT("mdns cache expired: " + String(host));
+        return false;
+    }
+    ip = IPAddress(entry->ip);
+    return true;
+}
+
+void MDNS_Cache::store(const char* host, const IPAddress& ip)
+{
+    load_cache();
+    auto entry = find_entry(host);
+    if (entry == NULL) {
+        // reuse an empty slot, or else the oldest one
+        entry = &rtc_cache[0];
+        for (auto& e : rtc_cache) {
+            if ((e.host[0] == '\0') || (e.resolved_at < entry->resolved_at)) {
+                entry = &e;
+                if (e.host[0] == '\0') {
+                    break;
+                }
+            }
+        }
+        strlcpy(entry->host, host, sizeof(entry->host));
+    }
+    entry->ip = (uint32_t)ip;
+    entry->resolved_at = get_rtc_seconds();
+    save_cache();
+}
+
+void MDNS_Cache::forget(const char* host)
+{
+    load_cache();
+    auto entry = find_entry(host);
+    if ((entry != NULL) && (entry->ip != 0)) {
+        entry->ip = 0;
+        save_cache();
+    }
+}
@@ -22,17 +22,44 @@
 #include "flash_fs.h"
 #include "menu.h"
 #include "mpdcli.h"
+#include "wifi_utils.h"
 
 void Menu::toggle_start_stop()
 {
     mpd.toggle_mpd_status();
 }
 
+void Menu::create_player_menu()
+{
+    DPRINT("Creating PLAYER menu");
+    auto players = Config.getPlayers();
+    this->PlayerMenu.clear();
+    this->PlayerMenu.reserve(players.size() + 2);
+    for (auto p : players) {
+        this->PlayerMenu.add_line(p->player_name);
+    }
+    this->PlayerMenu.add_line("Discover players");
+    this->PlayerMenu.add_line("Return");
+    DPRINT("Player menu lines: " + String(PlayerMenu.size()));
+}
+
 void Menu::select_player()
 {
     auto players = Config.getPlayers();
     int selected = this->PlayerMenu.display_menu();
-    if ((selected >= 0) && (selected < players.size())) {
+    if (selected == (int)players.size()) {
+        epd_print_bottomline("Discovering players...");
+        if (!start_wifi()) {
+            return;
+        }
+        int added = Config.discover_players();
+        if (added < 0) {
+            epd_print_bottomline("Discovery failed");
+        } else {
+            epd_print_bottomline("Discovered " + String(added) + " new players");
+            this->create_player_menu();
+        }
+    } else if ((selected >= 0) && (selected < players.size())) {
         auto pl = players[selected]->player_name;
         epd_print_bottomline("New player @" + String(pl));
         Config.set_player_index((uint16_t)selected);
@@ -40,15 +67,197 @@ void Menu::select_player()
     }
 }
 
-void Menu::select_favourite(int page)
+void Menu::browse_queue()
+{
+    int page = 0;
+    while (true) {
+        epd_print_bottomline("Loading queue...");
+        auto qp = mpd.get_queue_page(page);
+        if (qp == NULL) {
+            epd_print_bottomline("Queue not available");
+            return;
+        }
+        uint32_t length = mpd.get_queue_length();
+        epd_print_bottomline("Queue " + String(page * QUEUE_PAGE_SIZE + 1) + "-" + String(page * QUEUE_PAGE_SIZE + qp->count) + " of " + String(length));
+        SubMenu queue_menu(40, false);
+        queue_menu.reserve(qp->count + 3);
+        for (int i = 0; i < qp->count; ++i) {
+            queue_menu.add_line(qp->entries[i].title);
+        }
+        queue_menu.add_line("Previous page");
+        queue_menu.add_line("Next page");
+        queue_menu.add_line("Return");
+        int selected = queue_menu.display_menu();
+        if ((selected >= 0) && (selected < qp->count)) {
+            mpd.play_queue_pos(qp->entries[selected].pos);
+            return;
+        } else if (selected == qp->count) {
+            page = page > 0 ? page - 1 : 0;
+        } else if (selected == qp->count + 1) {
+            if ((uint32_t)((page + 1) * QUEUE_PAGE_SIZE) < length) {
+                ++page;
+            }
+        } else {
+            return;
+        }
+    }
+}
+
+///
+/// page through album artists (level 0), the albums of an artist (1) or the songs
+/// of an album (2), returns false if the user returned without a selection
+///
+bool Menu::select_library_entry(int level, const MPD_LIBRARY_ENTRY* artist, const MPD_LIBRARY_ENTRY* album, MPD_LIBRARY_ENTRY& picked)
+{
+    uint32_t offset = 0;
+    while (true) {
+        epd_print_bottomline("Loading library...");
+        const MPD_LIBRARY_PAGE* lp = NULL;
+        if (level == 0) {
+            lp = mpd.library_list("albumartist", NULL, NULL, offset);
+        } else if (level == 1) {
+            lp = mpd.library_list("album", "albumartist", artist->uri, offset);
+        } else {
+            lp = mpd.library_find("albumartist", artist->uri, "album", album->uri, offset);
+        }
+        if (lp == NULL) {
+            epd_print_bottomline("Library not available");
+            return false;
+        }
+        epd_print_bottomline("Library " + String(offset + 1) + "-" + String(offset + lp->count) + (lp->more ? " ..." : ""));
+        SubMenu library_menu(40, false);
+        library_menu.reserve(lp->count + 3);
+        for (int i = 0; i < lp->count; ++i) {
+            library_menu.add_line(lp->entries[i].name);
+        }
+        library_menu.add_line("Previous page");
+        library_menu.add_line("Next page");
+        library_menu.add_line("Return");
+        int selected = library_menu.display_menu();
+        if ((selected >= 0) && (selected < lp->count)) {
+            picked = lp->entries[selected];
+            return true;
+        } else if (selected == lp->count) {
+            offset = offset >= LIBRARY_PAGE_SIZE ? offset - LIBRARY_PAGE_SIZE : 0;
+        } else if (selected == lp->count + 1) {
+            if (lp->more) {
+                offset += LIBRARY_PAGE_SIZE;
+            }
+        } else {
+            return false;
+        }
+    }
+}
+
+void Menu::browse_library()
+{
+    MPD_LIBRARY_ENTRY artist;
+    MPD_LIBRARY_ENTRY album;
+    MPD_LIBRARY_ENTRY song;
+    while (this->select_library_entry(0, NULL, NULL, artist)) {
+        while (this->select_library_entry(1, &artist, NULL, album)) {
+            if (this->select_library_entry(2, &artist, &album, song)) {
+                mpd.play_library_song(song.uri);
+                return;
+            }
+        }
+    }
+}
+
+void Menu::show_dashboard()
+{
+    epd_print_bottomline("Querying all players...");
+    auto res = mpd.show_dashboard();
+    epd_print_canvas(res);
+    epd_print_bottomline("Press any button to return");
+    // keep the dashboard on screen until a button is pressed (or 30 seconds)
+    for (int i = 0; i < 300; ++i) {
+        M5.update();
+        if (M5.BtnL.wasPressed() || M5.BtnP.wasPressed() || M5.BtnR.wasPressed()) {
+            break;
+        }
+        vTaskDelay(100);
+    }
+    esp_task_wdt_reset();
+}
+
+const FAVOURITE* Menu::pick_favourite(int page)
 {
     auto favs = Config.getFavourites();
     auto fav_menu = this->FavouriteMenus[page];
     int selected = fav_menu->display_menu();
     if ((selected >= 0) && (selected < fav_menu->size() - 1)) {
-        selected = (page * Menu::MAXLINES) + selected;
-        FAVOURITE& fav = *favs[selected];
-        mpd.play_favourite(fav);
+        return favs[(page * Menu::MAXLINES) + selected];
+    }
+    return NULL;
+}
+
+void Menu::select_favourite(int page)
+{
+    auto fav = this->pick_favourite(page);
+    if (fav != NULL) {
+        mpd.play_favourite(*fav);
+    }
+}
+
+///
+/// tick the players of a group, then start a favourite on all of them at once
+///
+void Menu::play_group()
+{
+    auto players = Config.getPlayers();
+    if (this->FavouriteMenus.empty() || players.empty()) {
+        return;
+    }
+    vector<bool> in_group(players.size(), false);
+    if (Config.get_player_index() < players.size()) {
+        in_group[Config.get_player_index()] = true;
+    }
+    // a favourites page by its first favourite
+    vector<String> pages;
+    pages.reserve(this->FavouriteMenus.size());
+    for (auto favmenu : this->FavouriteMenus) {
+        pages.push_back("Favourites: " + String(favmenu->line(0)) + (favmenu->size() > 2 ? " ..." : ""));
+    }
+    while (true) {
+        vector<String> names;
+        names.reserve(players.size());
+        SubMenu group_menu(40, false);
+        group_menu.reserve(players.size() + pages.size() + 1);
+        for (size_t i = 0; i < players.size(); ++i) {
+            names.push_back((in_group[i] ? "[x] " : "[ ] ") + String(players[i]->player_name));
+            group_menu.add_line(names[i].c_str());
+        }
+        for (auto& page : pages) {
+            group_menu.add_line(page.c_str());
+        }
+        group_menu.add_line("Return");
+        epd_print_bottomline("Tick players, then pick favourites");
+        int selected = group_menu.display_menu();
+        if ((selected >= 0) && (selected < (int)players.size())) {
+            in_group[selected] = !in_group[selected];
+            continue;
+        }
+        int page = selected - players.size();
+        if ((page < 0) || (page >= (int)this->FavouriteMenus.size())) {
+            return;
+        }
+        vector<uint16_t> group;
+        for (size_t i = 0; i < players.size(); ++i) {
+            if (in_group[i]) {
+                group.push_back((uint16_t)i);
+            }
+        }
+        if (group.empty()) {
+            epd_print_bottomline("No players selected");
+            continue;
+        }
+        auto fav = this->pick_favourite(page);
+        if (fav != NULL) {
+            epd_print_bottomline("Starting " + String(group.size()) + " players...");
+            epd_print_canvas(mpd.play_group(group, *fav));
+        }
+        return;
     }
 }
 
@@ -61,8 +270,16 @@ void Menu::Show()
         this->toggle_start_stop();
     } else if (selected == 1) {
         this->select_player();
-    } else if (selected <= (1 + npages)) {
-        this->select_favourite(selected - 2);
+    } else if (selected == 2) {
+        this->browse_queue();
+    } else if (selected == 3) {
+        this->browse_library();
+    } else if (selected == 4) {
+        this->show_dashboard();
+    } else if (selected == 5) {
+        this->play_group();
+    } else if (selected <= (5 + npages)) {
+        this->select_favourite(selected - 6);
     }
 }
 
@@ -73,6 +290,10 @@ void Menu::CreateMenus()
     static const constexpr char* mlines[] {
         "Start/Stop Play",
         "Select Player",
+        "Queue",
+        "Library",
+        "All Players",
+        "Group Play",
         "Favourites 1",
         "Favourites 2",
         "Favourites 3",
@@ -84,21 +305,13 @@ void Menu::CreateMenus()
     int nfavs = favs.size();
     int npages = (nfavs % Menu::MAXLINES) == 0 ? (nfavs / Menu::MAXLINES) : (nfavs / Menu::MAXLINES) + 1;
     npages = min(npages, 5);
-    this->MainMenu.reserve(npages + 3);
-    for (int i = 0; i <= npages + 1; i++) {
+    this->MainMenu.reserve(npages + 7);
+    for (int i = 0; i <= npages + 5; i++) {
         this->MainMenu.add_line(mlines[i]);
     }
-    this->MainMenu.add_line(mlines[7]);
+    this->MainMenu.add_line(mlines[11]);
     DPRINT("Main menu lines: " + String(MainMenu.size()));
-    // player menu
-    DPRINT("Creating PLAYER menu");
-    auto players = Config.getPlayers();
-    this->PlayerMenu.reserve(players.size() + 1);
-    for (auto p : players) {
-        this->PlayerMenu.add_line(p->player_name);
-    }
-    this->PlayerMenu.add_line("Return");
-    DPRINT("Player menu lines: " + String(MainMenu.size()));
+    this->create_player_menu();
     // favourites Menus
     this->FavouriteMenus.reserve(npages + 1);
     for (int page = 0; page < npages; ++page) {
@@ -123,12 +336,18 @@ int SubMenu::display_menu()
 {
     int selected = 0;
     int oldselected = -1;
+    int shown = -1; // selection on the panel
     bool repaint = true;
     while (true) {
         vTaskDelay(5);
         if (repaint) {
             repaint = false;
-            epd_draw_menu(this->lines, selected);
+            if (shown < 0) {
+                epd_draw_menu(this->lines, selected, this->bitmap);
+            } else if (shown != selected) {
+                epd_draw_menu_selection(this->lines, shown, selected, this->bitmap);
+            }
+            shown = selected;
             esp_task_wdt_reset();
         }
         M5.update();
@@ -0,0 +1,134 @@
+// Copyright (c) 2023 @dheijl (danny.heijl@telenet.be)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#include "menubitmap.h"
+
+// every live bitmap, to find the least recently used one
+static vector<MenuBitmap*> bitmaps;
+static size_t total_bytes = 0;
+static uint32_t use_clock = 0;
+
+MenuBitmap::MenuBitmap(bool enabled)
+    : enabled(enabled)
+    , page(NULL)
+    , bytes(0)
+    , last_used(0)
+{
+    bitmaps.push_back(this);
+}
+
+MenuBitmap::~MenuBitmap()
+{
+    this->clear();
+    for (auto it = bitmaps.begin(); it != bitmaps.end(); ++it) {
+        if (*it == this) {
+            bitmaps.erase(it);
+            break;
+        }
+    }
+}
+
+void MenuBitmap::touch()
+{
+    this->last_used = ++use_clock;
+}
+
+void MenuBitmap::clear()
+{
+    if (this->page != NULL) {
+        heap_caps_free(this->page);
+        this->page = NULL;
+    }
+    for (auto band : this->highlighted) {
+        if (band != NULL) {
+            heap_caps_free(band);
+        }
+    }
+    this->highlighted.clear();
+    total_bytes -= this->bytes;
+    this->bytes = 0;
+}
+
+const uint8_t* MenuBitmap::get_page()
+{
+    this->touch();
+    return this->page;
+}
+
+bool MenuBitmap::set_page(const uint8_t* pixels, size_t size)
+{
+    this->clear();
+    this->touch();
+    this->page = this->copy(pixels, size);
+    return this->page != NULL;
+}
+
+const uint8_t* MenuBitmap::get_line(size_t i)
+{
+    this->touch();
+    return i < this->highlighted.size() ? this->highlighted[i] : NULL;
+}
+
+bool MenuBitmap::set_line(size_t i, const uint8_t* pixels, size_t size)
+{
+    this->touch();
+    if (i >= this->highlighted.size()) {
+        this->highlighted.resize(i + 1, NULL);
+    }
+    if (this->highlighted[i] == NULL) {
+        this->highlighted[i] = this->copy(pixels, size);
+    }
+    return this->highlighted[i] != NULL;
+}
+
+///
+/// drop the least recently used other bitmaps until size more bytes fit the budget
+///
+void MenuBitmap::make_room(size_t size)
+{
+    while (total_bytes + size > MENU_BITMAP_BUDGET) {
+        MenuBitmap* lru = NULL;
+        for (auto bitmap : bitmaps) {
+            if ((bitmap != this) && (bitmap->bytes > 0) && ((lru == NULL) || ((int32_t)(bitmap->last_used - lru->last_used) < 0))) {
+                lru = bitmap;
+            }
+        }
+        if (lru == NULL) {
+            // only this one is left: let it grow
+            return;
+        }
+        lru->clear();
+    }
+}
+
+uint8_t* MenuBitmap::copy(const uint8_t* pixels, size_t size)
+{
+    if (!this->enabled) {
+        return NULL;
+    }
+    this->make_room(size);
+    auto p = (uint8_t*)heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+    if (p != NULL) {
+        memcpy(p, pixels, size);
+        this->bytes += size;
+        total_bytes += size;
+    }
+    return p;
+}
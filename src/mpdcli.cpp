@@ -20,11 +20,39 @@
 #include <M5EPD.h>
 
 #include "config.h"
+#include "covercache.h"
+#include "imgdither.h"
 #include "mpdcli.h"
+#include "mpdmulti.h"
 #include "utils.h"
 #include "wifi_utils.h"
 
+#ifdef DEBUGMPDRECORD
+#include "mpdrecord.h"
+#include "sdcard_fs.h"
+
+class SDRecordingTransport : public RecordingTransport {
+public:
+    SDRecordingTransport(MpdTransport* inner)
+        : RecordingTransport(inner)
+    {
+    }
+    bool connect(const char* host, uint16_t port) override
+    {
+        // keeps the card mounted for the rest of the session
+        if (!this->is_open() && SD_Config::mount()) {
+            this->open("/sd/mpd.rec");
+        }
+        return RecordingTransport::connect(host, port);
+    }
+};
+
+static MpdDefaultTransport wire;
+static SDRecordingTransport recorder(&wire);
+static MPD_Client _mpd(&recorder);
+#else
 static MPD_Client _mpd;
+#endif
 MPD_Client& mpd = _mpd;
 
 String MPD_Client::show_player(MPD_PLAYER& player)
@@ -32,28 +60,41 @@ String MPD_Client::show_player(MPD_PLAYER& player)
     return ("Player: " + String(player.player_name));
 }
 
+///
+/// connect to the player, or reuse the open connection in persistent mode
+///
+bool MPD_Client::open_connection(const MPD_PLAYER& player)
+{
+    if (this->session.open(player.player_ip, player.player_port)) {
+        return true;
+    }
+    if (this->con.DeadlinePassed()) {
+        // no time left for an mDNS lookup, the next wake tries again
+        return false;
+    }
+    // the cached address may be stale
+    auto moved = Config.revalidate_player(player.player_hostname);
+    return (moved != NULL) && this->session.open(moved->player_ip, moved->player_port);
+}
+
+void MPD_Client::close_connection()
+{
+    this->session.close();
+}
+
 StatusLines& MPD_Client::toggle_mpd_status()
 {
     if (start_wifi()) {
+        this->begin_op();
         auto player = Config.get_active_mpd();
         this->status.clear();
         this->status.push_back(show_player(player));
-        if (this->con.Connect(player.player_ip, player.player_port)) {
-            this->appendStatus(this->con.GetResponse());
-            if (this->con.IsPlaying()) {
-                this->appendStatus(this->con.GetResponse());
-                this->status.push_back("Stop playing");
-                this->appendStatus(this->con.GetResponse());
-                this->con.Stop();
-                this->appendStatus(this->con.GetResponse());
-            } else {
-                this->status.push_back("Start playing");
-                this->con.Play();
-                this->appendStatus(this->con.GetResponse());
-            }
-            this->con.Disconnect();
-            this->appendStatus(this->con.GetResponse());
+        if (this->open_connection(player)) {
+            MpdStatusLines lines;
+            this->session.toggle(lines);
+            this->appendStatus(lines);
         }
+        this->end_op("toggle");
         return this->status;
     } else {
         this->status.clear();
@@ -67,25 +108,18 @@ StatusLines& MPD_Client::show_mpd_status()
     this->status.push_back(get_date_time());
     this->status.push_back(get_status());
     this->status.push_back(" ");
+    this->reachable = false;
     if (start_wifi()) {
         auto player = Config.get_active_mpd();
         this->status.push_back(show_player(player));
-        if (this->con.Connect(player.player_ip, player.player_port)) {
-            this->appendStatus(this->con.GetResponse());
-            this->playing = this->con.GetStatus();
-            this->appendStatus(this->con.GetResponse());
-            this->con.GetCurrentSong();
-            this->appendStatus(this->con.GetResponse());
-            // attempt to capture the "Alsa underrun sending silence" error message
-            // but unfortunately it looks like mpd does only log the message, it never gets here
-            if (this->playing && (this->con.GetLastError().find("silence") != string::npos)) {
-                this->status.push_back("*ALSA XRUN -> restarting play");
-                this->con.Stop();
-                this->con.Play();
-            }
-            this->con.Disconnect();
-            this->appendStatus(this->con.GetResponse());
+        this->begin_op();
+        this->reachable = this->open_connection(player);
+        if (this->reachable) {
+            MpdStatusLines lines;
+            this->playing = this->session.status(lines);
+            this->appendStatus(lines);
         }
+        this->end_op("status");
     }
     return this->status;
 }
@@ -97,27 +131,357 @@ StatusLines& MPD_Client::play_favourite(const FAVOURITE& fav)
         auto player = Config.get_active_mpd();
         this->status.push_back(show_player(player));
         this->status.push_back("Play " + String(fav.fav_name));
-        if (this->con.Connect(player.player_ip, player.player_port)) {
-            this->appendStatus(this->con.GetResponse());
-            this->con.Clear();
-            this->appendStatus(this->con.GetResponse());
-            this->con.Add_Url(fav.fav_url);
-            this->appendStatus(this->con.GetResponse());
-            this->con.Play();
-            this->appendStatus(this->con.GetResponse());
-            this->con.Disconnect();
-            this->appendStatus(this->con.GetResponse());
+        this->begin_op();
+        if (this->open_connection(player)) {
+            epd_print_topline("add " + String(fav.fav_url));
+            MpdStatusLines lines;
+            this->session.play_url(fav.fav_url, lines);
+            this->appendStatus(lines);
+        }
+        this->end_op("play");
+    }
+    return this->status;
+}
+
+///
+/// a page of the queue: served from the cache if the playlist version did not change,
+/// otherwise fetched as a "playlistinfo start:end" window together with the status
+///
+const MPD_QUEUE_PAGE* MPD_Client::get_queue_page(int page)
+{
+    if (!start_wifi()) {
+        return NULL;
+    }
+    auto player = Config.get_active_mpd();
+    if (this->queue_player != player.player_name) {
+        this->queue_cache.invalidate();
+        this->queue_player = player.player_name;
+    }
+    MPD_QUEUE_PAGE* result = NULL;
+    this->begin_op();
+    if (this->open_connection(player)) {
+        MPD_STATUS_DATA state;
+        if (this->queue_cache.find(page) != NULL) {
+            if (this->con.GetQueueState(state)) {
+                this->queue_cache.set_version(state.playlist, state.playlistlength);
+                result = this->queue_cache.find(page);
+            }
+        }
+        if (result == NULL) {
+            uint32_t start = page * QUEUE_PAGE_SIZE;
+            auto slot = this->queue_cache.slot(page);
+            if (this->con.GetQueueWindow(start, start + QUEUE_PAGE_SIZE, state, slot->entries, QUEUE_PAGE_SIZE, slot->count)) {
+                this->queue_cache.set_version(state.playlist, state.playlistlength, slot);
+                result = slot;
+            } else {
+                this->queue_cache.invalidate();
+            }
+        }
+        this->close_connection();
+    }
+    this->end_op("queue");
+    return result;
+}
+
+uint32_t MPD_Client::get_queue_length()
+{
+    return this->queue_cache.get_length();
+}
+
+StatusLines& MPD_Client::play_queue_pos(uint32_t pos)
+{
+    this->status.clear();
+    if (start_wifi()) {
+        auto player = Config.get_active_mpd();
+        this->status.push_back(show_player(player));
+        this->status.push_back("Play #" + String(pos + 1));
+        this->begin_op();
+        if (this->open_connection(player)) {
+            MpdStatusLines lines;
+            this->session.play_pos(pos, lines);
+            this->appendStatus(lines);
         }
+        this->end_op("play");
     }
     return this->status;
 }
 
+bool MPD_Client::library_begin()
+{
+    if (!start_wifi()) {
+        return false;
+    }
+    auto player = Config.get_active_mpd();
+    this->begin_op();
+    if (!this->open_connection(player)) {
+        this->end_op("library");
+        return false;
+    }
+    return true;
+}
+
+void MPD_Client::library_end()
+{
+    this->close_connection();
+    this->end_op("library");
+}
+
+///
+/// a page of tag values, e.g. all album artists or the albums of one artist
+///
+const MPD_LIBRARY_PAGE* MPD_Client::library_list(const char* tag, const char* filter_tag, const char* filter_value, uint32_t offset)
+{
+    if (!this->library_begin()) {
+        return NULL;
+    }
+    this->library_page.offset = offset;
+    bool ok = this->con.ListTag(tag, filter_tag, filter_value, &this->library_page);
+    this->library_end();
+    return ok ? &this->library_page : NULL;
+}
+
+///
+/// a page of songs with exact tag matches
+///
+const MPD_LIBRARY_PAGE* MPD_Client::library_find(const char* tag1, const char* value1, const char* tag2, const char* value2, uint32_t offset)
+{
+    if (!this->library_begin()) {
+        return NULL;
+    }
+    this->library_page.offset = offset;
+    bool ok = this->con.FindSongs("find", tag1, value1, tag2, value2, &this->library_page);
+    this->library_end();
+    return ok ? &this->library_page : NULL;
+}
+
+StatusLines& MPD_Client::play_library_song(const char* uri)
+{
+    this->status.clear();
+    if (start_wifi()) {
+        auto player = Config.get_active_mpd();
+        this->status.push_back(show_player(player));
+        this->status.push_back("Play " + String(uri));
+        this->begin_op();
+        if (this->open_connection(player)) {
+            epd_print_topline("add " + String(uri));
+            MpdStatusLines lines;
+            this->session.play_url(uri, lines);
+            this->appendStatus(lines);
+        }
+        this->end_op("play");
+    }
+    return this->status;
+}
+
+///
+/// one line per configured player, all players are queried concurrently
+///
+StatusLines& MPD_Client::show_dashboard()
+{
+    static const uint32_t PLAYER_TIMEOUT = 3000;
+    this->status.clear();
+    this->status.push_back(get_date_time());
+    this->status.push_back(" ");
+    if (!start_wifi()) {
+        return this->status;
+    }
+    auto players = Config.getPlayers();
+    vector<PLAYER_JOB> jobs(players.size());
+    // mDNS lookups are not done concurrently
+    for (uint16_t i = 0; i < players.size(); ++i) {
+        jobs[i].player = &Config.resolve_player(i);
+        jobs[i].timeout_ms = PLAYER_TIMEOUT;
+        jobs[i].url = NULL;
+    }
+    uint32_t start = millis();
+    run_player_jobs(jobs.data(), jobs.size());
+    DPRINT("dashboard: " + String(millis() - start) + "ms");
+    for (auto& job : jobs) {
+        String line = String(job.player->player_name) + ": ";
+        if (!job.connected) {
+            line += "offline";
+        } else if (!job.ok) {
+            line += "no response";
+        } else if (job.status.state == MpdStatePlay) {
+            line += "> " + String(job.title);
+        } else if (job.status.state == MpdStatePause) {
+            line += "|| " + String(job.title);
+        } else {
+            line += "stopped";
+        }
+        this->status.push_back(line);
+    }
+    return this->status;
+}
+
+///
+/// start a favourite on a group of players at the same time
+///
+StatusLines& MPD_Client::play_group(const vector<uint16_t>& players, const FAVOURITE& fav)
+{
+    static const uint32_t PLAYER_TIMEOUT = 3000;
+    this->status.clear();
+    this->status.push_back("Group play " + String(fav.fav_name));
+    if (!start_wifi()) {
+        return this->status;
+    }
+    vector<PLAYER_JOB> jobs(players.size());
+    for (size_t i = 0; i < players.size(); ++i) {
+        jobs[i].player = &Config.resolve_player(players[i]);
+        jobs[i].timeout_ms = PLAYER_TIMEOUT;
+        jobs[i].url = fav.fav_url;
+    }
+    run_player_jobs(jobs.data(), jobs.size());
+    uint32_t first = 0;
+    uint32_t last = 0;
+    int started = 0;
+    for (auto& job : jobs) {
+        String line = String(job.player->player_name) + ": ";
+        if (!job.connected) {
+            line += "offline";
+        } else if (!job.ok) {
+            line += "failed";
+        } else {
+            line += "playing";
+            if ((started == 0) || ((int32_t)(job.play_us - first) < 0)) {
+                first = job.play_us;
+            }
+            if ((started == 0) || ((int32_t)(job.play_us - last) > 0)) {
+                last = job.play_us;
+            }
+            ++started;
+        }
+        this->status.push_back(line);
+    }
+    if (started > 1) {
+        this->status.push_back("Start skew: " + String((last - first) / 1000) + " ms");
+    }
+    return this->status;
+}
+
+///
+/// cover art of the current song, NULL if there is none
+///
+const MpdPicture* MPD_Client::get_album_art(MpdPictureResult& result)
+{
+    result = MpdPictureError;
+    if (!start_wifi()) {
+        return NULL;
+    }
+    auto player = Config.get_active_mpd();
+    this->begin_op();
+    if (this->open_connection(player)) {
+        this->con.GetStatusAndSong();
+        auto& file = this->con.GetCurrentFile();
+        result = file.empty() ? MpdPictureNone : this->con.GetAlbumArt(file.c_str(), this->cover);
+        this->close_connection();
+    }
+    this->end_op("albumart");
+    return result == MpdPictureOk ? &this->cover : NULL;
+}
+
+///
+/// show the cover art of the song of the last status: from the SD card cache if it
+/// is there, else (if fetch allows it) fetched from the player, dithered and added to the cache
+///
+bool MPD_Client::show_album_art(bool fetch)
+{
+    uint32_t key = this->con.GetCoverKey();
+    if (epd_cover_shown(key)) {
+        return true;
+    }
+    size_t size;
+    uint8_t* pixels = epd_cover_buffer(size);
+    if ((key == 0) || (pixels == NULL)) {
+        epd_hide_cover();
+        return false;
+    }
+    switch (CoverCache::load(key, pixels, size)) {
+    case CoverHit:
+        epd_push_cover(key);
+        return true;
+    case CoverNone:
+        epd_hide_cover();
+        return false;
+    case CoverMiss:
+        break;
+    }
+    if (!fetch) {
+        epd_hide_cover();
+        return false;
+    }
+    MpdPictureResult result;
+    auto art = this->get_album_art(result);
+    // the song may have changed since the status
+    key = this->con.GetCoverKey();
+    if (art != NULL && epd_draw_cover(art->data(), art->size(), key)) {
+        CoverCache::store(key, pixels, size);
+        return true;
+    }
+    // only a definite answer is remembered: after a timeout or a broken reply, try again next time
+    bool unsupported = (art != NULL) && !ImageDither::is_jpeg(art->data(), art->size()) && !ImageDither::is_png(art->data(), art->size());
+    if ((result == MpdPictureNone) || unsupported) {
+        CoverCache::store(key, NULL, 0);
+    }
+    epd_hide_cover();
+    return false;
+}
+
 bool MPD_Client::is_playing()
 {
     return this->playing;
 }
 
+bool MPD_Client::is_reachable()
+{
+    return this->reachable;
+}
+
+void MPD_Client::set_deadline(uint32_t budget_ms)
+{
+    this->con.SetDeadline(budget_ms);
+}
+
 string MPD_Client::GetLastError()
 {
     return this->con.GetLastError();
 }
+
+void MPD_Client::set_persistent(bool persistent)
+{
+    this->session.set_persistent(persistent);
+}
+
+bool MPD_Client::start_idle()
+{
+    if (this->con.IsIdling() && this->con.IsConnected()) {
+        return true;
+    }
+    if (!start_wifi()) {
+        return false;
+    }
+    auto player = Config.get_active_mpd();
+    if (this->open_connection(player)) {
+        this->close_connection();
+        return this->con.IsIdling();
+    }
+    return false;
+}
+
+///
+/// true if MPD reported a change in player, mixer, playlist or options
+///
+bool MPD_Client::check_idle()
+{
+    int changed = this->con.PollIdle();
+    if (changed < 0) {
+        this->session.forget();
+        return false;
+    }
+    return changed != MpdIdleNone;
+}
+
+const MPD_STATS& MPD_Client::get_op_stats()
+{
+    return this->session.get_op_stats();
+}
@@ -0,0 +1,92 @@
+// Copyright (c) 2023 @dheijl (danny.heijl@telenet.be)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <freertos/event_groups.h>
+
+#include "config.h"
+#include "mpdcli.h"
+#include "mpdmulti.h"
+
+static const uint32_t JOB_STACK_SIZE = 8192;
+// set when all play jobs are connected
+static const EventBits_t GO_BIT = 1 << 23;
+
+static void player_job_task(void* arg)
+{
+    auto job = (PLAYER_JOB*)arg;
+    {
+        MpdConnection con;
+        con.SetConnectTimeout(job->timeout_ms);
+        con.SetReadTimeout(job->timeout_ms);
+        job->connected = con.Connect(job->player->player_ip, job->player->player_port);
+        if (job->url != NULL) {
+            // start barrier: keep the skew between players down to the command list itself
+            xEventGroupSetBits(job->events, job->ready_bit);
+            xEventGroupWaitBits(job->events, GO_BIT, pdFALSE, pdTRUE, portMAX_DELAY);
+            if (job->connected) {
+                job->play_us = micros();
+                job->ok = con.PlayUrl(job->url);
+            }
+        } else if (job->connected) {
+            MPD_SONG_DATA song = {};
+            job->ok = con.GetPlayerSummary(job->status, song);
+            if (job->ok) {
+                const char* title = song.title[0] != '\0' ? song.title : song.name;
+                strlcpy(job->title, title, sizeof(job->title));
+            }
+        }
+        con.Disconnect();
+    }
+    xEventGroupSetBits(job->events, job->done_bit);
+    vTaskDelete(NULL);
+}
+
+void run_player_jobs(PLAYER_JOB* jobs, int njobs)
+{
+    njobs = min(njobs, MAX_PLAYER_JOBS);
+    EventGroupHandle_t events = xEventGroupCreate();
+    EventBits_t all_done = 0;
+    EventBits_t all_ready = 0;
+    for (int i = 0; i < njobs; ++i) {
+        auto job = &jobs[i];
+        job->connected = false;
+        job->ok = false;
+        job->title[0] = '\0';
+        job->play_us = 0;
+        memset(&job->status, 0, sizeof(job->status));
+        job->events = events;
+        job->done_bit = 1 << i;
+        job->ready_bit = 1 << (i + MAX_PLAYER_JOBS);
+        all_done |= job->done_bit;
+        if (job->url != NULL) {
+            all_ready |= job->ready_bit;
+        }
+        if (xTaskCreate(player_job_task, "mpd_job", JOB_STACK_SIZE, job, 1, NULL) != pdPASS) {
+            DPRINT("mpd_job task create failed");
+            xEventGroupSetBits(events, job->done_bit | job->ready_bit);
+        }
+    }
+    // every job is bounded by its own connect and read timeouts
+    if (all_ready != 0) {
+        xEventGroupWaitBits(events, all_ready, pdFALSE, pdTRUE, portMAX_DELAY);
+        xEventGroupSetBits(events, GO_BIT);
+    }
+    xEventGroupWaitBits(events, all_done, pdFALSE, pdTRUE, portMAX_DELAY);
+    vEventGroupDelete(events);
+}
@@ -31,11 +31,29 @@
 
 #define TFCARD_CS_PIN GPIO_NUM_4
 
+static int sd_mounts = 0;
+
+bool SD_Config::mount()
+{
+    if ((sd_mounts == 0) && !SD.begin(TFCARD_CS_PIN, SPI, 25000000)) {
+        SD.end();
+        return false;
+    }
+    ++sd_mounts;
+    return true;
+}
+
+void SD_Config::unmount()
+{
+    if ((sd_mounts > 0) && (--sd_mounts == 0)) {
+        SD.end();
+    }
+}
+
 bool SD_Config::read_wifi(NETWORK_CFG& nw_cfg)
 {
     bool result = false;
-    if (!SD.begin(TFCARD_CS_PIN, SPI, 25000000)) {
-        SD.end();
+    if (!mount()) {
         return result;
     }
     epd_print_topline("SD card present!");
@@ -48,15 +66,14 @@ bool SD_Config::read_wifi(NETWORK_CFG& nw_cfg)
         epd_print_topline("error reading wifi.txt");
         vTaskDelay(1000);
     }
-    SD.end();
+    unmount();
     return result;
 }
 
 bool SD_Config::read_players(PLAYERS& players)
 {
     bool result = false;
-    if (!SD.begin(TFCARD_CS_PIN, SPI, 25000000)) {
-        SD.end();
+    if (!mount()) {
         return result;
     }
     epd_print_topline("Loading players");
@@ -68,15 +85,14 @@ bool SD_Config::read_players(PLAYERS& players)
         vTaskDelay(1000);
     }
 
-    SD.end();
+    unmount();
     return result;
 }
 
 bool SD_Config::read_favourites(FAVOURITES& favourites)
 {
     bool result = false;
-    if (!SD.begin(TFCARD_CS_PIN, SPI, 25000000)) {
-        SD.end();
+    if (!mount()) {
         return result;
     }
     epd_print_topline("Loading favourites");
@@ -88,43 +104,43 @@ bool SD_Config::read_favourites(FAVOURITES& favourites)
         vTaskDelay(1000);
     }
 
-    SD.end();
+    unmount();
     return result;
 }
 
+///
+/// one or more "ssid|psw" lines, followed by a "ntp server|timezone" line
+///
 bool SD_Config::parse_wifi_file(File wifif, NETWORK_CFG& nw_cfg)
 {
-    bool have_ntp = false;
-    bool have_wifi = false;
     epd_print_topline("Parsing WiFi ssid/psw");
+    vector<vector<string>> lines;
     while (wifif.available()) {
         String line = wifif.readStringUntil('\n');
         line.trim();
         DPRINT(line);
-        string wifi = line.c_str();
-        if (wifi.length() > 1) {
-            vector<string> parts = split(wifi, '|');
-            if (parts.size() == 2) {
-                nw_cfg.ssid = strdup(parts[0].c_str());
-                nw_cfg.psw = strdup(parts[1].c_str());
-                have_wifi = true;
-            }
-        }
-        line = wifif.readStringUntil('\n');
-        line.trim();
-        DPRINT(line);
-        string ntp = line.c_str();
-        if (ntp.length() > 1) {
-            vector<string> parts = split(ntp, '|');
+        string entry = line.c_str();
+        if (entry.length() > 1) {
+            vector<string> parts = split(entry, '|');
             if (parts.size() == 2) {
-                nw_cfg.ntp_server = strdup(parts[0].c_str());
-                nw_cfg.tz = strdup(parts[1].c_str());
-                have_ntp = true;
+                lines.push_back(parts);
             }
         }
     }
     wifif.close();
-    return have_wifi && have_ntp;
+    if (lines.size() < 2) {
+        return false;
+    }
+    auto& ntp = lines.back();
+    nw_cfg.ntp_server = strdup(ntp[0].c_str());
+    nw_cfg.tz = strdup(ntp[1].c_str());
+    nw_cfg.networks.clear();
+    for (size_t i = 0; (i < lines.size() - 1) && (i < MAX_NETWORKS); ++i) {
+        nw_cfg.networks.push_back(WIFI_NETWORK { strdup(lines[i][0].c_str()), strdup(lines[i][1].c_str()) });
+    }
+    nw_cfg.ssid = nw_cfg.networks[0].ssid;
+    nw_cfg.psw = nw_cfg.networks[0].psw;
+    return true;
 }
 
 bool SD_Config::parse_players_file(File plf, PLAYERS& players)
@@ -18,6 +18,7 @@
 // CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <M5EPD.h>
 
+#include "backoff.h"
 #include "config.h"
 #include "epdfunctions.h"
 #include "mpdcli.h"
@@ -56,7 +57,13 @@ void shutdown_and_wake()
             sleep_time = 3600 - (RTCTime.min * 60) - RTCTime.sec;
         }
     }
+    if (network_backoff()) {
+        // the network is down: don't come back before the next attempt is due
+        sleep_time = backoff_sleep_time(sleep_time);
+        sleep_msg = "Offline: sleeping for " + String((sleep_time + 59) / 60) + " minutes";
+    }
     epd_print_bottomline(sleep_msg);
+    epd_save_state();
     vTaskDelay(250);
     // shut down now and wake up after sleep_time seconds (if on battery)
     // this only disables MainPower, but is a NO-OP when on USB power
@@ -114,3 +121,21 @@ String get_date_time()
     snprintf(timebuf, 64, "%02d:%02d:%02d", RTCTime.hour, RTCTime.min, RTCTime.sec);
     return String(String(datebuf) + " - " + String(timebuf));
 }
+
+///
+/// seconds since 2000-01-01 by the hardware RTC, which keeps running through
+/// deep sleep and power off
+///
+uint32_t get_rtc_seconds()
+{
+    rtc_date_t RTCDate;
+    M5.RTC.getDate(&RTCDate);
+    rtc_time_t RTCTime;
+    M5.RTC.getTime(&RTCTime);
+    // days since 0000-03-01, with March as the first month so leap days come last,
+    // minus the 730425 days from there to 2000-01-01
+    uint32_t y = RTCDate.year - (RTCDate.mon <= 2 ? 1 : 0);
+    uint32_t m = RTCDate.mon <= 2 ? RTCDate.mon + 9 : RTCDate.mon - 3;
+    uint32_t days = (y * 365) + (y / 4) - (y / 100) + (y / 400) + ((153 * m + 2) / 5) + RTCDate.day - 1 - 730425;
+    return (days * 86400) + (RTCTime.hour * 3600) + (RTCTime.min * 60) + RTCTime.sec;
+}
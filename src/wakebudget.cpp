@@ -0,0 +1,88 @@
+// Copyright (c) 2023 @dheijl (danny.heijl@telenet.be)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "wakebudget.h"
+
+#include "config.h"
+#include "rtcstate.h"
+
+static WakeBudget budget;
+
+WakeBudget& Budget = budget;
+
+static const constexpr char* NVS_WAKE = "wakestats";
+static const uint32_t RTC_WAKE_MAGIC = 0x57414b45;
+static const constexpr char* phase_names[PHASE_COUNT] = { "config", "wifi", "resolve", "status", "render" };
+// share of the total budget per phase, in percent
+static const uint8_t phase_share[PHASE_COUNT] = { 10, 45, 10, 20, 15 };
+
+RTC_DATA_ATTR static WAKE_STATS rtc_wake;
+static RtcNvsState<WAKE_STATS> wake_state(rtc_wake, rtc_wake.magic, NVS_WAKE, "overruns", RTC_WAKE_MAGIC);
+
+static WAKE_STATS& load_stats()
+{
+    return wake_state.load();
+}
+
+static void save_stats()
+{
+    wake_state.save();
+}
+
+void WakeBudget::begin(uint32_t total_ms)
+{
+    this->start = millis();
+    this->total = total_ms;
+    this->overrun = false;
+}
+
+uint32_t WakeBudget::begin_phase(WakePhase phase)
+{
+    this->phase = phase;
+    this->phase_start = millis();
+    uint32_t share = (this->total * phase_share[phase]) / 100;
+    this->phase_budget = min(share, this->remaining());
+    return this->phase_budget;
+}
+
+bool WakeBudget::end_phase()
+{
+    uint32_t elapsed = millis() - this->phase_start;
+    DPRINT(String(phase_names[this->phase]) + ": " + String(elapsed) + "/" + String(this->phase_budget) + " ms");
+    if (elapsed <= this->phase_budget) {
+        return true;
+    }
+    this->overrun = true;
+    auto& stats = load_stats();
+    ++stats.overruns[this->phase];
+    // only overruns are written, normal wakes leave the flash alone
+    save_stats();
+    return false;
+}
+
+uint32_t WakeBudget::remaining()
+{
+    uint32_t elapsed = millis() - this->start;
+    return elapsed < this->total ? this->total - elapsed : 0;
+}
+
+bool WakeBudget::degraded()
+{
+    return this->overrun;
+}
@@ -20,41 +20,268 @@
 #include "wifi_utils.h"
 #include "epdfunctions.h"
 
+#include "rtcstate.h"
+#include "utils.h"
+
 #include <M5EPD.h>
 #include <WiFi.h>
-#include <WiFiMulti.h>
+
+#include <algorithm>
 
 static bool have_wifi = false;
 
+static const constexpr char* NVS_WIFI_FAST = "wififast";
+static const uint32_t RTC_WIFI_MAGIC = 0x57494649;
+// reuse a DHCP lease without asking the DHCP server for at most this long. The
+// server is not told, so a lease that runs out sooner can give our address to
+// another host; an hour is within the lease time of nearly all networks, and a
+// DHCP exchange once an hour costs little on top of the directed connects.
+static const uint32_t LEASE_REUSE_TIME = 3600;
+static const uint32_t FAST_CONNECT_TIMEOUT = 3000;
+static const uint32_t FULL_CONNECT_TIMEOUT = 10000;
+// rssi bonus in dB for the network that was used last
+static const int32_t PREFERRED_BONUS = 8;
+
+static const EventBits_t GOT_IP_BIT = 1 << 0;
+static const EventBits_t DISCONNECTED_BIT = 1 << 1;
+static EventGroupHandle_t wifi_events = NULL;
+
+///
+/// last good association and DHCP lease, for a directed connect with a static ip
+///
+typedef struct wifi_fast_cfg {
+    uint32_t magic;
+    char ssid[33];
+    uint8_t bssid[6];
+    int32_t channel;
+    uint32_t ip;
+    uint32_t gateway;
+    uint32_t subnet;
+    uint32_t dns;
+    uint32_t leased_at; // get_rtc_seconds()
+} WIFI_FAST_CFG;
+
+RTC_DATA_ATTR static WIFI_FAST_CFG rtc_wifi;
+static RtcNvsState<WIFI_FAST_CFG> wifi_state(rtc_wifi, rtc_wifi.magic, NVS_WIFI_FAST, "cfg", RTC_WIFI_MAGIC);
+
+///
+/// the configured network of the cached lease if it can still be used, else -1
+///
+static int load_fast_cfg(const WIFI_NETWORKS& networks)
+{
+    auto& cfg = wifi_state.load();
+    if (cfg.ssid[0] == '\0') {
+        // no lease yet
+        return -1;
+    }
+    if ((get_rtc_seconds() - cfg.leased_at) >= LEASE_REUSE_TIME) {
+        return -1;
+    }
+    for (size_t i = 0; i < networks.size(); ++i) {
+        if (strcmp(cfg.ssid, networks[i].ssid) == 0) {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+static void save_fast_cfg(const char* ssid)
+{
+    WIFI_FAST_CFG cfg;
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.magic = RTC_WIFI_MAGIC;
+    strlcpy(cfg.ssid, ssid, sizeof(cfg.ssid));
+    memcpy(cfg.bssid, WiFi.BSSID(), sizeof(cfg.bssid));
+    cfg.channel = WiFi.channel();
+    cfg.ip = (uint32_t)WiFi.localIP();
+    cfg.gateway = (uint32_t)WiFi.gatewayIP();
+    cfg.subnet = (uint32_t)WiFi.subnetMask();
+    cfg.dns = (uint32_t)WiFi.dnsIP(0);
+    cfg.leased_at = get_rtc_seconds();
+    rtc_wifi = cfg;
+    wifi_state.save();
+}
+
+///
+/// stop reusing the lease, but keep its ssid as the preferred network
+///
+static void expire_fast_cfg()
+{
+    wifi_state.load().leased_at = get_rtc_seconds() - LEASE_REUSE_TIME;
+    wifi_state.save();
+}
+
+static void on_wifi_event(arduino_event_id_t event, arduino_event_info_t info)
+{
+    if (event == ARDUINO_EVENT_WIFI_STA_GOT_IP) {
+        xEventGroupSetBits(wifi_events, GOT_IP_BIT);
+    } else if (event == ARDUINO_EVENT_WIFI_STA_DISCONNECTED) {
+        xEventGroupSetBits(wifi_events, DISCONNECTED_BIT);
+    }
+}
+
+static void init_wifi()
+{
+    if (wifi_events == NULL) {
+        wifi_events = xEventGroupCreate();
+        WiFi.onEvent(on_wifi_event);
+    }
+    WiFi.mode(WIFI_STA);
+}
+
+///
+/// an access point of a configured network found by the scan
+///
+typedef struct wifi_candidate {
+    int network;
+    uint8_t bssid[6];
+    int32_t channel;
+    int32_t score;
+} WIFI_CANDIDATE;
+
+///
+/// one scan, ranked by signal strength, with a bonus for the network we used last
+/// so that we don't flip between two networks of about the same strength
+///
+static vector<WIFI_CANDIDATE> scan_networks(const WIFI_NETWORKS& networks)
+{
+    vector<WIFI_CANDIDATE> candidates;
+    int n = WiFi.scanNetworks();
+    for (int i = 0; i < n; ++i) {
+        String ssid = WiFi.SSID(i);
+        for (size_t net = 0; net < networks.size(); ++net) {
+            if (strcmp(ssid.c_str(), networks[net].ssid) != 0) {
+                continue;
+            }
+            WIFI_CANDIDATE c;
+            c.network = (int)net;
+            memcpy(c.bssid, WiFi.BSSID(i), sizeof(c.bssid));
+            c.channel = WiFi.channel(i);
+            c.score = WiFi.RSSI(i);
+            if (strcmp(ssid.c_str(), wifi_state.load().ssid) == 0) {
+                c.score += PREFERRED_BONUS;
+            }
+            DPRINT("scan: " + ssid + " ch" + String(c.channel) + " " + String(WiFi.RSSI(i)) + "dBm");
+            candidates.push_back(c);
+            break;
+        }
+    }
+    WiFi.scanDelete();
+    std::sort(candidates.begin(), candidates.end(), [](const WIFI_CANDIDATE& a, const WIFI_CANDIDATE& b) {
+        return a.score > b.score;
+    });
+    return candidates;
+}
+
+///
+/// start connecting and block (without spinning) until we have an ip address,
+/// the AP turned us down, or timeout_ms has passed. With a bssid the connect is
+/// directed at that AP, with a lease the ip configuration is static.
+///
+static bool connect_and_wait(const WIFI_NETWORK& net, const uint8_t* bssid, int32_t channel, const WIFI_FAST_CFG* lease, uint32_t timeout_ms)
+{
+    init_wifi();
+    if (lease != NULL) {
+        WiFi.config(IPAddress(lease->ip), IPAddress(lease->gateway), IPAddress(lease->subnet), IPAddress(lease->dns));
+    } else {
+        // back to DHCP
+        WiFi.config(IPAddress((uint32_t)0), IPAddress((uint32_t)0), IPAddress((uint32_t)0));
+    }
+    xEventGroupClearBits(wifi_events, GOT_IP_BIT | DISCONNECTED_BIT);
+    if (bssid != NULL) {
+        // directed connect: no scan
+        WiFi.begin(net.ssid, net.psw, channel, bssid);
+    } else {
+        WiFi.begin(net.ssid, net.psw);
+    }
+    uint32_t start = millis();
+    while ((millis() - start) < timeout_ms) {
+        uint32_t left = timeout_ms - (millis() - start);
+        auto bits = xEventGroupWaitBits(wifi_events, GOT_IP_BIT | DISCONNECTED_BIT, pdTRUE, pdFALSE, pdMS_TO_TICKS(left));
+        if (WiFi.status() == WL_CONNECTED) {
+            return true;
+        }
+        if ((bits & DISCONNECTED_BIT) && (bssid != NULL)) {
+            // the AP is gone or turned us down: don't wait for the full timeout
+            return false;
+        }
+    }
+    return WiFi.status() == WL_CONNECTED;
+}
+
 bool is_wifi_connected()
 {
     return have_wifi;
 }
 
-bool start_wifi()
+///
+/// the timeout of one connect attempt, cut to what is left of the overall timeout
+///
+static uint32_t attempt_timeout(uint32_t timeout, uint32_t start, uint32_t limit)
+{
+    if (limit == 0) {
+        return timeout;
+    }
+    uint32_t elapsed = millis() - start;
+    return elapsed < limit ? min(timeout, limit - elapsed) : 0;
+}
+
+bool start_wifi(int attempts, uint32_t timeout_ms)
 {
 
     if ((have_wifi) && (WiFi.status() == WL_CONNECTED)) {
         return true;
     }
-    int retries = 5;
-
-    while (retries-- > 0 && !have_wifi) {
+    uint32_t start = millis();
+    auto& networks = Config.getNW_CFG().networks;
+    if (networks.empty()) {
+        epd_print_topline("No wifi networks configured");
+        return false;
+    }
+    WiFi.softAPdisconnect(true);
+    int fast = load_fast_cfg(networks);
+    if (fast >= 0) {
+        epd_print_topline("Connecting wifi (fast)...");
+        if (connect_and_wait(networks[fast], rtc_wifi.bssid, rtc_wifi.channel, &rtc_wifi, attempt_timeout(FAST_CONNECT_TIMEOUT, start, timeout_ms))) {
+            have_wifi = true;
+            epd_print_topline("Wifi connected");
+            return have_wifi;
+        }
+        DPRINT("fast wifi connect failed");
+        expire_fast_cfg();
+        WiFi.disconnect();
+    }
+    epd_print_topline("Scanning wifi...");
+    init_wifi();
+    auto candidates = scan_networks(networks);
+    for (int attempt = 0; (attempt < attempts) && !have_wifi; ++attempt) {
+        uint32_t timeout = attempt_timeout(FULL_CONNECT_TIMEOUT, start, timeout_ms);
+        if (timeout == 0) {
+            break;
+        }
         // Turn on WiFi
         WiFi.disconnect();
-        WiFi.softAPdisconnect(true);
-        epd_print_topline("Connecting wifi...");
-        WiFi.mode(WIFI_STA);
-        auto ap = Config.getNW_CFG();
-        WiFi.begin(ap.ssid, ap.psw);
         have_wifi = false;
-        long now = millis();
-        while ((millis() - now) < 10000) {
-            if (WiFi.status() == WL_CONNECTED) {
-                have_wifi = true;
-                epd_print_topline("Wifi connected");
-                return have_wifi;
-            }
+        bool connected = false;
+        const char* ssid = NULL;
+        if (candidates.empty()) {
+            // nothing seen (hidden ssid?): let the driver search for each network in turn
+            auto& net = networks[attempt % networks.size()];
+            ssid = net.ssid;
+            epd_print_topline("Connecting " + String(ssid) + "...");
+            connected = connect_and_wait(net, NULL, 0, NULL, timeout);
+        } else {
+            // strongest first, the next one on a retry
+            auto& c = candidates[attempt % candidates.size()];
+            ssid = networks[c.network].ssid;
+            epd_print_topline("Connecting " + String(ssid) + "...");
+            connected = connect_and_wait(networks[c.network], c.bssid, c.channel, NULL, timeout);
+        }
+        if (connected) {
+            have_wifi = true;
+            save_fast_cfg(ssid);
+            epd_print_topline("Wifi connected");
+            return have_wifi;
         }
         stop_wifi();
         vTaskDelay(500);
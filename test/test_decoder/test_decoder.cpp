@@ -0,0 +1,308 @@
+// Copyright (c) 2023 @dheijl (danny.heijl@telenet.be)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <cctype>
+#include <chrono>
+#include <map>
+#include <new>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+#include <unity.h>
+
+#include "mpdresponse.h"
+
+///
+/// the in-place reply decoders and their cost per reply next to the std::map parser
+/// they replaced, run natively with "pio test -e native"
+///
+
+// every heap allocation of the test, to count them per reply
+static size_t allocations = 0;
+
+void* operator new(size_t size)
+{
+    ++allocations;
+    void* p = malloc(size);
+    if (p == NULL) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void* p) noexcept
+{
+    free(p);
+}
+
+///
+/// the replaced parser, as it was in mpdcli.h: a copy of the reply, split into lines,
+/// upper-cased keys in a std::map, and a copy for every getter
+///
+namespace legacy {
+
+using std::string;
+using std::vector;
+
+class MpdResponse {
+private:
+    MpdResponseType ResponseType;
+    string Response;
+
+protected:
+    std::map<string, string> ResponseData;
+    string getItem(const string& item)
+    {
+        auto it = this->ResponseData.find(item);
+        if (it != this->ResponseData.end()) {
+            return it->second;
+        } else {
+            return "";
+        }
+    }
+
+public:
+    MpdResponse(const string& response)
+    {
+        this->ResponseType = MpdErrorType;
+        this->Response = response;
+        auto p = response.find("ACK");
+        if (p != string::npos) {
+            if (p == 0) {
+                this->ResponseType = MpdACKType;
+            }
+        } else {
+            p = response.find("OK");
+            if (p != string::npos) {
+                if ((p == (response.length() - 3)) || (p == 0)) {
+                    this->ResponseType = MpdOKType;
+                }
+            }
+        }
+        if (this->ResponseType == MpdOKType) {
+            static const string delimiter = "\n";
+            size_t pos_start = 0, pos_end, delim_len = delimiter.length();
+            string token;
+            vector<string> lines;
+            while ((pos_end = this->Response.find(delimiter, pos_start)) != string::npos) {
+                token = this->Response.substr(pos_start, pos_end - pos_start);
+                pos_start = pos_end + delim_len;
+                lines.push_back(token);
+            }
+            lines.push_back(this->Response.substr(pos_start));
+            for (auto line : lines) {
+                if ((pos_start = line.find(": ")) != string::npos) {
+                    auto key = line.substr(0, pos_start);
+                    for (size_t i = 0; i < key.length(); ++i) {
+                        key[i] = std::toupper(key[i]);
+                    }
+                    auto value = line.substr(pos_start + 2);
+                    this->ResponseData[key] = value;
+                }
+            }
+        }
+    }
+    MpdResponseType getResponseType()
+    {
+        return this->ResponseType;
+    }
+};
+
+class MpdStatus : public MpdResponse {
+public:
+    MpdStatus(const string& response)
+        : MpdResponse(response)
+    {
+    }
+    string getState()
+    {
+        return this->getItem("STATE");
+    }
+    string getElapsed()
+    {
+        return this->getItem("ELAPSED");
+    }
+};
+
+class MpdCurrentSong : public MpdResponse {
+public:
+    MpdCurrentSong(const string& response)
+        : MpdResponse(response)
+    {
+    }
+    string getTitle()
+    {
+        return this->getItem("TITLE");
+    }
+    string getArtist()
+    {
+        string artist = this->getItem("ARTIST");
+        if (artist.empty()) {
+            artist = this->getItem("ALBUMARTIST");
+        }
+        return artist;
+    }
+};
+
+}
+
+static const int ROUNDS = 20000;
+
+static const char STATUS_REPLY[] = "volume: 40\nrepeat: 0\nrandom: 0\nsingle: 0\nconsume: 0\nplaylist: 12\n"
+                                   "playlistlength: 3\nmixrampdb: 0.000000\nstate: pause\nsong: 1\nsongid: 7\n"
+                                   "time: 12:180\nelapsed: 12.345\nbitrate: 320\nduration: 180.250\n"
+                                   "audio: 44100:16:2\nnextsong: 2\nnextsongid: 8\nOK\n";
+static const char SONG_REPLY[] = "file: music/Artist/Album/01 Track.flac\nLast-Modified: 2021-04-01T10:00:00Z\n"
+                                 "Artist: The Artist\nAlbumArtist: The Artist\nTitle: A Rather Long Title For A Track\n"
+                                 "Album: The Album\nTrack: 1\nDate: 2021\nGenre: Rock\nTime: 180\nduration: 180.250\n"
+                                 "Pos: 1\nId: 7\nOK\n";
+static const char QUEUE_REPLY[] = "file: http://radio.example/stream.mp3\nName: Radio One\nPos: 0\nId: 6\n"
+                                  "file: music/a.flac\nTitle: Song A\nName: ignored\nPos: 1\nId: 7\n"
+                                  "file: music/some/long/path/b.flac\nPos: 2\nId: 8\nOK\n";
+
+void setUp() { }
+void tearDown() { }
+
+typedef struct bench {
+    double ns;
+    double allocations;
+} BENCH;
+
+template <typename F>
+static BENCH per_reply(F f)
+{
+    size_t before = allocations;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ROUNDS; ++i) {
+        f();
+    }
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    return { (double)ns / ROUNDS, (double)(allocations - before) / ROUNDS };
+}
+
+static void report(const char* name, const BENCH& now, const BENCH& old)
+{
+    char msg[160];
+    snprintf(msg, sizeof(msg), "%s: %.0f ns, %.1f allocations per reply (std::map parser: %.0f ns, %.1f allocations)", name,
+        now.ns, now.allocations, old.ns, old.allocations);
+    TEST_MESSAGE(msg);
+}
+
+void test_status()
+{
+    MpdStatus status(STATUS_REPLY, sizeof(STATUS_REPLY) - 1);
+    TEST_ASSERT_EQUAL(MpdOKType, status.getResponseType());
+    TEST_ASSERT_EQUAL(MpdStatePause, status.getState());
+    TEST_ASSERT_EQUAL_STRING("pause", status.getStateName());
+    TEST_ASSERT_FALSE(status.isPlaying());
+    TEST_ASSERT_EQUAL_STRING("44100:16:2", status.getFormat());
+    auto& data = status.getStatus();
+    TEST_ASSERT_EQUAL(7, data.songid);
+    TEST_ASSERT_EQUAL(1, data.song);
+    TEST_ASSERT_EQUAL(3, data.playlistlength);
+    TEST_ASSERT_EQUAL(40, data.volume);
+    TEST_ASSERT_EQUAL(320, data.bitrate);
+    TEST_ASSERT_TRUE((data.elapsed > 12.3f) && (data.elapsed < 12.4f));
+    volatile int sink = 0;
+    auto now = per_reply([&]() {
+        MpdStatus s(STATUS_REPLY, sizeof(STATUS_REPLY) - 1);
+        sink += s.getState() + (int)s.getStatus().elapsed;
+    });
+    // the old read_data() also copied the receive buffer into a string
+    auto old = per_reply([&]() {
+        legacy::MpdStatus s(std::string(STATUS_REPLY, sizeof(STATUS_REPLY) - 1));
+        sink += s.getState().length() + (int)atof(s.getElapsed().c_str());
+    });
+    report("status", now, old);
+    TEST_ASSERT_EQUAL(0, now.allocations);
+}
+
+void test_current_song()
+{
+    MpdCurrentSong song(SONG_REPLY, sizeof(SONG_REPLY) - 1);
+    TEST_ASSERT_EQUAL(MpdOKType, song.getResponseType());
+    TEST_ASSERT_EQUAL_STRING("music/Artist/Album/01 Track.flac", song.getFile());
+    TEST_ASSERT_EQUAL_STRING("A Rather Long Title For A Track", song.getTitle());
+    TEST_ASSERT_EQUAL_STRING("The Artist", song.getArtist());
+    TEST_ASSERT_EQUAL_STRING("The Album", song.getAlbum());
+    TEST_ASSERT_EQUAL_STRING("", song.getName());
+    volatile int sink = 0;
+    auto now = per_reply([&]() {
+        MpdCurrentSong s(SONG_REPLY, sizeof(SONG_REPLY) - 1);
+        sink += s.getTitle()[0] + s.getArtist()[0];
+    });
+    auto old = per_reply([&]() {
+        legacy::MpdCurrentSong s(std::string(SONG_REPLY, sizeof(SONG_REPLY) - 1));
+        sink += s.getTitle()[0] + s.getArtist()[0];
+    });
+    report("currentsong", now, old);
+    TEST_ASSERT_EQUAL(0, now.allocations);
+}
+
+void test_queue()
+{
+    MPD_QUEUE_ENTRY entries[8];
+    MpdQueueInfo queue(QUEUE_REPLY, sizeof(QUEUE_REPLY) - 1, entries, 8);
+    TEST_ASSERT_EQUAL(3, queue.getCount());
+    TEST_ASSERT_EQUAL_STRING("Radio One", entries[0].title);
+    TEST_ASSERT_EQUAL_STRING("Song A", entries[1].title);
+    TEST_ASSERT_EQUAL(7, entries[1].id);
+    // no tags: the tail of the file
+    TEST_ASSERT_EQUAL_STRING("music/some/long/path/b.flac", entries[2].title);
+    TEST_ASSERT_EQUAL(2, entries[2].pos);
+    // more songs than room: the rest is skipped
+    MpdQueueInfo small(QUEUE_REPLY, sizeof(QUEUE_REPLY) - 1, entries, 1);
+    TEST_ASSERT_EQUAL(1, small.getCount());
+    // no std::map version to compare with, the queue is new
+    volatile int sink = 0;
+    auto now = per_reply([&]() {
+        MpdQueueInfo q(QUEUE_REPLY, sizeof(QUEUE_REPLY) - 1, entries, 8);
+        sink += q.getCount();
+    });
+    char msg[80];
+    snprintf(msg, sizeof(msg), "playlistinfo: %.0f ns, %.1f allocations per reply", now.ns, now.allocations);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_EQUAL(0, now.allocations);
+}
+
+void test_failures()
+{
+    static const char ACK_REPLY[] = "ACK [50@0] {status} no such thing\n";
+    MpdStatus status(ACK_REPLY, sizeof(ACK_REPLY) - 1);
+    TEST_ASSERT_EQUAL(MpdACKType, status.getResponseType());
+    TEST_ASSERT_EQUAL(MpdFailureKind, status.getResponseKind());
+    TEST_ASSERT_EQUAL_STRING("", status.getStateName());
+    // cut off before the OK
+    MpdCurrentSong song(SONG_REPLY, 40);
+    TEST_ASSERT_EQUAL(MpdFailureKind, song.getResponseKind());
+    MpdConnect greeting("OK MPD 0.23.5\n", 14);
+    TEST_ASSERT_EQUAL(MpdOKType, greeting.getResponseType());
+    TEST_ASSERT_EQUAL_STRING("0.23.5", greeting.getVersion());
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_status);
+    RUN_TEST(test_current_song);
+    RUN_TEST(test_queue);
+    RUN_TEST(test_failures);
+    return UNITY_END();
+}
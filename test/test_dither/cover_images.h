@@ -0,0 +1,1441 @@
+// Copyright (c) 2023 @dheijl (danny.heijl@telenet.be)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include <stdint.h>
+
+///
+/// synthetic covers for the dither benchmark: gradients, rings, a light disc with a
+/// dark centre. cover_jpg is 500x500 (baseline, quality 60), cover_png 200x200 RGB.
+///
+
+static const uint8_t cover_jpg[] = {
+    0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x0d, 0x09, 0x0a, 0x0b, 0x0a, 0x08, 0x0d,
+    0x0b, 0x0a, 0x0b, 0x0e, 0x0e, 0x0d, 0x0f, 0x13, 0x20, 0x15, 0x13, 0x12, 0x12, 0x13, 0x27, 0x1c,
+    0x1e, 0x17, 0x20, 0x2e, 0x29, 0x31, 0x30, 0x2e, 0x29, 0x2d, 0x2c, 0x33, 0x3a, 0x4a, 0x3e, 0x33,
+    0x36, 0x46, 0x37, 0x2c, 0x2d, 0x40, 0x57, 0x41, 0x46, 0x4c, 0x4e, 0x52, 0x53, 0x52, 0x32, 0x3e,
+    0x5a, 0x61, 0x5a, 0x50, 0x60, 0x4a, 0x51, 0x52, 0x4f, 0xff, 0xdb, 0x00, 0x43, 0x01, 0x0e, 0x0e,
+    0x0e, 0x13, 0x11, 0x13, 0x26, 0x15, 0x15, 0x26, 0x4f, 0x35, 0x2d, 0x35, 0x4f, 0x4f, 0x4f, 0x4f,
+    0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f,
+    0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f,
+    0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0xff, 0xc0,
+    0x00, 0x11, 0x08, 0x01, 0xf4, 0x01, 0xf4, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11,
+    0x01, 0xff, 0xc4, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x10, 0x00, 0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05,
+    0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21,
+    0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23,
+    0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a,
+    0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a,
+    0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
+    0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+    0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7,
+    0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5,
+    0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1,
+    0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xc4, 0x00, 0x1f, 0x01, 0x00, 0x03,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x11, 0x00,
+    0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00, 0x01, 0x02, 0x77, 0x00,
+    0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13,
+    0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15,
+    0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26, 0x27,
+    0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+    0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
+    0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4,
+    0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe2,
+    0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9,
+    0xfa, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xe0,
+    0x80, 0xa5, 0x02, 0x94, 0x0a, 0x5c, 0x57, 0xe8, 0xa9, 0x1c, 0x97, 0x13, 0x14, 0xb8, 0xa5, 0xc5,
+    0x18, 0xa6, 0x52, 0x61, 0x8a, 0x5a, 0x29, 0x69, 0x36, 0x52, 0x12, 0x96, 0x8a, 0x2a, 0x1c, 0x8b,
+    0x41, 0x45, 0x2d, 0x15, 0x9c, 0xa4, 0x5a, 0x12, 0x8a, 0x5a, 0x2b, 0x09, 0x4c, 0xb4, 0x25, 0x14,
+    0xb4, 0x56, 0x32, 0x99, 0x68, 0x4a, 0x28, 0xa2, 0xb0, 0x95, 0x43, 0x44, 0x14, 0x51, 0x45, 0x61,
+    0x2a, 0x85, 0xa1, 0x68, 0xa4, 0xa5, 0xac, 0x25, 0x50, 0xb4, 0x14, 0x51, 0x45, 0x65, 0x2a, 0x85,
+    0xa0, 0xa5, 0xa4, 0xa2, 0xb2, 0x75, 0x0b, 0x42, 0xd1, 0x45, 0x15, 0x9b, 0xa8, 0x5a, 0x16, 0x8a,
+    0x28, 0xa8, 0x75, 0x0b, 0x42, 0xd2, 0xd2, 0x52, 0xd4, 0xfb, 0x42, 0x90, 0x52, 0xd2, 0x52, 0xd2,
+    0xf6, 0x85, 0xa1, 0x69, 0x69, 0x29, 0x69, 0x7b, 0x42, 0x90, 0xb4, 0x52, 0x52, 0xd1, 0xed, 0x0a,
+    0x42, 0xd3, 0xa9, 0xb4, 0xa2, 0xab, 0xda, 0x14, 0x87, 0x52, 0x8a, 0x41, 0x4a, 0x2a, 0x95, 0x42,
+    0x90, 0xa2, 0x94, 0x52, 0x52, 0x8a, 0xb5, 0x50, 0xa1, 0xc2, 0x94, 0x53, 0x45, 0x38, 0x55, 0xaa,
+    0x83, 0x14, 0x53, 0x85, 0x34, 0x53, 0x85, 0x6a, 0xaa, 0x14, 0x28, 0xa7, 0x0a, 0x68, 0xa7, 0x0a,
+    0xd6, 0x35, 0x06, 0x28, 0xa7, 0x0a, 0x68, 0xa7, 0x0a, 0xd6, 0x33, 0x28, 0x51, 0x4e, 0x14, 0xd1,
+    0x4e, 0x15, 0xb2, 0x98, 0xc5, 0x14, 0xa2, 0x90, 0x53, 0x85, 0x6a, 0xa6, 0x30, 0xa7, 0x52, 0x0a,
+    0x75, 0x5a, 0x91, 0x41, 0x4b, 0x40, 0xa5, 0xab, 0xb9, 0x48, 0x4c, 0x52, 0xe2, 0x97, 0x14, 0xb8,
+    0xa0, 0xa4, 0xc6, 0xe2, 0x97, 0x14, 0xb8, 0xa5, 0xc5, 0x43, 0x29, 0x31, 0xb8, 0xa2, 0x9d, 0x8a,
+    0x2a, 0x2c, 0x5d, 0xce, 0x4b, 0x14, 0xb8, 0xa5, 0xc5, 0x2e, 0x2b, 0xdb, 0x3f, 0x34, 0x4c, 0x4c,
+    0x52, 0xd2, 0xd1, 0x49, 0xb2, 0xd0, 0x94, 0xb4, 0x52, 0xd6, 0x6e, 0x45, 0xa1, 0x28, 0xa5, 0xa2,
+    0xb1, 0x94, 0x8b, 0x42, 0x51, 0x45, 0x15, 0x84, 0xa6, 0x5a, 0x0a, 0x28, 0xa2, 0xb9, 0xe5, 0x33,
+    0x44, 0x14, 0x51, 0x45, 0x73, 0xca, 0xa1, 0x68, 0x4a, 0x28, 0xa2, 0xb9, 0xe5, 0x50, 0xd1, 0x05,
+    0x14, 0x51, 0x58, 0x4a, 0xa1, 0x68, 0x28, 0xa2, 0x8a, 0xc2, 0x55, 0x0b, 0x42, 0xd1, 0x45, 0x15,
+    0x93, 0xa8, 0x5a, 0x0a, 0x28, 0xa5, 0xac, 0x9c, 0xcb, 0x41, 0x45, 0x14, 0xb5, 0x0e, 0x65, 0xa0,
+    0xa2, 0x8a, 0x5a, 0x87, 0x32, 0xd0, 0x52, 0xd2, 0x52, 0xd4, 0xf3, 0x94, 0x82, 0x96, 0x8a, 0x29,
+    0x73, 0x96, 0x85, 0xa5, 0xa4, 0xa5, 0xa3, 0x9c, 0xa4, 0x2d, 0x14, 0x52, 0xd1, 0xce, 0x52, 0x0a,
+    0x51, 0x45, 0x2d, 0x3e, 0x72, 0x90, 0x53, 0xa9, 0x29, 0x45, 0x35, 0x50, 0xa4, 0x2d, 0x2d, 0x25,
+    0x28, 0xab, 0x55, 0x0a, 0x14, 0x53, 0x85, 0x34, 0x53, 0x85, 0x5a, 0xa8, 0x52, 0x14, 0x53, 0x85,
+    0x34, 0x53, 0x85, 0x6a, 0xaa, 0x0c, 0x51, 0x4e, 0x14, 0xd1, 0x4e, 0x15, 0xac, 0x6a, 0x0c, 0x51,
+    0x4e, 0x14, 0xd1, 0x4e, 0x15, 0xbc, 0x6a, 0x0c, 0x70, 0xa5, 0x14, 0x82, 0x94, 0x56, 0xd1, 0x99,
+    0x43, 0x85, 0x28, 0xa4, 0x14, 0xe1, 0x5b, 0xc6, 0x63, 0x14, 0x52, 0x8a, 0x41, 0x4e, 0x15, 0xb4,
+    0x66, 0x31, 0x45, 0x28, 0xa4, 0x14, 0xe1, 0x5a, 0x29, 0x0c, 0x29, 0x68, 0xa5, 0xab, 0xb9, 0x48,
+    0x31, 0x46, 0x29, 0x69, 0x71, 0x41, 0x49, 0x89, 0x8a, 0x29, 0xd8, 0xa2, 0x91, 0x57, 0x39, 0x2c,
+    0x51, 0x4b, 0x45, 0x7a, 0xed, 0x9f, 0x9b, 0x20, 0xa2, 0x96, 0x8a, 0xcd, 0xc8, 0xa4, 0x25, 0x14,
+    0xb4, 0x56, 0x32, 0x91, 0xa2, 0x12, 0x8a, 0x5a, 0x4a, 0xe7, 0x94, 0xcb, 0x41, 0x45, 0x14, 0x57,
+    0x34, 0xe6, 0x68, 0x84, 0xa2, 0x8a, 0x2b, 0x9a, 0x75, 0x0b, 0x41, 0x45, 0x14, 0x57, 0x34, 0xaa,
+    0x1a, 0x21, 0x28, 0xa2, 0x8a, 0xe7, 0x95, 0x43, 0x44, 0x14, 0x51, 0x45, 0x61, 0x29, 0x96, 0x82,
+    0x96, 0x8a, 0x2b, 0x17, 0x32, 0xd0, 0x51, 0x45, 0x2d, 0x64, 0xe6, 0x5a, 0x12, 0x96, 0x8a, 0x2a,
+    0x1c, 0xcb, 0x41, 0x4b, 0x45, 0x2d, 0x43, 0x91, 0x68, 0x28, 0xa2, 0x96, 0xa7, 0x98, 0xa4, 0x14,
+    0x52, 0xd1, 0x4b, 0x98, 0xa4, 0x14, 0xb4, 0x52, 0xd2, 0xe6, 0x2d, 0x05, 0x2d, 0x14, 0x52, 0xe6,
+    0x29, 0x05, 0x2d, 0x14, 0xb4, 0x73, 0x14, 0x82, 0x96, 0x8a, 0x5a, 0x39, 0x8b, 0x41, 0x4b, 0x45,
+    0x2d, 0x3e, 0x62, 0x90, 0x0a, 0x51, 0x45, 0x2d, 0x52, 0x99, 0x48, 0x05, 0x38, 0x52, 0x52, 0x8a,
+    0xa5, 0x31, 0x8a, 0x29, 0xc2, 0x9a, 0x29, 0xc2, 0xb4, 0x53, 0x28, 0x51, 0x4e, 0x14, 0xd1, 0x4e,
+    0x15, 0xac, 0x6a, 0x0c, 0x51, 0x4e, 0x14, 0xd1, 0x4e, 0x15, 0xbc, 0x6a, 0x0c, 0x70, 0xa5, 0x14,
+    0x82, 0x9c, 0x2b, 0x78, 0xd4, 0x28, 0x51, 0x4e, 0x14, 0xd1, 0x4e, 0x15, 0xbc, 0x66, 0x03, 0x85,
+    0x28, 0xa4, 0x14, 0xe1, 0x5d, 0x11, 0x98, 0xc5, 0x14, 0xe1, 0x48, 0x29, 0x45, 0x6f, 0x19, 0x14,
+    0x28, 0xa5, 0x14, 0x0a, 0x51, 0x5a, 0xa9, 0x0c, 0x29, 0x68, 0xa7, 0x55, 0xdc, 0xa4, 0x26, 0x28,
+    0xa5, 0xa2, 0x8b, 0x8e, 0xe7, 0x25, 0x8a, 0x5a, 0x5a, 0x2b, 0xd4, 0x6c, 0xfc, 0xd9, 0x09, 0x45,
+    0x2d, 0x15, 0x8c, 0xa4, 0x5a, 0x12, 0x92, 0x96, 0x8a, 0xe7, 0x9c, 0xcd, 0x10, 0x94, 0x52, 0xd2,
+    0x57, 0x2c, 0xe6, 0x68, 0x84, 0xa2, 0x96, 0x92, 0xb9, 0x67, 0x32, 0xd0, 0x52, 0x52, 0xd2, 0x57,
+    0x2c, 0xe6, 0x68, 0x82, 0x8a, 0x28, 0xae, 0x69, 0x4c, 0xd1, 0x05, 0x14, 0x51, 0x5c, 0xf2, 0x99,
+    0x68, 0x28, 0xa2, 0x96, 0xb1, 0x73, 0x2d, 0x09, 0x4b, 0x45, 0x15, 0x93, 0x91, 0x68, 0x28, 0xa5,
+    0xa2, 0xa1, 0xc8, 0xb4, 0x14, 0x52, 0xd2, 0xe2, 0xa5, 0xb2, 0xd0, 0x94, 0xb8, 0xa3, 0x14, 0xb8,
+    0xa5, 0x72, 0x93, 0x13, 0x14, 0xb8, 0xa5, 0xc5, 0x2e, 0x29, 0x5c, 0xb4, 0xc4, 0xc5, 0x2e, 0x28,
+    0xc5, 0x2e, 0x29, 0x14, 0x98, 0x98, 0xa5, 0xc5, 0x2e, 0x29, 0x71, 0x48, 0xa4, 0xc4, 0xc5, 0x2e,
+    0x28, 0xc5, 0x2e, 0x29, 0x16, 0x98, 0x98, 0xa5, 0xc5, 0x2e, 0x29, 0x71, 0x4a, 0xe5, 0x26, 0x26,
+    0x29, 0x68, 0xc5, 0x2e, 0x28, 0xb9, 0x49, 0x85, 0x2d, 0x18, 0xa5, 0xa5, 0x72, 0x90, 0x94, 0xb4,
+    0xb4, 0x53, 0xe6, 0x2d, 0x05, 0x38, 0x52, 0x52, 0xd3, 0x52, 0x29, 0x0a, 0x29, 0x45, 0x14, 0xa2,
+    0xad, 0x4c, 0x62, 0x8a, 0x51, 0x48, 0x29, 0x45, 0x68, 0xa6, 0x50, 0xe1, 0x4a, 0x29, 0x05, 0x38,
+    0x56, 0xb1, 0x98, 0xc5, 0x14, 0xe1, 0x4d, 0x14, 0xe1, 0x5b, 0xc6, 0x63, 0x1c, 0x29, 0xc2, 0x9a,
+    0x29, 0xc2, 0xba, 0x23, 0x31, 0x8a, 0x29, 0xc2, 0x90, 0x53, 0x85, 0x74, 0xc6, 0x63, 0x14, 0x53,
+    0x85, 0x20, 0xa5, 0x15, 0xd1, 0x19, 0x8c, 0x70, 0xa5, 0x14, 0x82, 0x9c, 0x2b, 0xa2, 0x32, 0x18,
+    0xa2, 0x94, 0x52, 0x0a, 0x70, 0xad, 0x54, 0x86, 0x18, 0xa2, 0x96, 0x8a, 0xbb, 0x8c, 0xe4, 0xa8,
+    0xa2, 0x8a, 0xf4, 0x65, 0x23, 0xf3, 0x74, 0x25, 0x14, 0xb4, 0x57, 0x34, 0xe4, 0x5a, 0x12, 0x92,
+    0x96, 0x8a, 0xe5, 0x9c, 0xcd, 0x10, 0x94, 0x94, 0xb4, 0x57, 0x24, 0xe6, 0x68, 0x84, 0xa2, 0x8a,
+    0x2b, 0x92, 0x73, 0x34, 0x42, 0x51, 0x45, 0x15, 0xcb, 0x39, 0x9a, 0x20, 0xa2, 0x8a, 0x2b, 0x9e,
+    0x53, 0x2d, 0x05, 0x14, 0x51, 0x58, 0xb9, 0x1a, 0x20, 0xa2, 0x96, 0x8a, 0xc9, 0xc8, 0xa4, 0x14,
+    0x52, 0xd2, 0xe2, 0xa5, 0xb2, 0xd0, 0x94, 0xb8, 0xa3, 0x14, 0xb8, 0xa9, 0x2d, 0x31, 0x31, 0x4b,
+    0x8a, 0x5c, 0x52, 0xe2, 0x82, 0x93, 0x13, 0x14, 0xb8, 0xa5, 0xc5, 0x2e, 0x28, 0xb1, 0x49, 0x89,
+    0x8a, 0x31, 0x4e, 0xc5, 0x18, 0xa2, 0xc5, 0x26, 0x26, 0x29, 0x71, 0x4b, 0x8a, 0x5c, 0x51, 0x62,
+    0x93, 0x13, 0x14, 0xb8, 0xa5, 0xc5, 0x2e, 0x28, 0xb1, 0x69, 0x8d, 0xc5, 0x2e, 0x29, 0x71, 0x4b,
+    0x8a, 0x56, 0x29, 0x31, 0x31, 0x46, 0x29, 0xd8, 0xa3, 0x15, 0x36, 0x29, 0x31, 0x31, 0x4b, 0x8a,
+    0x5c, 0x52, 0xe2, 0x93, 0x45, 0xa6, 0x37, 0x14, 0xb8, 0xa5, 0xc5, 0x2e, 0x2a, 0x4b, 0x4c, 0x4c,
+    0x52, 0xe2, 0x8c, 0x52, 0xe2, 0x91, 0x49, 0x89, 0x4b, 0x4b, 0x8a, 0x5c, 0x52, 0xb9, 0x48, 0x4a,
+    0x5a, 0x29, 0x69, 0xdc, 0xa4, 0x28, 0xa5, 0x14, 0x94, 0xea, 0xa5, 0x22, 0x80, 0x53, 0x85, 0x20,
+    0xa5, 0x15, 0xa2, 0x99, 0x43, 0x85, 0x28, 0xa4, 0x14, 0xe1, 0x5b, 0x46, 0x63, 0x14, 0x53, 0x85,
+    0x34, 0x53, 0x85, 0x74, 0x46, 0x63, 0x1c, 0x29, 0xc2, 0x9a, 0x29, 0xc2, 0xba, 0x61, 0x31, 0x8e,
+    0x14, 0xe1, 0x4d, 0x14, 0xe1, 0x5d, 0x30, 0x98, 0x0e, 0x14, 0xe1, 0x4d, 0x14, 0xe1, 0x5d, 0x31,
+    0x98, 0xc5, 0x14, 0xe1, 0x48, 0x29, 0xc2, 0xba, 0x23, 0x21, 0x85, 0x14, 0xb4, 0x56, 0x9c, 0xc3,
+    0x39, 0x1a, 0x29, 0x68, 0xae, 0xf9, 0xc8, 0xfc, 0xdd, 0x09, 0x49, 0x4b, 0x45, 0x72, 0x4e, 0x66,
+    0x88, 0x4a, 0x4a, 0x5a, 0x4a, 0xe4, 0x9c, 0xcd, 0x10, 0x52, 0x52, 0xd2, 0x57, 0x1c, 0xe6, 0x68,
+    0x82, 0x92, 0x96, 0x8a, 0xe5, 0x9c, 0xcd, 0x10, 0x94, 0x51, 0x45, 0x73, 0x4a, 0x45, 0xa0, 0xa2,
+    0x8a, 0x5a, 0xc2, 0x52, 0x34, 0x42, 0x51, 0x4b, 0x4b, 0x59, 0xb6, 0x52, 0x12, 0x8c, 0x52, 0xe2,
+    0x97, 0x15, 0x17, 0x2d, 0x31, 0x31, 0x4b, 0x8a, 0x5c, 0x52, 0xe2, 0x82, 0x93, 0x13, 0x14, 0xb8,
+    0xa5, 0xc5, 0x2e, 0x29, 0xd8, 0xa4, 0xc4, 0xc5, 0x2e, 0x29, 0x71, 0x4b, 0x8a, 0x76, 0x29, 0x31,
+    0x31, 0x4b, 0x8a, 0x50, 0x29, 0x71, 0x55, 0xca, 0x52, 0x62, 0x62, 0x97, 0x14, 0xb8, 0xa5, 0xc5,
+    0x57, 0x29, 0x49, 0x89, 0x8a, 0x31, 0x4e, 0xc5, 0x2e, 0x28, 0xe5, 0x29, 0x31, 0xb8, 0xa5, 0xc5,
+    0x3b, 0x14, 0xb8, 0xa3, 0x94, 0xa4, 0xc6, 0xe2, 0x97, 0x14, 0xec, 0x51, 0x8a, 0x5c, 0xa5, 0xa6,
+    0x37, 0x14, 0xb8, 0xa7, 0x62, 0x8c, 0x54, 0xb8, 0x94, 0x98, 0xdc, 0x52, 0xe2, 0x9d, 0x8a, 0x31,
+    0x50, 0xe2, 0x5a, 0x63, 0x71, 0x4b, 0x8a, 0x76, 0x28, 0xc5, 0x43, 0x89, 0x69, 0x8d, 0xc5, 0x2e,
+    0x29, 0x71, 0x4b, 0x8a, 0x86, 0x8b, 0x4c, 0x6e, 0x29, 0x71, 0x4b, 0x8a, 0x5c, 0x54, 0x32, 0x93,
+    0x13, 0x14, 0xb8, 0xa3, 0x14, 0xb8, 0xa9, 0x2d, 0x31, 0x29, 0x69, 0x71, 0x4b, 0x45, 0xca, 0x40,
+    0x29, 0x45, 0x14, 0xa2, 0xad, 0x48, 0xa0, 0x14, 0xe1, 0x48, 0x29, 0xc2, 0xb4, 0x8c, 0x86, 0x28,
+    0xa7, 0x0a, 0x68, 0xa7, 0x0a, 0xde, 0x33, 0x18, 0xa2, 0x9c, 0x29, 0x05, 0x38, 0x57, 0x44, 0x26,
+    0x31, 0xc2, 0x9c, 0x29, 0xa2, 0x9c, 0x2b, 0xaa, 0x13, 0x18, 0xe1, 0x4e, 0x14, 0xd1, 0x4e, 0x15,
+    0xd5, 0x09, 0x80, 0xe1, 0x4a, 0x29, 0x05, 0x38, 0x57, 0x4c, 0x64, 0x31, 0x68, 0xa5, 0xa2, 0xb6,
+    0xe6, 0x19, 0xc8, 0xd2, 0x53, 0xa9, 0x2b, 0xb6, 0x72, 0x3f, 0x37, 0x42, 0x52, 0x53, 0xa9, 0x2b,
+    0x8e, 0x73, 0x34, 0x42, 0x52, 0x52, 0xd1, 0x5c, 0x73, 0x99, 0xa2, 0x1b, 0x45, 0x2d, 0x15, 0xc9,
+    0x39, 0x9a, 0x21, 0xb4, 0x52, 0xd1, 0x5c, 0xb2, 0x91, 0xa2, 0x12, 0x8a, 0x5a, 0x2b, 0x9e, 0x52,
+    0x2d, 0x09, 0x8a, 0x5a, 0x5a, 0x2b, 0x36, 0xcb, 0x42, 0x62, 0x97, 0x14, 0xb8, 0xa5, 0xc5, 0x49,
+    0x69, 0x89, 0x8a, 0x5c, 0x51, 0x8a, 0x76, 0x28, 0x29, 0x31, 0x00, 0xa5, 0xc5, 0x28, 0x14, 0xa0,
+    0x55, 0x24, 0x52, 0x62, 0x62, 0x94, 0x0a, 0x50, 0x29, 0xc0, 0x55, 0xa8, 0x8e, 0xe3, 0x40, 0xa7,
+    0x01, 0x4a, 0x05, 0x28, 0x15, 0xa2, 0x89, 0x57, 0x10, 0x0a, 0x50, 0x29, 0xc0, 0x52, 0xe2, 0xad,
+    0x40, 0xa4, 0xc6, 0xe2, 0x97, 0x14, 0xec, 0x52, 0xe2, 0xad, 0x40, 0x69, 0x8d, 0xc5, 0x2e, 0x29,
+    0xd8, 0xa5, 0xc5, 0x3e, 0x42, 0x93, 0x1b, 0x8a, 0x5c, 0x53, 0xb1, 0x4b, 0x8a, 0x39, 0x0b, 0x4c,
+    0x6e, 0x28, 0xc5, 0x3f, 0x14, 0x62, 0x93, 0x81, 0x49, 0x8d, 0xc5, 0x18, 0xa7, 0xe2, 0x8c, 0x54,
+    0x38, 0x16, 0x98, 0xdc, 0x51, 0x8a, 0x76, 0x29, 0x71, 0x59, 0xb8, 0x14, 0x98, 0xcc, 0x51, 0x8a,
+    0x7e, 0x28, 0xc5, 0x66, 0xe2, 0x5a, 0x63, 0x71, 0x46, 0x29, 0xd8, 0xa3, 0x15, 0x93, 0x89, 0x69,
+    0x8d, 0xc5, 0x2e, 0x29, 0xd8, 0xa3, 0x15, 0x93, 0x45, 0xa6, 0x37, 0x14, 0xb8, 0xa5, 0xc5, 0x2e,
+    0x2b, 0x36, 0x8b, 0x4c, 0x6e, 0x29, 0x71, 0x4b, 0x8a, 0x5c, 0x54, 0x16, 0x98, 0x98, 0xa5, 0x02,
+    0x8a, 0x5a, 0x2e, 0x52, 0x60, 0x29, 0x45, 0x14, 0xa2, 0xa9, 0x48, 0xa1, 0x45, 0x38, 0x52, 0x0a,
+    0x51, 0x5a, 0xc6, 0x43, 0x14, 0x53, 0x85, 0x20, 0xa7, 0x0a, 0xe8, 0x8c, 0xc6, 0x28, 0xa7, 0x8a,
+    0x68, 0xa7, 0x0a, 0xe9, 0x84, 0xc6, 0x38, 0x53, 0x85, 0x34, 0x53, 0x85, 0x75, 0xc2, 0x63, 0x1c,
+    0x29, 0xc2, 0x90, 0x53, 0x85, 0x75, 0x42, 0x40, 0x2d, 0x14, 0x51, 0x5b, 0xf3, 0x0c, 0xe4, 0x68,
+    0xa5, 0xa2, 0xbb, 0x2a, 0x48, 0xfc, 0xdd, 0x0d, 0xa4, 0xa7, 0x52, 0x57, 0x1d, 0x49, 0x1a, 0x21,
+    0x29, 0x29, 0x68, 0xae, 0x29, 0xc8, 0xd1, 0x09, 0x49, 0x4b, 0x45, 0x72, 0x4e, 0x46, 0x88, 0x4a,
+    0x29, 0x68, 0xae, 0x79, 0x48, 0xd1, 0x09, 0x45, 0x2d, 0x15, 0x8b, 0x65, 0xa0, 0xc5, 0x18, 0xa5,
+    0xc5, 0x2e, 0x2a, 0x4a, 0x4c, 0x4c, 0x52, 0xe2, 0x97, 0x14, 0xb8, 0xa0, 0xb4, 0xc4, 0xc5, 0x38,
+    0x0a, 0x00, 0xa7, 0x01, 0x5a, 0x24, 0x3b, 0x88, 0x05, 0x28, 0x14, 0xa0, 0x53, 0x80, 0xad, 0x14,
+    0x4a, 0xb8, 0x80, 0x52, 0x81, 0x4a, 0x05, 0x38, 0x0a, 0xd6, 0x31, 0x1d, 0xc4, 0x02, 0x94, 0x0a,
+    0x70, 0x14, 0xa0, 0x56, 0xca, 0x03, 0xb8, 0x80, 0x52, 0x81, 0x4e, 0x02, 0x94, 0x0a, 0xd1, 0x40,
+    0xa4, 0xc6, 0xe2, 0x97, 0x14, 0xe0, 0x29, 0x71, 0x5a, 0x28, 0x0e, 0xe3, 0x71, 0x4b, 0x8a, 0x7e,
+    0x29, 0x71, 0x55, 0xc8, 0x52, 0x63, 0x31, 0x4b, 0x8a, 0x76, 0x29, 0x71, 0x47, 0x21, 0x49, 0x8d,
+    0xc5, 0x18, 0xa7, 0xe2, 0x8c, 0x52, 0x70, 0x2d, 0x31, 0xb8, 0xa3, 0x14, 0xfc, 0x51, 0x8a, 0x87,
+    0x02, 0xd3, 0x19, 0x8a, 0x5c, 0x53, 0xb1, 0x4b, 0x8a, 0xca, 0x50, 0x2d, 0x31, 0x98, 0xa3, 0x14,
+    0xfc, 0x51, 0x8a, 0xc6, 0x50, 0x2d, 0x31, 0x98, 0xa3, 0x14, 0xfc, 0x51, 0x8a, 0xc6, 0x50, 0x2d,
+    0x31, 0x98, 0xa3, 0x14, 0xfc, 0x52, 0x62, 0xb0, 0x94, 0x4b, 0x4c, 0x6e, 0x29, 0x71, 0x4b, 0x8a,
+    0x5c, 0x56, 0x12, 0x46, 0x89, 0x8d, 0xc5, 0x18, 0xa7, 0x62, 0x8c, 0x56, 0x4d, 0x16, 0x98, 0x98,
+    0xa3, 0x14, 0xb8, 0xa5, 0xc5, 0x41, 0x49, 0x89, 0x4a, 0x29, 0x69, 0x68, 0xb9, 0x68, 0x05, 0x28,
+    0xa0, 0x52, 0x8a, 0xb5, 0x21, 0x8a, 0x29, 0xc2, 0x90, 0x52, 0x8a, 0xda, 0x32, 0x28, 0x70, 0xa7,
+    0x0a, 0x68, 0xa7, 0x0a, 0xe8, 0x84, 0x80, 0x70, 0xa7, 0x0a, 0x68, 0xa7, 0x8a, 0xeb, 0x84, 0x86,
+    0x28, 0xa7, 0x0a, 0x41, 0x4e, 0x15, 0xd7, 0x09, 0x00, 0xb4, 0x52, 0xd1, 0x5b, 0xf3, 0x01, 0xc8,
+    0xd2, 0x53, 0xa9, 0x2b, 0xb6, 0xa4, 0x8f, 0xce, 0x10, 0xda, 0x29, 0x69, 0x2b, 0x86, 0xa4, 0x8d,
+    0x10, 0x94, 0x94, 0xea, 0x4a, 0xe3, 0x9c, 0x8d, 0x10, 0x94, 0x52, 0xd1, 0x5c, 0xb2, 0x91, 0xa2,
+    0x12, 0x8a, 0x5a, 0x2b, 0x16, 0xcb, 0x42, 0x52, 0xd2, 0xe2, 0x8c, 0x56, 0x77, 0x2d, 0x30, 0xc5,
+    0x2e, 0x28, 0x02, 0x97, 0x14, 0x22, 0x93, 0x0c, 0x52, 0x81, 0x4a, 0x05, 0x28, 0x15, 0xa2, 0x45,
+    0x5c, 0x00, 0xa5, 0x02, 0x94, 0x0a, 0x70, 0x15, 0xac, 0x62, 0x3b, 0x88, 0x05, 0x28, 0x14, 0xa0,
+    0x53, 0x80, 0xad, 0xe3, 0x11, 0xdc, 0x40, 0x29, 0xc0, 0x52, 0x81, 0x4e, 0x02, 0xb7, 0x8c, 0x07,
+    0x71, 0xa0, 0x53, 0x80, 0xa5, 0x02, 0x9c, 0x05, 0x6f, 0x18, 0x0e, 0xe3, 0x40, 0xa7, 0x01, 0x4a,
+    0x05, 0x38, 0x0a, 0xd9, 0x40, 0xab, 0x8d, 0x02, 0x9d, 0x8a, 0x50, 0x29, 0xd8, 0xad, 0x14, 0x07,
+    0x71, 0xb8, 0xa5, 0xc5, 0x3b, 0x14, 0xb8, 0xaa, 0xe4, 0x29, 0x31, 0x98, 0xa5, 0xc5, 0x3b, 0x14,
+    0xb8, 0xa3, 0x90, 0xa4, 0xc6, 0xe2, 0x97, 0x14, 0xec, 0x52, 0xe2, 0x93, 0x81, 0x69, 0x8c, 0xc5,
+    0x18, 0xa7, 0xe2, 0x8c, 0x54, 0x38, 0x16, 0x98, 0xdc, 0x51, 0x8a, 0x7e, 0x28, 0xc5, 0x65, 0x28,
+    0x16, 0x98, 0xcc, 0x51, 0x8a, 0x7e, 0x28, 0xc5, 0x61, 0x28, 0x16, 0x98, 0xcc, 0x52, 0x62, 0xa4,
+    0xc5, 0x26, 0x2b, 0x9e, 0x50, 0x2d, 0x31, 0x98, 0xa3, 0x14, 0xfc, 0x51, 0x8a, 0xe6, 0x94, 0x4d,
+    0x13, 0x19, 0x8a, 0x31, 0x4e, 0xc5, 0x18, 0xae, 0x79, 0x44, 0xd1, 0x31, 0xb8, 0xa3, 0x14, 0xec,
+    0x51, 0x8a, 0xe7, 0x92, 0x2d, 0x31, 0xb8, 0xa3, 0x14, 0xec, 0x51, 0x8a, 0xc5, 0x96, 0x98, 0x98,
+    0xa5, 0xc5, 0x2e, 0x28, 0xc5, 0x41, 0x69, 0x85, 0x28, 0xa2, 0x96, 0x9a, 0x65, 0x20, 0x14, 0xe1,
+    0x48, 0x29, 0xc2, 0xb4, 0x8c, 0x86, 0x28, 0xa7, 0x0a, 0x41, 0x4e, 0x15, 0xd1, 0x09, 0x0c, 0x51,
+    0x4e, 0x14, 0x82, 0x9c, 0x2b, 0xaa, 0x12, 0x18, 0xa2, 0x9e, 0x29, 0xa2, 0x9c, 0x2b, 0xae, 0x12,
+    0x01, 0xd4, 0x51, 0x45, 0x74, 0x73, 0x0c, 0xe4, 0xa9, 0x29, 0x68, 0xae, 0xda, 0x92, 0x3f, 0x37,
+    0x43, 0x69, 0x29, 0xd4, 0x95, 0xc3, 0x52, 0x46, 0x88, 0x6d, 0x14, 0xb4, 0x57, 0x24, 0xe4, 0x68,
+    0x84, 0xa2, 0x96, 0x8a, 0xe6, 0x93, 0x34, 0x42, 0x62, 0x8c, 0x52, 0xd2, 0xe2, 0xb2, 0x6c, 0xb4,
+    0xc4, 0xc5, 0x2e, 0x29, 0x71, 0x4b, 0x8a, 0x45, 0x26, 0x20, 0x14, 0xa0, 0x52, 0x81, 0x4a, 0x05,
+    0x5a, 0x45, 0x5c, 0x00, 0xa5, 0x02, 0x94, 0x0a, 0x70, 0x15, 0xb4, 0x50, 0xee, 0x20, 0x14, 0xe0,
+    0x29, 0x40, 0xa7, 0x01, 0x5d, 0x11, 0x88, 0xee, 0x20, 0x14, 0xe0, 0x29, 0x40, 0xa7, 0x01, 0x5d,
+    0x10, 0x88, 0xee, 0x20, 0x14, 0xe0, 0x29, 0x40, 0xa5, 0x02, 0xba, 0x63, 0x01, 0xdc, 0x40, 0x29,
+    0xc0, 0x52, 0x81, 0x4e, 0x02, 0xb7, 0x8c, 0x07, 0x71, 0xa0, 0x53, 0x80, 0xa5, 0x02, 0x9c, 0x05,
+    0x6c, 0xa0, 0x3b, 0x8d, 0x02, 0x94, 0x0a, 0x76, 0x29, 0x71, 0x5a, 0x28, 0x15, 0x71, 0x31, 0x4b,
+    0x8a, 0x5c, 0x52, 0xe2, 0xab, 0x94, 0x69, 0x8d, 0xc5, 0x2e, 0x29, 0xd8, 0xa5, 0xc5, 0x1c, 0xa5,
+    0x26, 0x37, 0x14, 0xb8, 0xa7, 0x62, 0x8c, 0x52, 0x71, 0x2d, 0x31, 0xb8, 0xa3, 0x14, 0xfc, 0x51,
+    0x8a, 0x87, 0x12, 0xd3, 0x1b, 0x8a, 0x31, 0x4e, 0xc5, 0x2e, 0x2b, 0x29, 0x40, 0xb4, 0xc6, 0x62,
+    0x8c, 0x53, 0xf1, 0x49, 0x8a, 0xc2, 0x50, 0x2d, 0x31, 0x98, 0xa3, 0x14, 0xfc, 0x51, 0x8a, 0xe7,
+    0x9c, 0x0d, 0x13, 0x19, 0x8a, 0x4c, 0x54, 0x98, 0xa4, 0xc5, 0x72, 0xce, 0x25, 0xa6, 0x33, 0x14,
+    0x62, 0x9f, 0x8a, 0x4c, 0x57, 0x24, 0xe2, 0x68, 0x98, 0xcc, 0x51, 0x8a, 0x7e, 0x29, 0x31, 0x5c,
+    0xd3, 0x46, 0x89, 0x8d, 0xc5, 0x18, 0xa7, 0x62, 0x8c, 0x57, 0x34, 0x91, 0x69, 0x8d, 0xc5, 0x2e,
+    0x29, 0x71, 0x4b, 0x8a, 0xc9, 0x9a, 0x26, 0x26, 0x28, 0xc5, 0x2e, 0x29, 0x71, 0x53, 0x72, 0x93,
+    0x01, 0x4a, 0x28, 0xa5, 0x15, 0x49, 0x94, 0x28, 0xa7, 0x0a, 0x41, 0x4e, 0x15, 0xb4, 0x64, 0x31,
+    0x45, 0x38, 0x52, 0x0a, 0x70, 0xae, 0xa8, 0x48, 0x62, 0x8a, 0x70, 0xa4, 0x14, 0xe1, 0x5d, 0x70,
+    0x90, 0x0b, 0x45, 0x2d, 0x15, 0xd1, 0xcc, 0x07, 0x23, 0x49, 0x4e, 0xa4, 0xae, 0xda, 0x92, 0x3f,
+    0x38, 0x42, 0x52, 0x53, 0xa9, 0x2b, 0x8a, 0x72, 0x34, 0x43, 0x68, 0xa5, 0xa2, 0xb9, 0x26, 0xcd,
+    0x10, 0x94, 0x52, 0xd1, 0x8a, 0xc2, 0x4c, 0xb4, 0x14, 0x62, 0x97, 0x14, 0xb8, 0xa8, 0x2d, 0x31,
+    0x31, 0x4a, 0x05, 0x28, 0x14, 0xa0, 0x53, 0x45, 0x5c, 0x00, 0xa5, 0x02, 0x94, 0x0a, 0x50, 0x2b,
+    0x58, 0xa1, 0xdc, 0x00, 0xa7, 0x01, 0x40, 0x14, 0xe0, 0x2b, 0xa2, 0x08, 0x77, 0x00, 0x29, 0xc0,
+    0x50, 0x05, 0x3c, 0x0a, 0xea, 0x84, 0x47, 0x71, 0x00, 0xa7, 0x01, 0x4a, 0x05, 0x38, 0x0a, 0xea,
+    0x84, 0x42, 0xe2, 0x01, 0x4e, 0x02, 0x94, 0x0a, 0x70, 0x15, 0xd3, 0x18, 0x8e, 0xe2, 0x01, 0x4e,
+    0x02, 0x80, 0x29, 0xc0, 0x57, 0x44, 0x62, 0x3b, 0x88, 0x05, 0x3b, 0x14, 0x01, 0x52, 0xc3, 0x0c,
+    0x93, 0xb8, 0x48, 0x90, 0xbb, 0x1e, 0xc0, 0x55, 0xbb, 0x45, 0x5e, 0x4e, 0xc8, 0xa5, 0xa9, 0x1e,
+    0x29, 0xca, 0xa5, 0x98, 0x2a, 0x82, 0x49, 0x38, 0x00, 0x77, 0xad, 0xab, 0x4d, 0x13, 0xa3, 0xdd,
+    0xbf, 0xbe, 0xc5, 0xfe, 0xa7, 0xfc, 0x3f, 0x3a, 0xd6, 0x86, 0x08, 0x60, 0x5c, 0x43, 0x1a, 0xa0,
+    0xc0, 0x07, 0x03, 0xaf, 0xd7, 0xd6, 0xbc, 0x3c, 0x5f, 0x10, 0xe1, 0xe8, 0xbe, 0x5a, 0x4b, 0x9d,
+    0xfd, 0xcb, 0xef, 0x3a, 0x21, 0x46, 0x4f, 0x7d, 0x0e, 0x72, 0x1d, 0x2a, 0xf2, 0x5d, 0xa7, 0xca,
+    0xd8, 0xa7, 0xbb, 0x9c, 0x63, 0xf0, 0xeb, 0x56, 0xd3, 0x41, 0x62, 0xa3, 0x7d, 0xc0, 0x0d, 0xdc,
+    0x05, 0xc8, 0xfc, 0xf3, 0x5b, 0x94, 0x57, 0x87, 0x5b, 0x88, 0x71, 0x93, 0x7e, 0xe3, 0x51, 0xf4,
+    0x5f, 0xe7, 0x73, 0x75, 0x46, 0x28, 0xcb, 0x5d, 0x0e, 0xdb, 0x68, 0xdd, 0x24, 0xa4, 0xe3, 0x92,
+    0x08, 0x1f, 0xd2, 0x97, 0xfb, 0x12, 0xd7, 0xfb, 0xf3, 0x7e, 0x63, 0xfc, 0x2b, 0x4e, 0x8a, 0xe3,
+    0x79, 0xb6, 0x35, 0xff, 0x00, 0xcb, 0xc6, 0x57, 0x24, 0x7b, 0x19, 0x32, 0x68, 0x71, 0x1c, 0x79,
+    0x53, 0x3a, 0xfa, 0xee, 0x00, 0xff, 0x00, 0x85, 0x41, 0x2e, 0x89, 0x32, 0xf3, 0x14, 0x88, 0xe0,
+    0x0e, 0xfc, 0x12, 0x7d, 0x2b, 0x76, 0x8a, 0xda, 0x9e, 0x79, 0x8e, 0x87, 0xdb, 0xbf, 0xaa, 0x5f,
+    0xf0, 0xff, 0x00, 0x88, 0x7b, 0x38, 0x9c, 0xb4, 0xd6, 0x77, 0x10, 0x0c, 0xcb, 0x13, 0x01, 0xd7,
+    0x3d, 0x47, 0xe6, 0x2a, 0x1c, 0x57, 0x5f, 0x55, 0x6e, 0x2c, 0x2d, 0xae, 0x01, 0xdd, 0x18, 0x56,
+    0x3c, 0xee, 0x5e, 0x0f, 0xff, 0x00, 0x5e, 0xbd, 0x6c, 0x3f, 0x12, 0x27, 0xa5, 0x78, 0x7c, 0xd7,
+    0xf9, 0x3f, 0xf3, 0x25, 0xd3, 0xec, 0x73, 0x58, 0xa3, 0x15, 0xa1, 0x73, 0xa5, 0xcf, 0x0f, 0x31,
+    0x8f, 0x35, 0x7f, 0xd9, 0x1c, 0xfe, 0x55, 0x4b, 0x15, 0xf4, 0x14, 0x6b, 0xd2, 0xc4, 0x47, 0x9e,
+    0x94, 0xae, 0xbf, 0xaf, 0xb8, 0x5a, 0xad, 0xc6, 0x62, 0x8c, 0x53, 0xf1, 0x46, 0x28, 0x94, 0x4a,
+    0x4c, 0x66, 0x28, 0xc5, 0x3f, 0x14, 0x98, 0xae, 0x79, 0xc4, 0xd1, 0x31, 0x98, 0xa3, 0x14, 0xfc,
+    0x52, 0x62, 0xb9, 0x67, 0x13, 0x44, 0xc6, 0x62, 0x8c, 0x53, 0xf1, 0x49, 0x8a, 0xe3, 0x9c, 0x4d,
+    0x13, 0x19, 0x8a, 0x31, 0x4e, 0xc5, 0x18, 0xae, 0x49, 0xa3, 0x44, 0xc6, 0x62, 0x8c, 0x53, 0xb1,
+    0x46, 0x2b, 0x96, 0x68, 0xd1, 0x31, 0xb8, 0xa3, 0x14, 0xec, 0x51, 0x8a, 0xe7, 0x91, 0x69, 0x89,
+    0x8a, 0x31, 0x4b, 0x8a, 0x5c, 0x56, 0x6c, 0xb4, 0xc4, 0xc5, 0x28, 0xa5, 0xc5, 0x2e, 0x28, 0x4c,
+    0xa4, 0x02, 0x9c, 0x29, 0x05, 0x38, 0x56, 0x91, 0x65, 0x00, 0xa7, 0x8a, 0x68, 0xa7, 0x0a, 0xe9,
+    0x84, 0x86, 0x38, 0x53, 0x85, 0x20, 0xa7, 0x0a, 0xeb, 0x84, 0x80, 0x5a, 0x29, 0x68, 0xae, 0x8e,
+    0x60, 0x39, 0x1a, 0x4a, 0x75, 0x25, 0x77, 0x54, 0x67, 0xe6, 0xe8, 0x4a, 0x4a, 0x75, 0x25, 0x71,
+    0x4d, 0x9a, 0xa1, 0xb4, 0x53, 0xa9, 0x2b, 0x96, 0x4c, 0xb4, 0x26, 0x29, 0x69, 0x71, 0x46, 0x2b,
+    0x16, 0xcd, 0x10, 0x98, 0xa5, 0xc5, 0x2e, 0x29, 0x40, 0xa4, 0x52, 0x62, 0x01, 0x4e, 0x02, 0x80,
+    0x29, 0xc0, 0x55, 0xc4, 0xab, 0x80, 0x14, 0xe0, 0x28, 0x02, 0x9c, 0x05, 0x6f, 0x04, 0x3b, 0x80,
+    0x14, 0xe0, 0x28, 0x02, 0x9c, 0x05, 0x75, 0x41, 0x05, 0xc0, 0x0a, 0x70, 0x14, 0x01, 0x4e, 0x02,
+    0xba, 0xe1, 0x11, 0xdc, 0x00, 0xa7, 0x01, 0x4a, 0x05, 0x38, 0x0a, 0xeb, 0x84, 0x42, 0xe2, 0x01,
+    0x4e, 0x02, 0x94, 0x0a, 0x50, 0x2b, 0xa6, 0x31, 0x1d, 0xc0, 0x0a, 0x50, 0x29, 0x40, 0xad, 0x2d,
+    0x2f, 0x4d, 0x37, 0x4c, 0x25, 0x98, 0x11, 0x08, 0x3f, 0xf7, 0xdf, 0xff, 0x00, 0x5a, 0x96, 0x23,
+    0x11, 0x4f, 0x0d, 0x4d, 0xd5, 0xaa, 0xec, 0x91, 0x70, 0x8b, 0x9b, 0xb2, 0x23, 0xd3, 0xf4, 0xd9,
+    0x6e, 0xd9, 0x5d, 0x81, 0x48, 0x73, 0xcb, 0x7a, 0xfd, 0x2b, 0xa1, 0xb6, 0xb6, 0x86, 0xd6, 0x30,
+    0x90, 0xa0, 0x1c, 0x72, 0x7b, 0xb7, 0xd4, 0xd4, 0xaa, 0x02, 0xa8, 0x55, 0x00, 0x00, 0x30, 0x00,
+    0xed, 0x4b, 0x5f, 0x07, 0x98, 0x66, 0xb5, 0xb1, 0xb2, 0xb3, 0xd2, 0x3d, 0xbf, 0xcf, 0xbb, 0x3d,
+    0x2a, 0x74, 0x94, 0x17, 0x98, 0x51, 0x45, 0x15, 0xe5, 0x9a, 0x85, 0x14, 0x51, 0x40, 0x05, 0x14,
+    0x51, 0x40, 0x05, 0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40, 0x05, 0x52, 0xbc, 0xd3, 0xe2, 0xb8,
+    0x05, 0xd0, 0x04, 0x93, 0xd4, 0x74, 0x27, 0xde, 0xae, 0xd1, 0x5b, 0xd0, 0xc4, 0x55, 0xc3, 0xcf,
+    0x9e, 0x93, 0xb3, 0x13, 0x57, 0x39, 0x89, 0x61, 0x92, 0x17, 0xd9, 0x2a, 0x95, 0x6e, 0xb4, 0xcc,
+    0x57, 0x47, 0x75, 0x6c, 0x97, 0x31, 0x6d, 0x7e, 0x08, 0xfb, 0xad, 0xdc, 0x56, 0x14, 0xd0, 0x3c,
+    0x12, 0x18, 0xe4, 0x18, 0x23, 0xf5, 0xaf, 0xb7, 0xcb, 0x73, 0x38, 0x63, 0x61, 0x67, 0xa4, 0xd6,
+    0xeb, 0xf5, 0x5f, 0xd6, 0x86, 0x6d, 0x58, 0x87, 0x14, 0x62, 0x9d, 0x8a, 0x31, 0x5d, 0xd3, 0x89,
+    0x49, 0x8c, 0xc5, 0x18, 0xa7, 0xe2, 0x93, 0x15, 0xcb, 0x38, 0x96, 0x98, 0xcc, 0x51, 0x8a, 0x7e,
+    0x29, 0x31, 0x5c, 0x55, 0x22, 0x6a, 0x98, 0xcc, 0x52, 0x62, 0x9f, 0x8a, 0x4c, 0x57, 0x1d, 0x44,
+    0x68, 0x98, 0xdc, 0x52, 0x62, 0x9f, 0x8a, 0x4c, 0x57, 0x1c, 0xd1, 0xa2, 0x63, 0x71, 0x46, 0x29,
+    0xd8, 0xa4, 0xc5, 0x72, 0xc8, 0xd1, 0x31, 0x31, 0x46, 0x29, 0x71, 0x4b, 0x8a, 0xc5, 0x96, 0x98,
+    0x98, 0xa5, 0xc5, 0x18, 0xa5, 0xa9, 0xb9, 0x49, 0x80, 0x14, 0xe1, 0x48, 0x05, 0x38, 0x55, 0xa6,
+    0x50, 0x0a, 0x70, 0xa0, 0x53, 0x85, 0x74, 0x41, 0x8c, 0x51, 0x4e, 0x14, 0x82, 0x9c, 0x2b, 0xaa,
+    0x0c, 0x62, 0xd1, 0x4b, 0x45, 0x74, 0xdc, 0x0e, 0x46, 0x92, 0x9f, 0x49, 0x5d, 0xd5, 0x19, 0xf9,
+    0xba, 0x1b, 0x49, 0x4e, 0xa4, 0xae, 0x39, 0xb3, 0x44, 0xc4, 0xa2, 0x96, 0x8c, 0x57, 0x2c, 0x99,
+    0xa2, 0x62, 0x62, 0x97, 0x14, 0xb4, 0x56, 0x6d, 0x96, 0x98, 0x98, 0xa5, 0x02, 0x97, 0x14, 0xa0,
+    0x50, 0x8a, 0x4c, 0x00, 0xa7, 0x01, 0x40, 0x14, 0xa0, 0x56, 0xb1, 0x1d, 0xc0, 0x0a, 0x78, 0x14,
+    0x01, 0x4e, 0x02, 0xba, 0x20, 0x87, 0x70, 0x02, 0x9c, 0x05, 0x00, 0x53, 0x80, 0xae, 0xc8, 0x20,
+    0xb8, 0x01, 0x4f, 0x02, 0x80, 0x29, 0xc0, 0x57, 0x64, 0x10, 0xee, 0x00, 0x53, 0x80, 0xa0, 0x0a,
+    0x70, 0x15, 0xd7, 0x04, 0x17, 0x00, 0x29, 0xc0, 0x50, 0x05, 0x4b, 0x04, 0x4d, 0x34, 0xa9, 0x12,
+    0x0f, 0x99, 0x8e, 0x05, 0x6f, 0x75, 0x14, 0xe4, 0xf6, 0x43, 0x5a, 0xe8, 0x59, 0xd3, 0x2c, 0x4d,
+    0xd4, 0xc1, 0x9d, 0x4f, 0x92, 0xa7, 0xe6, 0x39, 0xc6, 0x7d, 0xab, 0xa5, 0x50, 0x15, 0x42, 0xa8,
+    0x00, 0x01, 0x80, 0x07, 0x6a, 0x8a, 0xd6, 0xdd, 0x2d, 0xa0, 0x58, 0x90, 0x0e, 0x07, 0x27, 0x1d,
+    0x4f, 0xad, 0x4d, 0x5f, 0x9f, 0x66, 0x99, 0x84, 0xb1, 0xb5, 0xae, 0xbe, 0x15, 0xb7, 0xf9, 0xfa,
+    0xb3, 0xd7, 0xa3, 0x4b, 0xd9, 0xc7, 0xcc, 0x28, 0xa2, 0x8a, 0xf3, 0x0d, 0x82, 0x8a, 0x28, 0xa0,
+    0x02, 0x8a, 0x28, 0xa0, 0x02, 0x8a, 0x28, 0xa0, 0x02, 0x8a, 0x28, 0xa0, 0x02, 0x8a, 0x28, 0xa0,
+    0x02, 0x8a, 0x28, 0xa0, 0x02, 0xa0, 0xba, 0xb7, 0x5b, 0x88, 0x8a, 0x90, 0x37, 0x0f, 0xba, 0x7d,
+    0x0d, 0x4f, 0x45, 0x69, 0x4a, 0xac, 0xa9, 0x4d, 0x4e, 0x0e, 0xcd, 0x01, 0xcd, 0xbc, 0x6d, 0x1b,
+    0x94, 0x75, 0x21, 0x87, 0x51, 0x4d, 0xc5, 0x6b, 0xea, 0x56, 0xdb, 0xd3, 0xce, 0x40, 0x37, 0x2f,
+    0xde, 0xe3, 0xa8, 0xac, 0xac, 0x57, 0xdf, 0xe0, 0xb1, 0x71, 0xc5, 0xd1, 0x55, 0x16, 0xfd, 0x7d,
+    0x4c, 0x9e, 0x8c, 0x6e, 0x29, 0x31, 0x4f, 0xc5, 0x18, 0xab, 0x9a, 0x29, 0x31, 0x98, 0xa4, 0xc5,
+    0x3f, 0x14, 0x98, 0xae, 0x3a, 0x88, 0xd5, 0x31, 0x98, 0xa4, 0xc5, 0x49, 0x8a, 0x4c, 0x57, 0x15,
+    0x44, 0x68, 0x98, 0xcc, 0x52, 0x62, 0x9f, 0x8a, 0x4c, 0x57, 0x15, 0x44, 0x68, 0x98, 0xdc, 0x52,
+    0x62, 0x9f, 0x8a, 0x4c, 0x57, 0x24, 0xcd, 0x13, 0x1b, 0x8a, 0x31, 0x4e, 0xc5, 0x18, 0xae, 0x79,
+    0x1a, 0x26, 0x26, 0x29, 0x71, 0x46, 0x29, 0x6a, 0x0b, 0x4c, 0x05, 0x28, 0xa0, 0x53, 0x85, 0x34,
+    0xca, 0xb8, 0x0a, 0x70, 0xa4, 0x14, 0xe1, 0x5b, 0xc5, 0x8c, 0x51, 0x4e, 0x14, 0x82, 0x9c, 0x2b,
+    0xaa, 0x0c, 0x2e, 0x2d, 0x14, 0xa2, 0x8a, 0xe8, 0xb8, 0xce, 0x4a, 0x92, 0x9d, 0x49, 0x5d, 0xf5,
+    0x19, 0xf9, 0xb2, 0x1b, 0x45, 0x2d, 0x15, 0xc7, 0x36, 0x68, 0x84, 0xa2, 0x96, 0x8a, 0xe7, 0x93,
+    0x34, 0x4c, 0x4c, 0x52, 0xd1, 0x8a, 0x5c, 0x56, 0x65, 0xa6, 0x18, 0xa5, 0x02, 0x80, 0x29, 0x40,
+    0xa6, 0x8a, 0xb8, 0x01, 0x4e, 0x02, 0x80, 0x29, 0xc0, 0x56, 0xd1, 0x1d, 0xc0, 0x0a, 0x78, 0x14,
+    0x80, 0x53, 0x80, 0xae, 0xa8, 0x0e, 0xe2, 0x81, 0x4e, 0x02, 0x80, 0x29, 0xc0, 0x57, 0x65, 0x34,
+    0x17, 0x14, 0x0a, 0x70, 0x14, 0x80, 0x53, 0xc0, 0xae, 0xd8, 0x20, 0xb8, 0x01, 0x4e, 0x02, 0x80,
+    0x29, 0xc0, 0x57, 0x5c, 0x10, 0x5c, 0x00, 0xad, 0x9d, 0x0e, 0xd7, 0xef, 0x5c, 0xb8, 0xff, 0x00,
+    0x65, 0x33, 0xfa, 0x9f, 0xe9, 0xf9, 0xd6, 0x4a, 0xa9, 0x66, 0x0a, 0xa0, 0x92, 0x78, 0x00, 0x77,
+    0xae, 0xae, 0x08, 0x84, 0x30, 0x24, 0x4b, 0x8c, 0x2a, 0x81, 0x90, 0x31, 0x9f, 0x7a, 0xf1, 0xf8,
+    0x83, 0x16, 0xe8, 0xe1, 0xd5, 0x28, 0xef, 0x3f, 0xc9, 0x6e, 0x76, 0xe0, 0xe1, 0xcd, 0x3e, 0x67,
+    0xd0, 0x92, 0x8a, 0x28, 0xaf, 0x87, 0x3d, 0x40, 0xa2, 0x8a, 0x28, 0x00, 0xa2, 0x8a, 0x28, 0x00,
+    0xa2, 0x8a, 0x28, 0x00, 0xa2, 0x8a, 0x28, 0x00, 0xa2, 0x8a, 0x28, 0x00, 0xa2, 0x8a, 0x28, 0x00,
+    0xa2, 0x8a, 0x28, 0x00, 0xa2, 0x8a, 0x28, 0x01, 0x08, 0x04, 0x10, 0x46, 0x41, 0xea, 0x0d, 0x61,
+    0xdc, 0x42, 0x61, 0x99, 0x93, 0xb7, 0x63, 0xea, 0x2b, 0x76, 0xa8, 0xea, 0x71, 0xe6, 0x35, 0x90,
+    0x0e, 0x54, 0xe0, 0xf1, 0xdb, 0xfc, 0xff, 0x00, 0x3a, 0xf6, 0xb2, 0x3c, 0x53, 0xa5, 0x88, 0xf6,
+    0x6f, 0x69, 0x69, 0xf3, 0xe9, 0xfe, 0x44, 0x4d, 0x68, 0x65, 0xe2, 0x8c, 0x53, 0xb1, 0x46, 0x2b,
+    0xeb, 0xe6, 0x89, 0x4c, 0x66, 0x29, 0x31, 0x4f, 0xc5, 0x26, 0x2b, 0x92, 0xa2, 0x34, 0x4c, 0x6e,
+    0x29, 0x31, 0x4e, 0xc5, 0x18, 0xae, 0x1a, 0x88, 0xd1, 0x31, 0x98, 0xa4, 0xc5, 0x3f, 0x14, 0x98,
+    0xae, 0x1a, 0x86, 0xa9, 0x8c, 0xc5, 0x18, 0xa7, 0x62, 0x8c, 0x57, 0x1c, 0xcd, 0x13, 0x1b, 0x8a,
+    0x31, 0x4b, 0x8a, 0x31, 0x5c, 0xd2, 0x34, 0x4c, 0x4c, 0x52, 0xe2, 0x97, 0x14, 0x56, 0x4c, 0xb4,
+    0xc3, 0x14, 0xa2, 0x81, 0x4a, 0x29, 0xa6, 0x55, 0xc0, 0x53, 0x85, 0x02, 0x94, 0x56, 0xb1, 0x63,
+    0x14, 0x53, 0x85, 0x20, 0xa7, 0x8a, 0xea, 0x83, 0x18, 0x51, 0x4e, 0xa2, 0xba, 0x2e, 0x17, 0x39,
+    0x1a, 0x4a, 0x7d, 0x25, 0x7a, 0x15, 0x19, 0xf9, 0xb2, 0x1b, 0x49, 0x4e, 0xa3, 0x15, 0xc9, 0x36,
+    0x6a, 0x98, 0xda, 0x31, 0x4e, 0xc5, 0x18, 0xae, 0x79, 0x32, 0xd3, 0x13, 0x14, 0xb8, 0xa3, 0x14,
+    0xb8, 0xa8, 0x2d, 0x30, 0x02, 0x94, 0x0a, 0x00, 0xa7, 0x01, 0x54, 0x8a, 0xb8, 0x01, 0x4e, 0x02,
+    0x90, 0x0a, 0x70, 0x15, 0xb4, 0x07, 0x71, 0x40, 0xa7, 0x01, 0x48, 0x05, 0x3c, 0x0a, 0xeb, 0x80,
+    0x5c, 0x50, 0x29, 0xc0, 0x52, 0x01, 0x4f, 0x02, 0xbb, 0x29, 0x85, 0xc0, 0x0a, 0x78, 0x14, 0x80,
+    0x53, 0x80, 0xae, 0xd8, 0x05, 0xc5, 0x02, 0x9c, 0x05, 0x20, 0x14, 0xf0, 0x2b, 0xae, 0x03, 0xb9,
+    0x6f, 0x4a, 0x8b, 0xcc, 0xbf, 0x8f, 0x2b, 0x90, 0x9f, 0x31, 0xe7, 0xa6, 0x3a, 0x7e, 0xb8, 0xae,
+    0x8e, 0xb1, 0xf4, 0x24, 0x5d, 0xf3, 0x3e, 0x3e, 0x60, 0x00, 0x07, 0xd8, 0xe7, 0xfc, 0x05, 0x6c,
+    0x57, 0xc5, 0x71, 0x05, 0x67, 0x3c, 0x63, 0x8f, 0xf2, 0xa4, 0xbf, 0x5f, 0xd4, 0xf6, 0x30, 0x51,
+    0xb5, 0x2b, 0xf7, 0x0a, 0x28, 0xa2, 0xbc, 0x33, 0xac, 0x28, 0xa2, 0x8a, 0x00, 0x28, 0xa2, 0x8a,
+    0x00, 0x28, 0xa2, 0xb9, 0x6f, 0x15, 0xf8, 0x9a, 0x4d, 0x2e, 0x51, 0x65, 0x62, 0x10, 0xdc, 0x15,
+    0xdc, 0xee, 0xdc, 0x88, 0xc1, 0xe8, 0x00, 0xfe, 0xf7, 0x7e, 0x7d, 0xb8, 0x39, 0xad, 0x68, 0xd1,
+    0x95, 0x69, 0x72, 0x43, 0x72, 0x65, 0x25, 0x15, 0x76, 0x74, 0x57, 0x37, 0x96, 0xb6, 0x9b, 0x7e,
+    0xd5, 0x73, 0x0c, 0x1b, 0xf3, 0xb7, 0xcc, 0x90, 0x2e, 0x71, 0xd7, 0x19, 0xa8, 0x3f, 0xb6, 0x34,
+    0xaf, 0xfa, 0x09, 0xd9, 0xff, 0x00, 0xdf, 0xf5, 0xff, 0x00, 0x1a, 0xf2, 0x59, 0xa6, 0x96, 0xe2,
+    0x56, 0x96, 0x79, 0x5e, 0x59, 0x1b, 0xab, 0xbb, 0x16, 0x27, 0xf1, 0x34, 0xca, 0xf5, 0xa3, 0x94,
+    0xc6, 0xda, 0xcb, 0x53, 0x9d, 0xe2, 0x1f, 0x44, 0x7b, 0x4a, 0x3a, 0x49, 0x1a, 0xc9, 0x1b, 0x2b,
+    0xa3, 0x00, 0x55, 0x94, 0xe4, 0x10, 0x7b, 0x83, 0x4e, 0xaf, 0x24, 0xd2, 0x75, 0xab, 0xed, 0x22,
+    0x5d, 0xd6, 0xb2, 0xe5, 0x0e, 0x77, 0x44, 0xf9, 0x28, 0xc4, 0xf7, 0xc6, 0x7a, 0xf0, 0x39, 0xf6,
+    0xaf, 0x4d, 0xd1, 0xf5, 0x28, 0xb5, 0x6d, 0x3a, 0x3b, 0xb8, 0x46, 0xdd, 0xd9, 0x0c, 0x9b, 0x81,
+    0x28, 0xc3, 0xa8, 0x3f, 0xcf, 0xe8, 0x45, 0x70, 0xe2, 0xb0, 0x53, 0xa1, 0xae, 0xe8, 0xd6, 0x9d,
+    0x55, 0x32, 0xf5, 0x14, 0x51, 0x5c, 0x46, 0xa1, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01,
+    0x51, 0xce, 0x9e, 0x64, 0x0e, 0x98, 0xc9, 0x23, 0x81, 0xef, 0xda, 0xa4, 0xa2, 0xae, 0x13, 0x70,
+    0x92, 0x9c, 0x77, 0x5a, 0x81, 0x83, 0x8a, 0x4c, 0x54, 0xb2, 0xa8, 0x59, 0x9d, 0x54, 0x70, 0x18,
+    0x81, 0x4c, 0xc5, 0x7e, 0x8d, 0xcc, 0xa5, 0x15, 0x25, 0xd4, 0xc1, 0x0d, 0xc5, 0x26, 0x29, 0xf8,
+    0xa4, 0xc5, 0x72, 0xd4, 0x34, 0x4c, 0x66, 0x29, 0x31, 0x4f, 0xc5, 0x26, 0x2b, 0x86, 0xa1, 0xa2,
+    0x63, 0x31, 0x49, 0x8a, 0x7e, 0x29, 0x31, 0x5c, 0x35, 0x0d, 0x13, 0x1b, 0x8a, 0x4c, 0x53, 0xb1,
+    0x46, 0x2b, 0x8a, 0x66, 0xa9, 0x8d, 0xc5, 0x18, 0xa5, 0xc5, 0x18, 0xae, 0x59, 0x1a, 0x26, 0x26,
+    0x29, 0x71, 0x4b, 0x8a, 0x31, 0x59, 0x32, 0xd3, 0x10, 0x0a, 0x70, 0x14, 0x52, 0x8a, 0x11, 0x49,
+    0x80, 0xa7, 0x0a, 0x40, 0x29, 0xc0, 0x56, 0xb1, 0x63, 0xb8, 0xa2, 0x9c, 0x29, 0x05, 0x38, 0x57,
+    0x4c, 0x18, 0xc5, 0xc5, 0x14, 0xb4, 0x57, 0x45, 0xc2, 0xe7, 0x25, 0x8a, 0x4c, 0x53, 0xb1, 0x46,
+    0x2b, 0xd1, 0xa8, 0xcf, 0xcd, 0xd3, 0x19, 0x45, 0x3b, 0x14, 0x62, 0xb9, 0x26, 0xcd, 0x13, 0x1b,
+    0x8a, 0x29, 0xd4, 0x62, 0xb9, 0xe4, 0x5a, 0x62, 0x62, 0x8c, 0x52, 0xe2, 0x97, 0x15, 0x05, 0xa6,
+    0x02, 0x94, 0x0a, 0x00, 0xa7, 0x01, 0x54, 0x8a, 0xb8, 0x01, 0x4e, 0x02, 0x90, 0x0a, 0x70, 0x15,
+    0xd1, 0x01, 0xdc, 0x50, 0x29, 0xc0, 0x50, 0x05, 0x38, 0x0a, 0xea, 0x80, 0x5c, 0x51, 0x4e, 0x14,
+    0x80, 0x53, 0xc0, 0xae, 0xda, 0x61, 0x71, 0x40, 0xa7, 0x01, 0x48, 0x05, 0x3c, 0x0a, 0xed, 0x80,
+    0x5c, 0x00, 0xa7, 0x01, 0x40, 0x14, 0xe0, 0x2b, 0xaa, 0x03, 0xb9, 0xb5, 0xa2, 0x80, 0x2d, 0x5c,
+    0xe0, 0x64, 0xbe, 0x33, 0xf8, 0x0a, 0xd1, 0xac, 0xfd, 0x1b, 0xfe, 0x3d, 0x1b, 0xfe, 0xba, 0x1f,
+    0xe4, 0x2b, 0x42, 0xbe, 0x03, 0x35, 0x77, 0xc6, 0x54, 0xf5, 0x3d, 0xec, 0x37, 0xf0, 0xa2, 0x14,
+    0x51, 0x45, 0x79, 0xc6, 0xe1, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x04, 0x17, 0xb7, 0x1f,
+    0x64, 0xb1, 0xb8, 0xb9, 0xd9, 0xbf, 0xc9, 0x89, 0xa4, 0xdb, 0x9c, 0x67, 0x03, 0x38, 0xcd, 0x78,
+    0xf4, 0xf3, 0x49, 0x71, 0x3c, 0x93, 0xcc, 0xdb, 0xa4, 0x91, 0x8b, 0xb1, 0xc6, 0x32, 0x49, 0xc9,
+    0xaf, 0x5a, 0xd6, 0xff, 0x00, 0xe4, 0x07, 0xa8, 0x7f, 0xd7, 0xb4, 0x9f, 0xfa, 0x09, 0xaf, 0x22,
+    0xaf, 0x6f, 0x29, 0x8a, 0xe5, 0x93, 0xea, 0x72, 0xe2, 0x1e, 0xa8, 0x28, 0xa2, 0x8a, 0xf5, 0xce,
+    0x60, 0xae, 0x93, 0xc0, 0xb7, 0xb2, 0x5b, 0xeb, 0x7f, 0x64, 0x03, 0x31, 0xdd, 0x29, 0x0c, 0x3d,
+    0x0a, 0x82, 0xc0, 0xff, 0x00, 0x31, 0xf8, 0xfb, 0x57, 0x37, 0x5b, 0x5e, 0x0d, 0xff, 0x00, 0x91,
+    0xa2, 0xcf, 0xfe, 0x07, 0xff, 0x00, 0xa0, 0x35, 0x61, 0x8a, 0x8a, 0x74, 0x66, 0x9f, 0x66, 0x5d,
+    0x37, 0x69, 0x23, 0xd4, 0x68, 0xa2, 0x8a, 0xf9, 0x43, 0xd0, 0x0a, 0x28, 0xa2, 0x80, 0x0a, 0x28,
+    0xa2, 0x80, 0x0a, 0x28, 0xa2, 0x80, 0x32, 0xaf, 0x00, 0x17, 0x4f, 0x81, 0x8e, 0x9f, 0xca, 0xa1,
+    0xc5, 0x58, 0xbc, 0x1f, 0xe9, 0x2f, 0xf8, 0x7f, 0x2a, 0x83, 0x15, 0xfa, 0x0e, 0x15, 0xff, 0x00,
+    0xb3, 0x53, 0xff, 0x00, 0x0a, 0xfc, 0x8e, 0x77, 0xbb, 0x1b, 0x8a, 0x4c, 0x53, 0xf1, 0x49, 0x8a,
+    0x9a, 0x85, 0x26, 0x37, 0x14, 0x98, 0xa7, 0x62, 0x93, 0x15, 0xc3, 0x50, 0xd5, 0x31, 0xb8, 0xa4,
+    0xc5, 0x3b, 0x14, 0x98, 0xae, 0x0a, 0x86, 0x89, 0x8d, 0xc5, 0x26, 0x29, 0xf8, 0xa4, 0xc5, 0x71,
+    0x4c, 0xd5, 0x31, 0xb8, 0xa3, 0x14, 0xec, 0x52, 0x62, 0xb9, 0x64, 0x68, 0x98, 0x98, 0xa3, 0x14,
+    0xec, 0x51, 0x8a, 0xc5, 0x96, 0x98, 0x98, 0xa5, 0x02, 0x97, 0x14, 0xa0, 0x50, 0x8a, 0x4c, 0x05,
+    0x38, 0x0a, 0x40, 0x29, 0xc0, 0x56, 0xb1, 0x1d, 0xc0, 0x53, 0xc0, 0xa4, 0x02, 0x9c, 0x05, 0x74,
+    0xc1, 0x8e, 0xe2, 0xd1, 0x4b, 0x8a, 0x2b, 0xa2, 0xe1, 0x73, 0x92, 0xc5, 0x26, 0x29, 0xf8, 0xa4,
+    0xc5, 0x7a, 0x55, 0x0f, 0xcd, 0xd3, 0x1b, 0x8a, 0x4c, 0x53, 0xb1, 0x46, 0x2b, 0x8e, 0x66, 0x89,
+    0x8d, 0xc5, 0x18, 0xa7, 0x62, 0x8c, 0x57, 0x3c, 0x8b, 0x4c, 0x4c, 0x52, 0xe2, 0x8c, 0x52, 0xe2,
+    0xa0, 0xb4, 0xc0, 0x0a, 0x50, 0x28, 0x14, 0xa0, 0x55, 0xa6, 0x55, 0xc5, 0x02, 0x9c, 0x05, 0x20,
+    0x14, 0xe0, 0x2b, 0x78, 0x31, 0xdc, 0x50, 0x29, 0xc0, 0x52, 0x0a, 0x78, 0xae, 0xa8, 0x30, 0xb8,
+    0xa0, 0x53, 0x85, 0x20, 0xa7, 0x0a, 0xed, 0xa6, 0xc0, 0x70, 0xa7, 0x01, 0x48, 0x29, 0xc2, 0xbb,
+    0x60, 0xc0, 0x51, 0x4e, 0x02, 0x90, 0x53, 0x85, 0x75, 0x41, 0x8e, 0xe6, 0xbe, 0x8c, 0xf9, 0x8a,
+    0x48, 0xf1, 0xf7, 0x58, 0x1c, 0xfd, 0x7f, 0xfd, 0x55, 0xa5, 0x59, 0x1a, 0x3b, 0xed, 0x9d, 0xe3,
+    0x38, 0xc3, 0x2e, 0x7f, 0x11, 0xff, 0x00, 0xeb, 0x35, 0xaf, 0x5f, 0x0f, 0x9d, 0xd3, 0xe4, 0xc6,
+    0xcf, 0xce, 0xcf, 0xf0, 0xff, 0x00, 0x33, 0xdd, 0xc1, 0xcb, 0x9a, 0x8a, 0x0a, 0x28, 0xa2, 0xbc,
+    0x93, 0xa8, 0x28, 0xa2, 0x8a, 0x00, 0x28, 0xa2, 0x8a, 0x00, 0x6b, 0xa2, 0x49, 0x1b, 0x47, 0x22,
+    0xab, 0xa3, 0x02, 0x19, 0x58, 0x64, 0x10, 0x7b, 0x11, 0x5e, 0x4d, 0xae, 0xe9, 0x72, 0x69, 0x1a,
+    0x9c, 0x96, 0xcf, 0xca, 0x1f, 0x9e, 0x26, 0xce, 0x4b, 0x21, 0x27, 0x19, 0xf7, 0xe3, 0x07, 0xe9,
+    0x5e, 0xb7, 0x54, 0x75, 0x4d, 0x2a, 0xcf, 0x56, 0x80, 0x45, 0x7b, 0x16, 0xed, 0xb9, 0xd8, 0xe0,
+    0xe1, 0x90, 0x91, 0xd4, 0x1f, 0xe9, 0xd3, 0x81, 0x5d, 0xb8, 0x2c, 0x57, 0xb0, 0x9e, 0xbb, 0x33,
+    0x2a, 0xb4, 0xf9, 0xd1, 0xe4, 0x54, 0x57, 0x49, 0x7f, 0xe0, 0xad, 0x52, 0xde, 0x50, 0x2c, 0xf6,
+    0x5d, 0xc6, 0x7a, 0x30, 0x60, 0x84, 0x74, 0xea, 0x09, 0xfa, 0xf4, 0x27, 0xa5, 0x55, 0xff, 0x00,
+    0x84, 0x4b, 0x5d, 0xff, 0x00, 0x9f, 0x1f, 0xfc, 0x8c, 0x9f, 0xfc, 0x55, 0x7b, 0xd1, 0xc5, 0x51,
+    0x6a, 0xea, 0x6b, 0xef, 0x39, 0x1d, 0x39, 0x2e, 0x86, 0x2d, 0x76, 0xfe, 0x03, 0xd2, 0x0a, 0x86,
+    0xd5, 0xa7, 0x55, 0xf9, 0x81, 0x48, 0x39, 0x07, 0xbe, 0x19, 0xbd, 0xba, 0x60, 0x7e, 0x34, 0x68,
+    0xbe, 0x09, 0x0a, 0x56, 0x6d, 0x61, 0xd5, 0xf8, 0xff, 0x00, 0x8f, 0x74, 0x27, 0xb8, 0xee, 0xc3,
+    0xd3, 0x9e, 0x07, 0xb7, 0x35, 0xd9, 0x22, 0x24, 0x71, 0xac, 0x71, 0xaa, 0xa2, 0x28, 0x01, 0x55,
+    0x46, 0x00, 0x03, 0xb0, 0x15, 0xe6, 0xe3, 0xb1, 0xd1, 0x94, 0x7d, 0x9d, 0x3f, 0x9b, 0x37, 0xa5,
+    0x49, 0xa7, 0xcd, 0x21, 0xd4, 0x51, 0x45, 0x78, 0xc7, 0x48, 0x51, 0x45, 0x14, 0x00, 0x51, 0x45,
+    0x14, 0x00, 0x51, 0x45, 0x21, 0x20, 0x0c, 0x9e, 0x05, 0x30, 0x33, 0x2e, 0x4e, 0xeb, 0x87, 0x38,
+    0xef, 0x8f, 0xca, 0xa3, 0xc5, 0x39, 0x89, 0x66, 0x2c, 0x7a, 0x93, 0x9a, 0x4a, 0xfd, 0x0a, 0x10,
+    0xf6, 0x74, 0xe3, 0x0e, 0xc9, 0x23, 0x92, 0xf7, 0x63, 0x69, 0x31, 0x4e, 0xa2, 0xb0, 0xa8, 0xcd,
+    0x10, 0xda, 0x4c, 0x53, 0xa9, 0x2b, 0x8a, 0xa3, 0x34, 0x4c, 0x6e, 0x29, 0x31, 0x4e, 0xa4, 0xc5,
+    0x70, 0x54, 0x66, 0x88, 0x6e, 0x29, 0x29, 0xd8, 0xa2, 0xb8, 0xa6, 0xcd, 0x53, 0x1b, 0x8a, 0x31,
+    0x4b, 0x8a, 0x2b, 0x96, 0x4c, 0xd1, 0x31, 0x31, 0x46, 0x29, 0x71, 0x4b, 0x8a, 0xc9, 0x96, 0x98,
+    0x98, 0xa5, 0x02, 0x97, 0x14, 0xa0, 0x50, 0x8a, 0x4c, 0x00, 0xa7, 0x01, 0x48, 0x05, 0x38, 0x0a,
+    0xd2, 0x23, 0xb8, 0xa0, 0x53, 0x80, 0xa4, 0x02, 0x9c, 0x05, 0x75, 0x40, 0x77, 0x17, 0x14, 0x52,
+    0xe2, 0x8a, 0xe8, 0x0b, 0x9c, 0x96, 0x29, 0x31, 0x4f, 0xc5, 0x26, 0x2b, 0xd3, 0xa8, 0x7e, 0x6c,
+    0x98, 0xdc, 0x52, 0x62, 0x9d, 0x8a, 0x31, 0x5c, 0x73, 0x35, 0x4c, 0x6e, 0x28, 0xc5, 0x3b, 0x14,
+    0x62, 0xb9, 0xa4, 0x5a, 0x62, 0x62, 0x8c, 0x52, 0xe2, 0x97, 0x15, 0x05, 0xa6, 0x18, 0xa5, 0x14,
+    0x0a, 0x50, 0x29, 0xa6, 0x55, 0xc5, 0x14, 0xa0, 0x50, 0x29, 0xc2, 0xb7, 0x8b, 0x18, 0xa2, 0x9c,
+    0x29, 0x05, 0x38, 0x57, 0x54, 0x18, 0xc5, 0x14, 0xf1, 0x4d, 0x14, 0xf1, 0x5d, 0x94, 0xd8, 0x0a,
+    0x29, 0xc2, 0x90, 0x53, 0x85, 0x76, 0xc1, 0x80, 0xe1, 0x4e, 0x14, 0x82, 0x9c, 0x2b, 0xae, 0x0c,
+    0x09, 0xad, 0x24, 0xf2, 0x6e, 0x63, 0x90, 0xe3, 0x00, 0xf3, 0x9f, 0x4e, 0xf5, 0xd0, 0x57, 0x36,
+    0x2b, 0x76, 0xca, 0x5f, 0x3a, 0xd9, 0x4e, 0x4e, 0xe1, 0xf2, 0xb6, 0x7d, 0x6b, 0xe7, 0xb8, 0x8b,
+    0x0f, 0x75, 0x0a, 0xeb, 0xd1, 0xfe, 0x9f, 0xa9, 0xea, 0x65, 0xd5, 0x37, 0x83, 0xf5, 0x27, 0xa2,
+    0x8a, 0x2b, 0xe5, 0x4f, 0x54, 0x28, 0xa2, 0x8a, 0x00, 0x28, 0xa2, 0x8a, 0x00, 0x28, 0xa2, 0x8a,
+    0x00, 0x28, 0xa2, 0x8a, 0x00, 0x28, 0xa2, 0x8a, 0x00, 0x28, 0xa2, 0x8a, 0x00, 0x28, 0xa2, 0x8a,
+    0x00, 0x28, 0xa2, 0x8a, 0x00, 0x2a, 0x2b, 0x96, 0xdb, 0x0b, 0x7a, 0x9e, 0x2a, 0x5a, 0xa7, 0x78,
+    0xf9, 0x60, 0x83, 0xb7, 0x5a, 0xef, 0xcb, 0x28, 0x7b, 0x6c, 0x4c, 0x57, 0x45, 0xab, 0xf9, 0x7f,
+    0x56, 0x22, 0xa4, 0xad, 0x12, 0xb5, 0x25, 0x3a, 0x92, 0xbe, 0xd6, 0x6c, 0xe5, 0x42, 0x52, 0x53,
+    0xa9, 0x2b, 0x92, 0xa3, 0x34, 0x43, 0x69, 0x29, 0xd4, 0x95, 0xc3, 0x51, 0x9a, 0x21, 0xb4, 0x94,
+    0xea, 0x4a, 0xe1, 0xa8, 0xcd, 0x50, 0x98, 0xa4, 0xa7, 0x52, 0x57, 0x14, 0xd9, 0xa2, 0x13, 0x14,
+    0x62, 0x96, 0x8c, 0x57, 0x34, 0x99, 0xa2, 0x62, 0x62, 0x8c, 0x52, 0xe2, 0x97, 0x15, 0x93, 0x2d,
+    0x31, 0x31, 0x4a, 0x05, 0x2e, 0x29, 0x40, 0xa1, 0x14, 0x98, 0x01, 0x4e, 0x02, 0x80, 0x29, 0x40,
+    0xad, 0xa2, 0x3b, 0x8a, 0x05, 0x38, 0x0a, 0x40, 0x29, 0xc0, 0x57, 0x4c, 0x07, 0x71, 0x71, 0x45,
+    0x2e, 0x28, 0xae, 0x80, 0xb9, 0xc9, 0x62, 0x8c, 0x53, 0xb1, 0x49, 0x8a, 0xf5, 0x2a, 0x1f, 0x9b,
+    0x26, 0x37, 0x14, 0x98, 0xa7, 0xe2, 0x93, 0x15, 0xc7, 0x33, 0x44, 0xc6, 0xe2, 0x8c, 0x53, 0xb1,
+    0x46, 0x2b, 0x9a, 0x46, 0x89, 0x89, 0x8a, 0x31, 0x4b, 0x8a, 0x5c, 0x56, 0x4c, 0xb4, 0xc4, 0xc5,
+    0x28, 0x14, 0xa0, 0x52, 0x81, 0x4d, 0x32, 0xae, 0x02, 0x9c, 0x29, 0x00, 0xa7, 0x01, 0x5a, 0xc5,
+    0x8c, 0x51, 0x4e, 0x14, 0x82, 0x9c, 0x2b, 0xa6, 0x0c, 0x62, 0x8a, 0x78, 0xa6, 0x8a, 0x78, 0xae,
+    0xc8, 0x48, 0x62, 0x8a, 0x70, 0xa4, 0x14, 0xe1, 0x5d, 0x90, 0x90, 0x0e, 0x14, 0xe1, 0x4d, 0x14,
+    0xf1, 0x5d, 0x70, 0x90, 0x0a, 0x2a, 0xe6, 0x9d, 0x37, 0x95, 0x3e, 0xd3, 0xf7, 0x5f, 0x8f, 0xc7,
+    0xb5, 0x54, 0x14, 0xa2, 0xaa, 0xb5, 0x28, 0xe2, 0x29, 0x4a, 0x94, 0xb6, 0x66, 0x94, 0xea, 0x3a,
+    0x73, 0x52, 0x5d, 0x0e, 0x86, 0x8a, 0xab, 0x65, 0x71, 0xe7, 0x45, 0xb5, 0x8f, 0xce, 0xbc, 0x1e,
+    0x7a, 0x8f, 0x5a, 0xb5, 0x5f, 0x9f, 0x62, 0x28, 0x4e, 0x85, 0x47, 0x4e, 0x7b, 0xa3, 0xe8, 0xe9,
+    0xd4, 0x55, 0x22, 0xa5, 0x10, 0xa2, 0x8a, 0x2b, 0x12, 0xc2, 0x8a, 0x28, 0xa0, 0x02, 0x8a, 0x28,
+    0xa0, 0x02, 0x8a, 0x28, 0xa0, 0x02, 0x8a, 0x28, 0xa0, 0x02, 0x8a, 0x28, 0xa0, 0x02, 0x8a, 0x28,
+    0xa0, 0x02, 0x8a, 0x28, 0xa0, 0x06, 0xbb, 0x04, 0x42, 0xc7, 0xb5, 0x67, 0x12, 0x49, 0x24, 0xf5,
+    0x35, 0x3d, 0xc4, 0x9b, 0xdb, 0x68, 0x3f, 0x28, 0xfd, 0x6a, 0x1a, 0xfb, 0x0c, 0xa7, 0x08, 0xf0,
+    0xf4, 0x79, 0xe7, 0xf1, 0x4b, 0xf0, 0x5d, 0x0e, 0x3a, 0xb3, 0xe6, 0x95, 0x90, 0x94, 0x94, 0xea,
+    0x4a, 0xef, 0x9c, 0x89, 0x42, 0x52, 0x52, 0xd1, 0x5c, 0x75, 0x24, 0x68, 0x86, 0xd2, 0x53, 0xa9,
+    0x2b, 0x86, 0xa4, 0x8d, 0x10, 0xda, 0x4a, 0x75, 0x15, 0xc5, 0x52, 0x46, 0x88, 0x6d, 0x25, 0x3a,
+    0x8c, 0x57, 0x1c, 0xd9, 0xaa, 0x1b, 0x46, 0x29, 0xd8, 0xa3, 0x15, 0xcf, 0x26, 0x5a, 0x62, 0x62,
+    0x8c, 0x52, 0xe2, 0x97, 0x15, 0x9d, 0xcb, 0x4c, 0x40, 0x29, 0xc0, 0x50, 0x05, 0x28, 0x15, 0x48,
+    0xab, 0x80, 0x14, 0xe0, 0x28, 0x02, 0x9c, 0x05, 0x6d, 0x11, 0xdc, 0x00, 0xa7, 0x01, 0x40, 0x14,
+    0xe0, 0x2b, 0xa6, 0x03, 0xb8, 0x62, 0x8a, 0x76, 0x28, 0xae, 0x90, 0xb9, 0xc9, 0x62, 0x93, 0x14,
+    0xfc, 0x52, 0x62, 0xbd, 0x4a, 0x87, 0xe6, 0xc9, 0x8d, 0xc5, 0x26, 0x29, 0xd8, 0xa3, 0x15, 0xc5,
+    0x33, 0x44, 0xc6, 0xe2, 0x8c, 0x52, 0xe2, 0x8c, 0x57, 0x34, 0x8d, 0x13, 0x13, 0x14, 0x62, 0x97,
+    0x14, 0xb8, 0xac, 0x59, 0x69, 0x89, 0x4a, 0x29, 0x68, 0x14, 0x5c, 0xa4, 0xc5, 0x14, 0xa2, 0x81,
+    0x4a, 0x2a, 0xe2, 0xca, 0x14, 0x53, 0x85, 0x20, 0xa7, 0x0a, 0xe8, 0x84, 0x86, 0x28, 0xa7, 0x0a,
+    0x41, 0x4e, 0x15, 0xd5, 0x09, 0x00, 0xe1, 0x4e, 0x14, 0xd1, 0x4f, 0x15, 0xd9, 0x09, 0x0c, 0x51,
+    0x4e, 0x14, 0x82, 0x9c, 0x2b, 0xaa, 0x12, 0x01, 0x45, 0x38, 0x52, 0x0a, 0x70, 0xae, 0xa8, 0xc8,
+    0x63, 0xe2, 0x76, 0x8a, 0x40, 0xeb, 0xd4, 0x56, 0xbc, 0x13, 0x2c, 0xe9, 0xb9, 0x78, 0x3d, 0xc7,
+    0xa5, 0x63, 0x0a, 0x96, 0x29, 0x1a, 0x27, 0x0c, 0x87, 0x07, 0xf9, 0xd7, 0x0e, 0x63, 0x97, 0xc7,
+    0x19, 0x0b, 0xad, 0x26, 0xb6, 0x7f, 0xa3, 0x3a, 0xf0, 0xb8, 0x97, 0x45, 0xd9, 0xec, 0x6c, 0xd1,
+    0x51, 0x43, 0x3a, 0x4c, 0xb9, 0x53, 0x86, 0xee, 0xbd, 0xc5, 0x4b, 0x5f, 0x15, 0x52, 0x9c, 0xe9,
+    0x49, 0xc2, 0x6a, 0xcd, 0x1e, 0xec, 0x64, 0xa4, 0xaf, 0x17, 0xa0, 0x51, 0x45, 0x15, 0x99, 0x41,
+    0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01,
+    0x45, 0x14, 0x50, 0x01, 0x55, 0xe7, 0x9b, 0x00, 0xa2, 0xf5, 0xee, 0x68, 0x9a, 0x6c, 0x0d, 0xa8,
+    0x79, 0xee, 0x45, 0x57, 0xaf, 0xa2, 0xca, 0xf2, 0xbd, 0xab, 0x56, 0x5e, 0x8b, 0xf5, 0x67, 0x25,
+    0x6a, 0xff, 0x00, 0x66, 0x22, 0x51, 0x4b, 0x49, 0x5e, 0xfc, 0xa4, 0x73, 0xa1, 0x28, 0xa5, 0xa4,
+    0xae, 0x59, 0xc8, 0xb4, 0x25, 0x14, 0xb4, 0x95, 0xc7, 0x52, 0x46, 0xa8, 0x4a, 0x4a, 0x5a, 0x2b,
+    0x8a, 0xa4, 0x8d, 0x10, 0xda, 0x29, 0x69, 0x2b, 0x8e, 0x72, 0x34, 0x42, 0x51, 0x4b, 0x45, 0x72,
+    0xc9, 0x9a, 0x21, 0x31, 0x45, 0x2e, 0x28, 0xac, 0x1b, 0x2d, 0x06, 0x28, 0xc5, 0x2e, 0x29, 0x71,
+    0x52, 0x5a, 0x60, 0x05, 0x28, 0x14, 0x01, 0x4e, 0x02, 0xa9, 0x15, 0x70, 0x02, 0x9c, 0x05, 0x20,
+    0x14, 0xe0, 0x2b, 0x78, 0x0e, 0xe2, 0x81, 0x4e, 0x02, 0x90, 0x0a, 0x78, 0x15, 0xd7, 0x00, 0xb8,
+    0x62, 0x8a, 0x76, 0x28, 0xae, 0x8b, 0x05, 0xce, 0x4b, 0x14, 0x98, 0xa7, 0xe2, 0x93, 0x15, 0xea,
+    0xd4, 0x47, 0xe6, 0xc9, 0x8c, 0xc5, 0x18, 0xa7, 0x62, 0x8c, 0x57, 0x14, 0xd1, 0xaa, 0x63, 0x31,
+    0x46, 0x29, 0xd8, 0xa3, 0x15, 0xcb, 0x22, 0xd3, 0x1b, 0x8a, 0x31, 0x4e, 0xc5, 0x18, 0xac, 0x19,
+    0xa2, 0x62, 0x52, 0xd1, 0x8a, 0x5a, 0x8b, 0x94, 0x98, 0x0a, 0x51, 0x40, 0xa5, 0x15, 0x49, 0x94,
+    0x28, 0xa7, 0x0a, 0x41, 0x4e, 0x15, 0xb4, 0x64, 0x50, 0xa2, 0x9c, 0x29, 0x05, 0x38, 0x57, 0x4c,
+    0x24, 0x02, 0x8a, 0x70, 0xa4, 0x14, 0xe1, 0x5d, 0x50, 0x98, 0xc5, 0x14, 0xe1, 0x48, 0x29, 0xc2,
+    0xba, 0xa1, 0x30, 0x14, 0x53, 0x85, 0x20, 0xa7, 0x0a, 0xea, 0x8c, 0xc6, 0x28, 0xa7, 0x0a, 0x68,
+    0xa7, 0x0a, 0xde, 0x33, 0x18, 0xe4, 0x62, 0x8c, 0x19, 0x4e, 0x08, 0xef, 0x57, 0xa0, 0xbb, 0x0d,
+    0x85, 0x97, 0x83, 0xeb, 0xd8, 0xd5, 0x11, 0x4b, 0x58, 0x62, 0xb0, 0x74, 0x71, 0x71, 0xb5, 0x45,
+    0xaf, 0x7e, 0xa7, 0x45, 0x1c, 0x44, 0xe9, 0x3f, 0x74, 0xd7, 0x04, 0x11, 0x90, 0x72, 0x0d, 0x2d,
+    0x65, 0xc7, 0x2b, 0xc6, 0x7e, 0x56, 0xe3, 0xd3, 0xb5, 0x5a, 0x4b, 0xc5, 0x3c, 0x3a, 0x91, 0xee,
+    0x2b, 0xe6, 0x71, 0x39, 0x2d, 0x7a, 0x4e, 0xf4, 0xfd, 0xe5, 0xf8, 0xfd, 0xdf, 0xe4, 0x7a, 0xb4,
+    0xb1, 0xd4, 0xe7, 0xf1, 0x68, 0xcb, 0x54, 0x53, 0x16, 0x44, 0x7c, 0x6d, 0x60, 0x73, 0xdb, 0xbd,
+    0x3e, 0xbc, 0xa9, 0xc2, 0x50, 0x76, 0x92, 0xb3, 0x3b, 0x14, 0x94, 0x95, 0xd3, 0x0a, 0x28, 0xa2,
+    0xa0, 0x61, 0x45, 0x14, 0x87, 0x81, 0x93, 0x4c, 0x05, 0xa2, 0xa3, 0x69, 0xa3, 0x5f, 0xe2, 0xcf,
+    0xd2, 0xa2, 0x7b, 0x82, 0x78, 0x51, 0x8f, 0x7a, 0xee, 0xa1, 0x96, 0xe2, 0x6b, 0x6d, 0x1b, 0x2e,
+    0xef, 0x4f, 0xeb, 0xe4, 0x63, 0x3a, 0xf4, 0xe1, 0xbb, 0x27, 0x66, 0x54, 0x19, 0x63, 0x8a, 0xad,
+    0x24, 0xc5, 0xf8, 0x5e, 0x07, 0xf3, 0xa8, 0xc9, 0x24, 0xe4, 0x9c, 0x9a, 0x2b, 0xe8, 0x30, 0x99,
+    0x55, 0x1c, 0x3b, 0xe7, 0x9f, 0xbd, 0x2f, 0xc1, 0x7c, 0x8e, 0x3a, 0x98, 0x99, 0x4f, 0x45, 0xa2,
+    0x12, 0x8a, 0x5a, 0x2b, 0xd2, 0x94, 0xcc, 0x50, 0x94, 0x52, 0xd2, 0x57, 0x34, 0xe6, 0x68, 0x84,
+    0xa2, 0x96, 0x92, 0xb9, 0x67, 0x33, 0x44, 0x25, 0x14, 0xb4, 0x95, 0xc7, 0x39, 0x9a, 0x21, 0x29,
+    0x29, 0xd4, 0x95, 0xc7, 0x39, 0x1a, 0x21, 0x29, 0x29, 0xd4, 0x95, 0xcb, 0x39, 0x1a, 0x21, 0x28,
+    0xa5, 0xa2, 0xb9, 0xa4, 0xcd, 0x10, 0x98, 0xa5, 0xa5, 0xa2, 0xb3, 0x6c, 0xb4, 0xc4, 0xc5, 0x2e,
+    0x29, 0x71, 0x4a, 0x05, 0x24, 0x52, 0x60, 0x05, 0x28, 0x14, 0xa0, 0x52, 0x81, 0x5a, 0x44, 0x77,
+    0x00, 0x29, 0xc0, 0x50, 0x05, 0x38, 0x0a, 0xe8, 0x82, 0x1d, 0xc0, 0x0a, 0x78, 0x14, 0x80, 0x53,
+    0xc0, 0xae, 0xb8, 0x21, 0xdc, 0x31, 0x45, 0x3b, 0x14, 0x57, 0x45, 0x82, 0xe7, 0x25, 0x8a, 0x4c,
+    0x53, 0xf1, 0x49, 0x8a, 0xf5, 0xaa, 0x23, 0xf3, 0x64, 0xc6, 0x62, 0x93, 0x14, 0xfc, 0x51, 0x8a,
+    0xe2, 0xa8, 0x8d, 0x13, 0x19, 0x8a, 0x31, 0x4e, 0xc5, 0x18, 0xae, 0x49, 0xa3, 0x44, 0xc6, 0x62,
+    0x97, 0x14, 0xb8, 0xa3, 0x15, 0xcd, 0x23, 0x44, 0xc4, 0xc5, 0x2e, 0x29, 0x71, 0x46, 0x2b, 0x36,
+    0x52, 0x62, 0x53, 0x85, 0x18, 0xa5, 0x02, 0x84, 0xcb, 0x4c, 0x05, 0x38, 0x52, 0x0a, 0x70, 0xab,
+    0x52, 0x18, 0x0a, 0x70, 0xa4, 0x14, 0xe1, 0x5b, 0xc6, 0x43, 0x14, 0x53, 0x85, 0x20, 0xa7, 0x0a,
+    0xe8, 0x84, 0xc6, 0x28, 0xa7, 0x0a, 0x68, 0xa7, 0x0a, 0xea, 0x84, 0xc6, 0x38, 0x53, 0x85, 0x34,
+    0x53, 0x85, 0x74, 0x46, 0x63, 0x1c, 0x29, 0x45, 0x20, 0xa7, 0x0a, 0xe8, 0x8c, 0xc6, 0x28, 0xa5,
+    0x14, 0x82, 0x9c, 0x2b, 0x65, 0x31, 0x8b, 0x4b, 0x48, 0x29, 0x6a, 0xd4, 0xca, 0x42, 0xd3, 0xc3,
+    0xb8, 0x18, 0x0c, 0xc0, 0x7b, 0x1a, 0x65, 0x2d, 0x12, 0x71, 0x92, 0xb4, 0x95, 0xca, 0x8b, 0x6b,
+    0x62, 0x51, 0x3c, 0xb8, 0xc6, 0xef, 0xd2, 0x97, 0xcf, 0x97, 0xfb, 0xdf, 0xa0, 0xa8, 0xa9, 0x6b,
+    0x17, 0x86, 0xc3, 0x7f, 0xcf, 0xb8, 0xfd, 0xc8, 0xd9, 0x56, 0xa9, 0xfc, 0xcf, 0xef, 0x1e, 0x65,
+    0x91, 0xba, 0xb9, 0xfc, 0x38, 0xa4, 0x24, 0xb1, 0xc9, 0x24, 0xfd, 0x69, 0x28, 0xab, 0x84, 0x29,
+    0xd3, 0xf8, 0x22, 0x97, 0xa2, 0x07, 0x39, 0x4b, 0x76, 0x14, 0xb4, 0x51, 0x4d, 0xcc, 0x68, 0x28,
+    0xa2, 0x8a, 0xce, 0x53, 0x2d, 0x05, 0x14, 0x51, 0x58, 0x4a, 0x65, 0xa0, 0xa2, 0x8a, 0x2b, 0x9a,
+    0x73, 0x34, 0x42, 0x51, 0x45, 0x15, 0xcb, 0x39, 0x96, 0x84, 0xa2, 0x96, 0x92, 0xb9, 0x27, 0x33,
+    0x44, 0x25, 0x14, 0xb4, 0x95, 0xcb, 0x39, 0x1a, 0x21, 0x28, 0xa5, 0xa2, 0xb9, 0xa5, 0x23, 0x44,
+    0x25, 0x2d, 0x18, 0xa5, 0xc5, 0x62, 0xd9, 0x68, 0x4c, 0x52, 0xe2, 0x8c, 0x52, 0xe2, 0xa4, 0xb4,
+    0xc3, 0x14, 0xa0, 0x51, 0x8a, 0x70, 0x14, 0xd1, 0x57, 0x10, 0x0a, 0x70, 0x14, 0x01, 0x4e, 0x02,
+    0xb6, 0x8a, 0x1d, 0xc0, 0x0a, 0x70, 0x14, 0x01, 0x4e, 0x02, 0xba, 0x60, 0x87, 0x70, 0x02, 0x9e,
+    0x05, 0x20, 0x14, 0xf0, 0x2b, 0xae, 0x08, 0x2e, 0x18, 0xa2, 0x9d, 0x8a, 0x2b, 0xa2, 0xc1, 0x73,
+    0x92, 0xc5, 0x26, 0x29, 0xf8, 0xa3, 0x15, 0xeb, 0xd4, 0x47, 0xe6, 0xc9, 0x8c, 0xc5, 0x26, 0x29,
+    0xf8, 0xa4, 0xc5, 0x71, 0x54, 0x46, 0x89, 0x8c, 0xc5, 0x18, 0xa7, 0x62, 0x8c, 0x57, 0x1c, 0xd1,
+    0xa2, 0x63, 0x31, 0x46, 0x29, 0xd8, 0xa3, 0x15, 0xcb, 0x24, 0x68, 0x98, 0xdc, 0x52, 0xe2, 0x97,
+    0x14, 0x62, 0xb1, 0x65, 0xa6, 0x26, 0x29, 0x71, 0x4b, 0x8a, 0x5c, 0x54, 0x16, 0x98, 0x82, 0x9c,
+    0x28, 0x02, 0x96, 0xa9, 0x32, 0x90, 0x0a, 0x70, 0xa4, 0x14, 0xa2, 0xb4, 0x8c, 0x86, 0x28, 0xa7,
+    0x0a, 0x41, 0x4e, 0x15, 0xb4, 0x66, 0x31, 0x45, 0x38, 0x53, 0x45, 0x38, 0x56, 0xf1, 0x99, 0x43,
+    0x85, 0x28, 0xa4, 0x14, 0xe1, 0x5d, 0x11, 0xa8, 0x02, 0x8a, 0x70, 0xa6, 0x8a, 0x70, 0xad, 0xe3,
+    0x50, 0x62, 0x8a, 0x70, 0xa6, 0x8a, 0x70, 0xad, 0x95, 0x42, 0x85, 0x14, 0xa2, 0x90, 0x52, 0x8a,
+    0xd1, 0x54, 0x18, 0xb4, 0xb4, 0x94, 0xb5, 0x5e, 0xd0, 0xa4, 0x2d, 0x2d, 0x25, 0x2d, 0x1e, 0xd0,
+    0xa4, 0x2d, 0x14, 0x51, 0x49, 0xd4, 0x2d, 0x0b, 0x45, 0x14, 0x54, 0x3a, 0x85, 0xa0, 0xa5, 0xa4,
+    0xa2, 0xb2, 0x95, 0x42, 0x90, 0xb4, 0x94, 0x51, 0x58, 0x4a, 0xa1, 0xa2, 0x0a, 0x28, 0xa2, 0xb9,
+    0xe5, 0x50, 0xb4, 0x14, 0x94, 0xb4, 0x57, 0x34, 0xe6, 0x68, 0x84, 0xa2, 0x8a, 0x2b, 0x96, 0x73,
+    0x34, 0x42, 0x51, 0x4b, 0x45, 0x73, 0xca, 0x45, 0xa1, 0x28, 0xa5, 0xa2, 0xb1, 0x6c, 0xd1, 0x05,
+    0x18, 0xa5, 0xa5, 0xc5, 0x66, 0xd9, 0x48, 0x4c, 0x52, 0xe2, 0x97, 0x14, 0xa0, 0x50, 0x5a, 0x62,
+    0x01, 0x4e, 0x02, 0x80, 0x29, 0xc0, 0x55, 0xc5, 0x0e, 0xe2, 0x01, 0x4e, 0x02, 0x80, 0x29, 0xc0,
+    0x56, 0xf1, 0x43, 0xb8, 0x01, 0x4e, 0x02, 0x80, 0x29, 0xe0, 0x57, 0x54, 0x10, 0xee, 0x00, 0x53,
+    0x80, 0xa0, 0x0a, 0x70, 0x15, 0xd9, 0x04, 0x17, 0x0c, 0x51, 0x4e, 0xc5, 0x15, 0xd1, 0x60, 0xb9,
+    0xc9, 0x62, 0x8c, 0x53, 0xf1, 0x49, 0x8a, 0xf6, 0x2a, 0x23, 0xf3, 0x64, 0xc6, 0x62, 0x93, 0x14,
+    0xfc, 0x52, 0x62, 0xb8, 0xaa, 0x23, 0x44, 0xc6, 0x62, 0x8c, 0x53, 0xf1, 0x49, 0x8a, 0xe2, 0x9a,
+    0x34, 0x4c, 0x6e, 0x29, 0x31, 0x4f, 0xc5, 0x26, 0x2b, 0x96, 0x68, 0xd1, 0x31, 0xb8, 0xa3, 0x14,
+    0xec, 0x51, 0x8a, 0xe7, 0x92, 0x34, 0x4c, 0x4c, 0x51, 0x8a, 0x5c, 0x52, 0xe2, 0xb2, 0x65, 0xa6,
+    0x26, 0x29, 0x68, 0xc5, 0x2e, 0x2a, 0x6e, 0x52, 0x0a, 0x51, 0x45, 0x2d, 0x52, 0x65, 0x0a, 0x29,
+    0x45, 0x20, 0xa7, 0x0a, 0xd1, 0x48, 0xa1, 0x45, 0x28, 0xa4, 0x14, 0xe1, 0x5a, 0xc6, 0x63, 0x14,
+    0x53, 0x85, 0x34, 0x53, 0x85, 0x6d, 0x19, 0x8c, 0x51, 0x4e, 0x14, 0xd1, 0x4e, 0x15, 0xb4, 0x6a,
+    0x0c, 0x51, 0x4e, 0x14, 0xd1, 0x4e, 0xad, 0x55, 0x42, 0x85, 0x14, 0xb4, 0x94, 0xb5, 0x6a, 0xa1,
+    0x42, 0xd2, 0xd2, 0x52, 0xd5, 0x7b, 0x41, 0xa1, 0x69, 0x69, 0x29, 0x69, 0xfb, 0x42, 0xd0, 0xb4,
+    0x52, 0x52, 0xd4, 0xba, 0x85, 0x21, 0x68, 0xa4, 0xa5, 0xa8, 0x75, 0x0b, 0x41, 0x45, 0x14, 0x56,
+    0x52, 0xa8, 0x5a, 0x0a, 0x28, 0xa2, 0xb1, 0x95, 0x42, 0xd0, 0x51, 0x45, 0x15, 0x84, 0xaa, 0x16,
+    0x82, 0x8a, 0x28, 0xac, 0x25, 0x33, 0x44, 0x14, 0x51, 0x45, 0x73, 0xca, 0x45, 0xa0, 0xa2, 0x96,
+    0x8a, 0xc5, 0xc8, 0xb4, 0x25, 0x2e, 0x28, 0xa5, 0xc5, 0x43, 0x65, 0xa1, 0x31, 0x4b, 0x8a, 0x5c,
+    0x52, 0xe2, 0xa4, 0xa4, 0xc4, 0x02, 0x94, 0x0a, 0x50, 0x29, 0x40, 0xab, 0x48, 0xab, 0x80, 0x14,
+    0xe0, 0x28, 0x02, 0x9c, 0x05, 0x6b, 0x14, 0x55, 0xc4, 0x02, 0x9e, 0x05, 0x00, 0x53, 0x80, 0xae,
+    0x88, 0x20, 0xb8, 0x01, 0x4e, 0x02, 0x80, 0x29, 0xc0, 0x57, 0x5c, 0x22, 0x3b, 0x80, 0x14, 0xe0,
+    0x28, 0x02, 0x9c, 0x05, 0x75, 0xc1, 0x05, 0xc3, 0x14, 0x53, 0xb1, 0x45, 0x74, 0x58, 0x77, 0x39,
+    0x3c, 0x52, 0x62, 0x9f, 0x8a, 0x4c, 0x57, 0xb1, 0x34, 0x7e, 0x6a, 0x98, 0xdc, 0x52, 0x62, 0x9f,
+    0x8a, 0x4c, 0x57, 0x1d, 0x48, 0x9a, 0x26, 0x33, 0x14, 0x98, 0xa7, 0xe2, 0x8c, 0x57, 0x1c, 0xe2,
+    0x68, 0x98, 0xcc, 0x51, 0x8a, 0x76, 0x28, 0xc5, 0x72, 0x4e, 0x26, 0x89, 0x8c, 0xc5, 0x18, 0xa7,
+    0x62, 0x8c, 0x57, 0x2c, 0x91, 0xa2, 0x63, 0x71, 0x46, 0x29, 0xd8, 0xa3, 0x15, 0x84, 0x91, 0x69,
+    0x89, 0x8a, 0x31, 0x4e, 0xc5, 0x18, 0xac, 0xd9, 0x69, 0x89, 0x8a, 0x5a, 0x5c, 0x51, 0x8a, 0x57,
+    0x2d, 0x30, 0xa5, 0xa2, 0x96, 0x9a, 0x65, 0x21, 0x45, 0x28, 0xa4, 0x14, 0xe1, 0x56, 0xa4, 0x34,
+    0x28, 0xa5, 0x14, 0x82, 0x94, 0x56, 0x8a, 0x65, 0x0a, 0x29, 0xc2, 0x90, 0x52, 0x8a, 0xd1, 0x4c,
+    0x62, 0x8a, 0x51, 0x48, 0x29, 0x6b, 0x45, 0x50, 0xa1, 0xd4, 0xa2, 0x92, 0x96, 0xad, 0x54, 0x29,
+    0x0b, 0x4b, 0x49, 0x4b, 0x4f, 0xda, 0x14, 0x85, 0xa2, 0x92, 0x96, 0x8f, 0x68, 0x52, 0x16, 0x96,
+    0x92, 0x96, 0x93, 0xa8, 0x52, 0x0a, 0x5a, 0x4a, 0x2a, 0x1d, 0x42, 0xd0, 0xb4, 0x51, 0x45, 0x66,
+    0xea, 0x16, 0x82, 0x8a, 0x29, 0x6b, 0x29, 0x54, 0x2d, 0x05, 0x14, 0x51, 0x59, 0x4a, 0x65, 0xa0,
+    0xa2, 0x8a, 0x2b, 0x19, 0x48, 0xb4, 0x14, 0x52, 0xd1, 0x59, 0x39, 0x16, 0x82, 0x8a, 0x5a, 0x31,
+    0x50, 0xd9, 0x68, 0x31, 0x4b, 0x8a, 0x31, 0x4b, 0x8a, 0x45, 0x26, 0x18, 0xa5, 0x02, 0x80, 0x29,
+    0xc0, 0x53, 0x48, 0xab, 0x88, 0x05, 0x28, 0x14, 0xa0, 0x53, 0x80, 0xad, 0x22, 0x8a, 0xb8, 0x80,
+    0x53, 0x80, 0xa0, 0x0a, 0x70, 0x15, 0xd1, 0x18, 0x8e, 0xe0, 0x05, 0x38, 0x0a, 0x00, 0xa7, 0x01,
+    0x5d, 0x30, 0x88, 0x5c, 0x00, 0xa7, 0x01, 0x4a, 0x05, 0x38, 0x0a, 0xeb, 0x84, 0x47, 0x70, 0x02,
+    0x9c, 0x05, 0x00, 0x53, 0x80, 0xae, 0xa8, 0x20, 0xb8, 0x62, 0x8a, 0x76, 0x28, 0xad, 0xec, 0x3b,
+    0x9c, 0x96, 0x28, 0xc5, 0x3f, 0x14, 0x98, 0xaf, 0x66, 0x68, 0xfc, 0xd5, 0x31, 0x98, 0xa3, 0x14,
+    0xfc, 0x52, 0x62, 0xb9, 0x27, 0x13, 0x44, 0xc6, 0x62, 0x93, 0x14, 0xfc, 0x51, 0x8a, 0xe3, 0x9c,
+    0x4d, 0x13, 0x19, 0x8a, 0x4c, 0x53, 0xf1, 0x46, 0x2b, 0x92, 0x71, 0x34, 0x4c, 0x66, 0x28, 0xc5,
+    0x3b, 0x14, 0x62, 0xb9, 0x27, 0x13, 0x44, 0xc6, 0x62, 0x8c, 0x53, 0xf1, 0x46, 0x2b, 0x9e, 0x48,
+    0xb4, 0xc6, 0xe2, 0x8c, 0x53, 0xb1, 0x46, 0x2b, 0x16, 0x8d, 0x13, 0x1b, 0x8a, 0x5c, 0x52, 0xe2,
+    0x97, 0x15, 0x9b, 0x29, 0x31, 0x31, 0x4b, 0x46, 0x29, 0x71, 0x4a, 0xe5, 0xa6, 0x14, 0xb4, 0x52,
+    0xd1, 0x72, 0x90, 0x52, 0xd1, 0x4b, 0x4d, 0x48, 0xa4, 0x02, 0x94, 0x51, 0x4b, 0x56, 0xa6, 0x52,
+    0x0a, 0x75, 0x25, 0x2d, 0x52, 0x99, 0x48, 0x5a, 0x5a, 0x4a, 0x5a, 0xae, 0x72, 0x90, 0xb4, 0xb4,
+    0x94, 0xb4, 0xfd, 0xa1, 0x48, 0x5a, 0x28, 0xa2, 0x97, 0xb4, 0x29, 0x0b, 0x4b, 0x49, 0x4b, 0x4b,
+    0xda, 0x14, 0x82, 0x96, 0x92, 0x96, 0xa5, 0xcc, 0xb4, 0x14, 0x51, 0x4b, 0x50, 0xe6, 0x5a, 0x0a,
+    0x28, 0xa5, 0xac, 0xdc, 0xca, 0x42, 0x52, 0xd1, 0x4b, 0x59, 0xb9, 0x16, 0x84, 0xa5, 0xa2, 0x96,
+    0xa1, 0xc8, 0xb4, 0x25, 0x2d, 0x14, 0xb8, 0xa9, 0xb9, 0x69, 0x89, 0x8a, 0x5c, 0x52, 0xe2, 0x97,
+    0x14, 0x8a, 0x4c, 0x4c, 0x52, 0xe2, 0x94, 0x0a, 0x50, 0x29, 0xa4, 0x52, 0x62, 0x62, 0x9c, 0x05,
+    0x28, 0x14, 0xa0, 0x56, 0x89, 0x0e, 0xe2, 0x01, 0x4e, 0x02, 0x94, 0x0a, 0x50, 0x2b, 0x68, 0xc4,
+    0xab, 0x80, 0x14, 0xe0, 0x28, 0x02, 0x9c, 0x05, 0x74, 0xc2, 0x21, 0x70, 0x02, 0x9c, 0x05, 0x00,
+    0x53, 0xc0, 0xae, 0x98, 0x44, 0x77, 0x10, 0x0a, 0x70, 0x14, 0xa0, 0x53, 0x80, 0xae, 0xb8, 0x44,
+    0x77, 0x10, 0x0a, 0x70, 0x14, 0xa0, 0x53, 0x80, 0xae, 0x98, 0x20, 0xb8, 0x98, 0xa2, 0x9d, 0x8a,
+    0x2b, 0x6b, 0x0e, 0xe7, 0x25, 0x8a, 0x31, 0x4f, 0xc5, 0x26, 0x2b, 0xd9, 0x92, 0x3f, 0x35, 0x4c,
+    0x6e, 0x29, 0x31, 0x4f, 0xc5, 0x18, 0xae, 0x69, 0xc4, 0xd1, 0x31, 0x98, 0xa4, 0xc5, 0x3f, 0x14,
+    0x62, 0xb9, 0x27, 0x13, 0x44, 0xc6, 0x62, 0x93, 0x14, 0xfc, 0x51, 0x8a, 0xe4, 0x9c, 0x4d, 0x13,
+    0x19, 0x8a, 0x4c, 0x53, 0xf1, 0x46, 0x2b, 0x92, 0x71, 0x34, 0x4c, 0x66, 0x28, 0xc5, 0x3f, 0x14,
+    0x98, 0xae, 0x69, 0x44, 0xb4, 0xc6, 0xe2, 0x8c, 0x53, 0xb1, 0x46, 0x2b, 0x9e, 0x51, 0x34, 0x4c,
+    0x6e, 0x28, 0xc5, 0x3b, 0x14, 0xb8, 0xac, 0x5a, 0x2d, 0x31, 0xb8, 0xa3, 0x14, 0xec, 0x51, 0x8a,
+    0xcd, 0x96, 0x98, 0x98, 0xa5, 0xc5, 0x2e, 0x28, 0xc5, 0x49, 0x49, 0x85, 0x2d, 0x18, 0xa5, 0xa2,
+    0xe5, 0xa0, 0xa5, 0xa2, 0x8a, 0x2e, 0x52, 0x0a, 0x75, 0x25, 0x2d, 0x1c, 0xc5, 0x20, 0xa5, 0xa2,
+    0x96, 0x9f, 0x31, 0x48, 0x29, 0x68, 0xa5, 0xa3, 0x98, 0xa4, 0x14, 0xb4, 0x94, 0xb4, 0x73, 0x14,
+    0x82, 0x96, 0x8a, 0x5a, 0x5c, 0xc5, 0xa0, 0xa2, 0x8a, 0x5a, 0x97, 0x22, 0x90, 0x51, 0x4b, 0x45,
+    0x4b, 0x91, 0x68, 0x28, 0xa5, 0xa5, 0xa9, 0x6c, 0xa4, 0x25, 0x2d, 0x14, 0xb8, 0xa9, 0xb9, 0x68,
+    0x4a, 0x5c, 0x52, 0xe2, 0x97, 0x14, 0x8a, 0x4c, 0x4c, 0x52, 0xe2, 0x8c, 0x52, 0xe2, 0x82, 0xd3,
+    0x0c, 0x52, 0xe2, 0x94, 0x0a, 0x50, 0x29, 0xa4, 0x34, 0xc4, 0x02, 0x94, 0x0a, 0x50, 0x29, 0xc0,
+    0x56, 0x89, 0x15, 0x71, 0x00, 0xa5, 0x02, 0x94, 0x0a, 0x70, 0x15, 0xb4, 0x62, 0x3b, 0x88, 0x05,
+    0x38, 0x0a, 0x50, 0x29, 0x40, 0xad, 0xe3, 0x11, 0xdc, 0x00, 0xa7, 0x01, 0x40, 0x14, 0xe0, 0x2b,
+    0xa6, 0x11, 0x1d, 0xc0, 0x0a, 0x70, 0x14, 0x01, 0x4e, 0x02, 0xba, 0x61, 0x11, 0xdc, 0x00, 0xa7,
+    0x01, 0x40, 0x14, 0xe0, 0x2b, 0xaa, 0x11, 0x0b, 0x80, 0x14, 0xe0, 0x28, 0x02, 0x9c, 0x05, 0x74,
+    0x45, 0x0e, 0xe2, 0x62, 0x8a, 0x76, 0x28, 0xad, 0x6c, 0x3b, 0x9c, 0x96, 0x29, 0x71, 0x4b, 0x8a,
+    0x5c, 0x57, 0xb1, 0x24, 0x7e, 0x6a, 0x98, 0xcc, 0x51, 0x8a, 0x7e, 0x28, 0xc5, 0x61, 0x24, 0x68,
+    0x98, 0xcc, 0x52, 0x62, 0x9f, 0x8a, 0x31, 0x5c, 0xd3, 0x89, 0x69, 0x8c, 0xc5, 0x18, 0xa7, 0xe2,
+    0x93, 0x15, 0xcb, 0x38, 0x9a, 0x26, 0x33, 0x14, 0x62, 0x9f, 0x8a, 0x4c, 0x57, 0x24, 0xe2, 0x68,
+    0x98, 0xcc, 0x51, 0x8a, 0x7e, 0x28, 0xc5, 0x73, 0x4e, 0x26, 0x89, 0x8c, 0xc5, 0x18, 0xa7, 0xe2,
+    0x93, 0x15, 0xcd, 0x28, 0x9a, 0x26, 0x37, 0x14, 0x62, 0x9d, 0x8a, 0x31, 0x5c, 0xf2, 0x89, 0x69,
+    0x8d, 0xc5, 0x18, 0xa7, 0x62, 0x97, 0x15, 0x93, 0x45, 0xa6, 0x37, 0x14, 0x62, 0x9d, 0x8a, 0x31,
+    0x59, 0xb4, 0x5a, 0x62, 0x62, 0x8c, 0x53, 0xb1, 0x46, 0x2a, 0x19, 0x69, 0x89, 0x8a, 0x5c, 0x52,
+    0xe2, 0x8c, 0x54, 0x94, 0x98, 0x51, 0x4b, 0x8a, 0x5c, 0x52, 0x29, 0x31, 0x29, 0x69, 0x71, 0x46,
+    0x28, 0xb9, 0x69, 0x85, 0x2d, 0x14, 0xb8, 0xa5, 0x72, 0x90, 0x94, 0xb4, 0xb8, 0xa3, 0x14, 0xae,
+    0x52, 0x0a, 0x5a, 0x31, 0x4b, 0x45, 0xcb, 0x42, 0x52, 0xd2, 0xe2, 0x8c, 0x52, 0xb9, 0x48, 0x28,
+    0xa5, 0xc5, 0x2e, 0x29, 0x5c, 0xa4, 0xc4, 0xc5, 0x2e, 0x29, 0x71, 0x46, 0x29, 0x16, 0x98, 0x62,
+    0x8c, 0x52, 0xe2, 0x97, 0x14, 0x14, 0x98, 0x98, 0xa5, 0xc5, 0x2e, 0x29, 0x71, 0x4e, 0xc5, 0x26,
+    0x26, 0x29, 0x71, 0x4b, 0x8a, 0x70, 0x15, 0x49, 0x14, 0x98, 0x80, 0x52, 0x81, 0x4a, 0x05, 0x28,
+    0x15, 0x6a, 0x25, 0x5c, 0x40, 0x29, 0xc0, 0x52, 0x81, 0x4e, 0x02, 0xb5, 0x8c, 0x47, 0x71, 0x00,
+    0xa5, 0x02, 0x94, 0x0a, 0x70, 0x15, 0xbc, 0x62, 0x3b, 0x88, 0x05, 0x38, 0x0a, 0x50, 0x29, 0xc0,
+    0x57, 0x44, 0x62, 0x3b, 0x88, 0x05, 0x38, 0x0a, 0x50, 0x29, 0xc0, 0x57, 0x4c, 0x22, 0x3b, 0x88,
+    0x05, 0x38, 0x0a, 0x50, 0x29, 0x40, 0xae, 0x98, 0xc4, 0x2e, 0x00, 0x53, 0x80, 0xa0, 0x0a, 0x70,
+    0x15, 0xd1, 0x14, 0x3b, 0x88, 0x05, 0x38, 0x0a, 0x00, 0xa7, 0x01, 0x5b, 0x24, 0x3b, 0x89, 0x8a,
+    0x29, 0xd8, 0xa2, 0xac, 0xab, 0x9c, 0x96, 0x29, 0x71, 0x4b, 0x8a, 0x31, 0x5e, 0xbb, 0x3f, 0x35,
+    0x4c, 0x4c, 0x51, 0x8a, 0x76, 0x28, 0xc5, 0x67, 0x24, 0x5a, 0x63, 0x71, 0x46, 0x29, 0xd8, 0xa3,
+    0x15, 0x84, 0xa2, 0x5a, 0x63, 0x31, 0x46, 0x29, 0xf8, 0xa3, 0x15, 0xcd, 0x38, 0x9a, 0x26, 0x33,
+    0x14, 0x98, 0xa7, 0xe2, 0x8c, 0x57, 0x34, 0xe2, 0x5a, 0x63, 0x31, 0x49, 0x8a, 0x93, 0x14, 0x98,
+    0xae, 0x69, 0xc0, 0xd1, 0x31, 0x98, 0xa3, 0x14, 0xfc, 0x51, 0x8a, 0xe5, 0x9c, 0x0d, 0x13, 0x19,
+    0x8a, 0x31, 0x4f, 0xc5, 0x18, 0xae, 0x79, 0x40, 0xb4, 0xc6, 0x62, 0x8c, 0x53, 0xf1, 0x46, 0x2b,
+    0x19, 0x44, 0xd1, 0x31, 0x98, 0xa5, 0xc5, 0x3b, 0x14, 0x62, 0xb1, 0x71, 0x2d, 0x31, 0xb8, 0xa3,
+    0x14, 0xec, 0x52, 0xe2, 0xb3, 0x71, 0x2d, 0x31, 0xb8, 0xa3, 0x14, 0xec, 0x52, 0xe2, 0xb3, 0x68,
+    0xa4, 0xc6, 0xe2, 0x97, 0x14, 0xb8, 0xa5, 0xc5, 0x4b, 0x45, 0xa6, 0x37, 0x14, 0xb8, 0xa5, 0xc5,
+    0x2e, 0x2a, 0x6c, 0x52, 0x62, 0x62, 0x8c, 0x53, 0xb1, 0x46, 0x29, 0x16, 0x98, 0x98, 0xa5, 0xc5,
+    0x2e, 0x29, 0x71, 0x48, 0xa4, 0xc4, 0xc5, 0x18, 0xa7, 0x62, 0x8c, 0x50, 0x5a, 0x62, 0x62, 0x97,
+    0x14, 0xb8, 0xa5, 0xc5, 0x2b, 0x14, 0x98, 0x98, 0xa5, 0xc5, 0x2e, 0x29, 0x71, 0x45, 0x8a, 0x4c,
+    0x4c, 0x51, 0x8a, 0x76, 0x29, 0x71, 0x45, 0x8a, 0x4c, 0x6e, 0x29, 0x71, 0x4e, 0xc5, 0x28, 0x15,
+    0x4a, 0x25, 0x26, 0x20, 0x14, 0xa0, 0x52, 0x81, 0x4a, 0x05, 0x52, 0x89, 0x49, 0x88, 0x05, 0x28,
+    0x14, 0xe0, 0x29, 0x40, 0xad, 0x14, 0x4a, 0xb8, 0x80, 0x52, 0x81, 0x4a, 0x05, 0x38, 0x0a, 0xd6,
+    0x30, 0x1d, 0xc4, 0x02, 0x94, 0x0a, 0x70, 0x14, 0xa0, 0x56, 0xd1, 0x80, 0xee, 0x20, 0x14, 0xe0,
+    0x29, 0x40, 0xa7, 0x01, 0x5b, 0xc6, 0x03, 0xb8, 0x80, 0x53, 0x80, 0xa5, 0x02, 0x94, 0x0a, 0xe8,
+    0x8c, 0x07, 0x70, 0x02, 0x94, 0x0a, 0x50, 0x29, 0xc0, 0x57, 0x44, 0x62, 0x3b, 0x88, 0x05, 0x38,
+    0x0a, 0x50, 0x29, 0x40, 0xad, 0xe3, 0x11, 0xdc, 0x00, 0xa5, 0x02, 0x94, 0x0a, 0x50, 0x2b, 0x64,
+    0x87, 0x71, 0x00, 0xa7, 0x62, 0x8c, 0x52, 0xe2, 0xb4, 0x45, 0x5c, 0x31, 0x45, 0x2e, 0x28, 0xa6,
+    0x3b, 0x9c, 0x96, 0x29, 0x71, 0x4b, 0x8a, 0x5c, 0x57, 0xae, 0x7e, 0x6c, 0x98, 0x98, 0xa3, 0x14,
+    0xb8, 0xa5, 0xc5, 0x4b, 0x29, 0x31, 0xb8, 0xa3, 0x14, 0xec, 0x51, 0x8a, 0xca, 0x48, 0xb4, 0xc6,
+    0xe2, 0x8c, 0x53, 0xf1, 0x46, 0x2b, 0x19, 0x44, 0xb4, 0xc6, 0x62, 0x8c, 0x53, 0xf1, 0x49, 0x8a,
+    0xe7, 0x94, 0x4d, 0x13, 0x19, 0x8a, 0x31, 0x4f, 0xc5, 0x18, 0xae, 0x79, 0x40, 0xb4, 0xc6, 0x62,
+    0x8c, 0x53, 0xf1, 0x46, 0x2b, 0x9a, 0x50, 0x34, 0x4c, 0x66, 0x29, 0x31, 0x4f, 0xc5, 0x18, 0xae,
+    0x79, 0x40, 0xd1, 0x31, 0x98, 0xa3, 0x14, 0xfc, 0x51, 0x8a, 0xc2, 0x50, 0x2d, 0x31, 0xb8, 0xa3,
+    0x14, 0xec, 0x52, 0xe2, 0xb0, 0x94, 0x0b, 0x4c, 0x66, 0x28, 0xc5, 0x3f, 0x14, 0x62, 0xb2, 0x70,
+    0x2d, 0x31, 0xb8, 0xa3, 0x14, 0xec, 0x52, 0xe2, 0xb3, 0x71, 0x2d, 0x31, 0x98, 0xa5, 0xc5, 0x3b,
+    0x14, 0xb8, 0xa8, 0x71, 0x2d, 0x31, 0xb8, 0xa3, 0x14, 0xec, 0x52, 0xe2, 0xa1, 0xc4, 0xb4, 0xc6,
+    0xe2, 0x8c, 0x53, 0xb1, 0x4b, 0x8a, 0x9e, 0x52, 0x93, 0x1b, 0x8a, 0x5c, 0x53, 0xb1, 0x46, 0x29,
+    0x72, 0x94, 0x98, 0x98, 0xa3, 0x14, 0xec, 0x52, 0xe2, 0x8e, 0x52, 0xd3, 0x1b, 0x8a, 0x5c, 0x53,
+    0xb1, 0x4b, 0x8a, 0x39, 0x4a, 0x4c, 0x6e, 0x29, 0x71, 0x4e, 0xc5, 0x2e, 0x28, 0xe5, 0x29, 0x31,
+    0xb8, 0xa5, 0xc5, 0x3b, 0x14, 0xb8, 0xaa, 0xe5, 0x29, 0x31, 0xb8, 0xa5, 0xc5, 0x3b, 0x14, 0xb8,
+    0xaa, 0x50, 0x2a, 0xe2, 0x01, 0x4a, 0x05, 0x28, 0x14, 0xe0, 0x2b, 0x45, 0x01, 0xdc, 0x68, 0x14,
+    0xe0, 0x29, 0x40, 0xa7, 0x01, 0x5a, 0x28, 0x15, 0x71, 0xa0, 0x53, 0x80, 0xa5, 0x02, 0x9c, 0x05,
+    0x6b, 0x18, 0x0e, 0xe3, 0x40, 0xa7, 0x01, 0x4a, 0x05, 0x38, 0x0a, 0xde, 0x30, 0x1d, 0xc4, 0x02,
+    0x9c, 0x05, 0x28, 0x14, 0xa0, 0x56, 0xf1, 0x81, 0x57, 0x10, 0x0a, 0x70, 0x14, 0xa0, 0x53, 0x80,
+    0xad, 0xe3, 0x11, 0xdc, 0x40, 0x29, 0x40, 0xa5, 0x02, 0x9c, 0x05, 0x6d, 0x18, 0x8e, 0xe2, 0x01,
+    0x4e, 0x02, 0x80, 0x29, 0xc0, 0x56, 0xa9, 0x0e, 0xe2, 0x01, 0x4b, 0x8a, 0x5c, 0x52, 0xe2, 0xb4,
+    0x45, 0x26, 0x26, 0x29, 0x71, 0x4b, 0x8a, 0x31, 0x4c, 0xa4, 0xc3, 0x14, 0x52, 0xd1, 0x4a, 0xe3,
+    0x39, 0x2a, 0x5c, 0x50, 0x29, 0x6b, 0xd6, 0x4c, 0xfc, 0xd9, 0x06, 0x28, 0xc5, 0x2d, 0x2e, 0x28,
+    0x29, 0x31, 0x31, 0x46, 0x29, 0xd8, 0xa3, 0x14, 0x99, 0x69, 0x89, 0x8a, 0x31, 0x4e, 0xc5, 0x18,
+    0xac, 0xda, 0x2d, 0x31, 0xb8, 0xa3, 0x14, 0xec, 0x51, 0x8a, 0xc6, 0x51, 0x2d, 0x31, 0xb8, 0xa3,
+    0x14, 0xec, 0x51, 0x8a, 0xc2, 0x51, 0x2d, 0x31, 0xb8, 0xa4, 0xc5, 0x3f, 0x14, 0x62, 0xb0, 0x94,
+    0x0b, 0x4c, 0x66, 0x28, 0xc5, 0x3f, 0x14, 0x62, 0xb0, 0x94, 0x0d, 0x13, 0x19, 0x8a, 0x31, 0x4f,
+    0xc5, 0x18, 0xac, 0x25, 0x02, 0xd3, 0x19, 0x8a, 0x31, 0x4f, 0xc5, 0x2e, 0x2b, 0x09, 0x40, 0xb4,
+    0xc6, 0x62, 0x8c, 0x53, 0xf1, 0x46, 0x2b, 0x17, 0x02, 0xd3, 0x19, 0x8a, 0x31, 0x4f, 0xc5, 0x18,
+    0xac, 0xdc, 0x0b, 0x4c, 0x6e, 0x28, 0xc5, 0x3f, 0x14, 0x62, 0xb3, 0x70, 0x2d, 0x31, 0xb8, 0xa3,
+    0x14, 0xfc, 0x51, 0x8a, 0x87, 0x02, 0xd3, 0x1b, 0x8a, 0x5c, 0x53, 0xb1, 0x46, 0x2a, 0x79, 0x0a,
+    0x4c, 0x6e, 0x29, 0x71, 0x4e, 0xc5, 0x2e, 0x29, 0x72, 0x16, 0x98, 0xdc, 0x52, 0xe2, 0x9d, 0x8a,
+    0x31, 0x4b, 0x90, 0xa4, 0xc6, 0xe2, 0x97, 0x14, 0xec, 0x52, 0xe2, 0x8e, 0x42, 0x93, 0x1b, 0x8a,
+    0x5c, 0x53, 0xb1, 0x4b, 0x8a, 0x7c, 0x85, 0x26, 0x37, 0x14, 0xec, 0x52, 0xe2, 0x9d, 0x8a, 0xa5,
+    0x02, 0x93, 0x1b, 0x8a, 0x5c, 0x53, 0xb1, 0x4a, 0x05, 0x5a, 0x81, 0x57, 0x1a, 0x05, 0x38, 0x0a,
+    0x50, 0x29, 0xc0, 0x56, 0x8a, 0x05, 0x5c, 0x68, 0x14, 0xe0, 0x29, 0x40, 0xa7, 0x01, 0x5a, 0xa8,
+    0x0e, 0xe3, 0x40, 0xa7, 0x01, 0x4a, 0x05, 0x38, 0x0a, 0xd6, 0x30, 0x1d, 0xc6, 0x81, 0x4e, 0x02,
+    0x94, 0x0a, 0x70, 0x15, 0xb4, 0x60, 0x55, 0xc6, 0x81, 0x4e, 0x02, 0x94, 0x0a, 0x70, 0x15, 0xb4,
+    0x62, 0x3b, 0x88, 0x05, 0x28, 0x14, 0xa0, 0x53, 0x80, 0xad, 0x54, 0x47, 0x71, 0x00, 0xa5, 0x02,
+    0x94, 0x0a, 0x50, 0x2b, 0x44, 0x8a, 0xb8, 0x80, 0x53, 0xb1, 0x40, 0x14, 0xb8, 0xab, 0x48, 0x69,
+    0x86, 0x28, 0xc5, 0x2e, 0x29, 0x71, 0x4c, 0xa4, 0xc4, 0xc5, 0x2d, 0x14, 0xb4, 0x9b, 0x2d, 0x09,
+    0x45, 0x2d, 0x15, 0x1c, 0xc5, 0x1c, 0x90, 0xa5, 0xa2, 0x8a, 0xf5, 0x91, 0xf9, 0xb0, 0xb4, 0xa2,
+    0x8a, 0x2a, 0xca, 0x42, 0xd2, 0xd1, 0x45, 0x05, 0x20, 0xa5, 0xa2, 0x8a, 0x86, 0x5a, 0x0a, 0x28,
+    0xa2, 0xa1, 0x96, 0x85, 0xa2, 0x8a, 0x2b, 0x19, 0x16, 0x82, 0x8a, 0x28, 0xac, 0x64, 0x5a, 0x0a,
+    0x28, 0xa2, 0xb0, 0x91, 0x68, 0x28, 0xa2, 0x8a, 0xc6, 0x45, 0xa0, 0xc5, 0x18, 0xa2, 0x8a, 0xc6,
+    0x46, 0x88, 0x28, 0xc5, 0x14, 0x56, 0x2c, 0xb4, 0x2e, 0x28, 0xc5, 0x14, 0x56, 0x4c, 0xb4, 0x18,
+    0xa5, 0xc5, 0x14, 0x56, 0x6c, 0xb4, 0x18, 0xa5, 0xc5, 0x14, 0x54, 0x32, 0x90, 0x52, 0xe2, 0x8a,
+    0x2a, 0x4b, 0x42, 0xe2, 0x97, 0x14, 0x51, 0x48, 0xa4, 0x14, 0xb4, 0x51, 0x48, 0xa4, 0x2e, 0x29,
+    0x71, 0x45, 0x14, 0xcb, 0x42, 0xe2, 0x97, 0x14, 0x51, 0x4d, 0x14, 0x85, 0xc5, 0x28, 0xa2, 0x8a,
+    0xa4, 0x52, 0x14, 0x53, 0x85, 0x14, 0x55, 0xa1, 0xa1, 0x45, 0x28, 0x14, 0x51, 0x5a, 0x22, 0x87,
+    0x0a, 0x50, 0x28, 0xa2, 0xb4, 0x43, 0x1c, 0x29, 0x40, 0xa2, 0x8a, 0xd5, 0x14, 0x28, 0xa7, 0x0a,
+    0x28, 0xad, 0x62, 0x31, 0x45, 0x38, 0x51, 0x45, 0x6a, 0x8a, 0x14, 0x52, 0xd1, 0x45, 0x68, 0x86,
+    0x3a, 0x96, 0x8a, 0x2a, 0xd1, 0x42, 0xd2, 0xd1, 0x45, 0x32, 0x90, 0x52, 0xd1, 0x45, 0x22, 0x90,
+    0xb4, 0x51, 0x45, 0x43, 0x2d, 0x05, 0x14, 0x51, 0x59, 0x94, 0x7f, 0xff, 0xd9,
+};
+
+static const uint8_t cover_png[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x08, 0x02, 0x00, 0x00, 0x00, 0x22, 0x3a, 0x39,
+    0xc9, 0x00, 0x00, 0x20, 0x00, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0xdd, 0x9d, 0x4b, 0xaf, 0x65,
+    0x4b, 0x72, 0xd7, 0x23, 0x32, 0xd7, 0xb9, 0x9f, 0xc0, 0x63, 0x1e, 0xc2, 0x4c, 0x98, 0x30, 0x60,
+    0x78, 0xeb, 0x4e, 0x79, 0x08, 0x23, 0x1e, 0x6a, 0x81, 0x11, 0x06, 0xe4, 0x96, 0xb9, 0xd0, 0xdd,
+    0x72, 0x37, 0x6e, 0x23, 0x40, 0x32, 0xc8, 0x20, 0xb0, 0xc0, 0x96, 0x6d, 0x70, 0x23, 0x1b, 0xb9,
+    0x41, 0x3d, 0x30, 0xb2, 0x2c, 0x23, 0x0b, 0xb0, 0x68, 0x84, 0x61, 0xc6, 0xad, 0x73, 0x3d, 0xb0,
+    0x64, 0x59, 0xb6, 0x2c, 0x3f, 0xe4, 0xb6, 0xfc, 0x10, 0xf2, 0x88, 0x4f, 0x70, 0x6b, 0x65, 0x26,
+    0x83, 0x7d, 0xf6, 0xaa, 0xcc, 0x8c, 0x88, 0x7f, 0x44, 0xae, 0x7d, 0x4e, 0xdd, 0x3a, 0xb5, 0xb5,
+    0xb4, 0xb5, 0xf6, 0xae, 0xaa, 0x53, 0x67, 0xe5, 0xfa, 0xad, 0x7f, 0x44, 0x46, 0x46, 0x46, 0x30,
+    0xd1, 0x1f, 0x30, 0xe5, 0xcb, 0x91, 0x28, 0xf1, 0xf5, 0x48, 0x94, 0x98, 0x98, 0x89, 0x13, 0x31,
+    0x3f, 0x1c, 0x94, 0x88, 0xf8, 0x7a, 0x24, 0x6a, 0x4c, 0xc4, 0xd4, 0x12, 0x35, 0xa6, 0xc6, 0x54,
+    0x99, 0x5a, 0xa2, 0xca, 0xd7, 0xe3, 0x7a, 0x5e, 0x12, 0x55, 0xa6, 0x72, 0x3d, 0x2f, 0x97, 0xf3,
+    0xeb, 0x49, 0xb9, 0x7e, 0xb9, 0x77, 0xe7, 0xc3, 0x89, 0x75, 0x7e, 0xfd, 0xb1, 0xc7, 0x4f, 0xeb,
+    0xff, 0xbb, 0xfe, 0x17, 0x38, 0xce, 0x1b, 0x53, 0x4d, 0xd7, 0x5f, 0xf5, 0xfa, 0xdb, 0xb6, 0xeb,
+    0xf9, 0xe5, 0x84, 0x8e, 0x13, 0xa6, 0x76, 0xbd, 0xde, 0xd6, 0x5f, 0xfb, 0xf5, 0xe4, 0x18, 0x10,
+    0xbe, 0x7c, 0x4c, 0xc3, 0x09, 0x5f, 0x47, 0x2f, 0x8d, 0x27, 0xe9, 0x7a, 0xde, 0x8f, 0xf3, 0x71,
+    0x92, 0xaf, 0xe7, 0x97, 0x93, 0xe3, 0xa6, 0x5c, 0x4e, 0x72, 0x77, 0xa7, 0x94, 0xf3, 0xee, 0xcb,
+    0x4d, 0x7c, 0x99, 0xc4, 0xf9, 0xc3, 0x7f, 0xa7, 0xdd, 0xf4, 0xd4, 0x5d, 0x05, 0x5d, 0xaf, 0xab,
+    0xbf, 0xf6, 0x7e, 0xc4, 0xe4, 0x4d, 0x2f, 0x4c, 0x65, 0x23, 0xce, 0x44, 0x97, 0x23, 0x11, 0x25,
+    0xa2, 0xdc, 0xfd, 0x84, 0xcb, 0x3b, 0x5d, 0xdf, 0xfb, 0x57, 0x23, 0x6a, 0x44, 0x44, 0x54, 0xaf,
+    0xe7, 0xf5, 0x7a, 0x5e, 0x89, 0xca, 0xf5, 0x63, 0xb9, 0xbe, 0xf7, 0x27, 0xc7, 0xb1, 0xaf, 0x7c,
+    0x94, 0xc7, 0xf4, 0x93, 0xfb, 0xff, 0xd7, 0x3a, 0xda, 0xf8, 0x0b, 0x37, 0xed, 0x20, 0xed, 0x5d,
+    0x7d, 0xb1, 0xf6, 0x2e, 0x8f, 0x89, 0xc9, 0x04, 0x8f, 0x3c, 0xbe, 0xf7, 0x27, 0xd6, 0xb1, 0x89,
+    0x8f, 0x55, 0xfb, 0x78, 0x5c, 0x60, 0x22, 0x6a, 0xd7, 0x6f, 0x72, 0x77, 0xd5, 0x74, 0xfd, 0x53,
+    0xea, 0x7e, 0x61, 0xd2, 0x00, 0x38, 0x2e, 0xf6, 0x32, 0x8c, 0x49, 0xfe, 0x9d, 0x03, 0xac, 0x13,
+    0x54, 0xb5, 0xf1, 0x0e, 0xf5, 0xf7, 0xaf, 0x08, 0xaa, 0x0a, 0xa4, 0x6a, 0x1f, 0xbf, 0xd9, 0xc3,
+    0x78, 0xf5, 0x6c, 0x55, 0xed, 0xa4, 0x8e, 0xbf, 0x5e, 0x13, 0x78, 0x59, 0x60, 0xf5, 0x63, 0x8d,
+    0xc1, 0x3a, 0x6e, 0x83, 0x05, 0xd6, 0x34, 0xa4, 0x49, 0x23, 0x2c, 0x6b, 0x27, 0x2e, 0x55, 0x17,
+    0xa4, 0xca, 0x88, 0x57, 0xed, 0x78, 0xba, 0x1c, 0xdb, 0x38, 0x1a, 0x07, 0x4c, 0x3d, 0x5b, 0x3d,
+    0x55, 0x74, 0xfd, 0xf5, 0xea, 0x78, 0x8d, 0xd3, 0xb5, 0xb7, 0xee, 0xaf, 0xa5, 0xeb, 0x4f, 0x1e,
+    0xc0, 0x9a, 0xa8, 0x4a, 0xe3, 0x48, 0x01, 0xaa, 0x24, 0x52, 0x80, 0x2a, 0x15, 0x97, 0xdd, 0x78,
+    0xb7, 0x38, 0x73, 0x45, 0xcb, 0xd2, 0xad, 0xf6, 0x36, 0x81, 0xc5, 0xb6, 0x56, 0xc5, 0xe5, 0x6a,
+    0x1b, 0x91, 0x2a, 0xd7, 0x93, 0xaa, 0xe1, 0xb5, 0x8d, 0x43, 0xd1, 0x34, 0xb6, 0x26, 0x55, 0xa3,
+    0x51, 0xb4, 0x30, 0x5b, 0x87, 0xf9, 0xca, 0x57, 0xb0, 0x92, 0x45, 0x15, 0x6b, 0x43, 0x09, 0xa8,
+    0xea, 0xef, 0x6b, 0x7f, 0xb3, 0x2d, 0x65, 0x8a, 0xbf, 0x03, 0xb6, 0x1e, 0x1d, 0x2c, 0x12, 0x06,
+    0xd1, 0x62, 0x8b, 0x85, 0x5d, 0x70, 0xad, 0xe1, 0x23, 0x82, 0xd5, 0x53, 0xa5, 0x22, 0x25, 0xf1,
+    0xda, 0x34, 0xbf, 0xa5, 0xb7, 0x8c, 0xd3, 0x13, 0x45, 0x9d, 0x1a, 0x11, 0xb4, 0x89, 0xc7, 0x5f,
+    0x7e, 0xcd, 0xd6, 0x46, 0x7c, 0x82, 0x2a, 0x2c, 0x54, 0xc0, 0xf0, 0x1d, 0xef, 0xe0, 0xa4, 0xff,
+    0x18, 0x67, 0x0b, 0x83, 0xd5, 0x62, 0x3e, 0x16, 0x19, 0x6e, 0x16, 0x85, 0xdd, 0x2c, 0x95, 0x2d,
+    0xd5, 0xc7, 0xe2, 0x00, 0x58, 0x41, 0xaa, 0x0e, 0xb9, 0xea, 0xdf, 0x0f, 0xb0, 0x0e, 0xaa, 0xd4,
+    0x87, 0x6a, 0x72, 0xbf, 0xf2, 0x38, 0x0e, 0xaa, 0x74, 0xb1, 0xfd, 0x8c, 0xbd, 0x66, 0xeb, 0x02,
+    0x96, 0x4b, 0x55, 0xff, 0x9f, 0x01, 0x8f, 0x0a, 0xab, 0x94, 0x7a, 0x62, 0x9d, 0x07, 0x45, 0x2b,
+    0xa2, 0x58, 0x8f, 0xe2, 0x60, 0x35, 0x28, 0x57, 0x4f, 0xe1, 0x66, 0x01, 0xc5, 0x2a, 0xe3, 0xc9,
+    0x76, 0x1d, 0x84, 0x9e, 0xaa, 0x03, 0xac, 0x2a, 0x0c, 0xe2, 0xa6, 0x0d, 0xc2, 0x71, 0x99, 0x59,
+    0xbb, 0xde, 0xb8, 0x74, 0x3d, 0xb0, 0x75, 0x01, 0x2b, 0x8d, 0x43, 0x60, 0x51, 0x55, 0x05, 0x58,
+    0xd8, 0x9d, 0x92, 0x22, 0xb4, 0x6b, 0x1f, 0x2d, 0xbc, 0x22, 0x6c, 0xa9, 0x60, 0xd5, 0x80, 0x29,
+    0x3c, 0xe1, 0x60, 0x35, 0x6d, 0x4c, 0xe3, 0x60, 0xb9, 0xa6, 0x30, 0xc5, 0xc0, 0x92, 0x46, 0xb0,
+    0x8c, 0x6c, 0xd5, 0xf1, 0x5c, 0xb2, 0xd5, 0xb4, 0xd1, 0xe8, 0xa9, 0x52, 0x05, 0x9b, 0x3b, 0xe9,
+    0x3a, 0xbc, 0x2b, 0xeb, 0x61, 0x4b, 0x17, 0x1f, 0x8b, 0x47, 0x87, 0x1d, 0x53, 0x25, 0x2d, 0xa0,
+    0x6b, 0xf5, 0x2c, 0x98, 0x96, 0xf0, 0x92, 0x6c, 0x05, 0x1d, 0xac, 0xc9, 0xa5, 0x88, 0x80, 0x75,
+    0xda, 0x14, 0x46, 0xc0, 0x5a, 0xb2, 0x86, 0x13, 0x5b, 0x9b, 0x90, 0xab, 0xde, 0x14, 0xaa, 0x48,
+    0x55, 0x81, 0x54, 0x13, 0x1f, 0xe5, 0x91, 0x85, 0x0b, 0x94, 0x46, 0xe9, 0x02, 0x6c, 0xa5, 0x8b,
+    0x62, 0xf5, 0x91, 0x85, 0x25, 0xaa, 0xa6, 0xbb, 0x8b, 0x55, 0x6a, 0xf5, 0x28, 0x36, 0x5b, 0xae,
+    0x8f, 0x75, 0x0e, 0x2c, 0xec, 0x60, 0x35, 0xdb, 0x69, 0xe5, 0x45, 0x17, 0x1e, 0x80, 0xe5, 0xfa,
+    0x58, 0x65, 0x24, 0x6c, 0x92, 0x2b, 0x0b, 0x29, 0x0c, 0x99, 0x3a, 0x14, 0x24, 0x34, 0x4c, 0x9a,
+    0x45, 0x95, 0xad, 0x43, 0xb1, 0xd8, 0x8a, 0x2c, 0x00, 0xaa, 0x40, 0xb4, 0xd3, 0xd2, 0xa7, 0x57,
+    0x1a, 0x3d, 0xaf, 0xc2, 0xa2, 0x75, 0x8b, 0x1d, 0xb4, 0x8c, 0x60, 0x15, 0xf3, 0x5c, 0x7a, 0x0c,
+    0xb0, 0x48, 0xf8, 0x15, 0x69, 0xdd, 0x20, 0x06, 0xad, 0xa1, 0x2a, 0x57, 0x72, 0x94, 0xd4, 0x31,
+    0x71, 0x05, 0x5b, 0x5a, 0xc6, 0x08, 0x5b, 0x0f, 0xdf, 0x6c, 0x94, 0x6e, 0xa7, 0x0a, 0x20, 0xf5,
+    0xca, 0xfe, 0xf8, 0x6a, 0x51, 0xb4, 0x6e, 0x91, 0x2b, 0x39, 0x15, 0x92, 0x42, 0xa5, 0x22, 0x15,
+    0x34, 0x85, 0x16, 0x58, 0xa4, 0xc9, 0x55, 0x84, 0x2d, 0x3c, 0x31, 0x94, 0x3e, 0x56, 0x5c, 0xae,
+    0x9a, 0x16, 0x71, 0x00, 0xa1, 0x16, 0xeb, 0xe5, 0xb0, 0xd5, 0x2b, 0x56, 0x90, 0x2a, 0x39, 0xf5,
+    0x73, 0x55, 0x0a, 0x9c, 0xa8, 0x84, 0x95, 0x80, 0x62, 0x55, 0x0f, 0x2c, 0x35, 0xc4, 0x80, 0xb5,
+    0x0a, 0x53, 0xd5, 0xbc, 0x09, 0x11, 0xb0, 0x86, 0x40, 0xb7, 0x80, 0xb3, 0x65, 0xe1, 0xb5, 0x89,
+    0x10, 0x43, 0x5d, 0xd1, 0xaa, 0x1a, 0x9e, 0x17, 0xe3, 0x40, 0x31, 0x62, 0xeb, 0x02, 0x96, 0xea,
+    0x5d, 0x59, 0x54, 0x59, 0x5a, 0x85, 0xa9, 0x7a, 0x15, 0x20, 0xcc, 0x62, 0x0b, 0xd8, 0xc1, 0xa0,
+    0x11, 0x3c, 0xe7, 0x5a, 0xb9, 0x4f, 0xad, 0x2b, 0x5a, 0xa7, 0x57, 0x0f, 0x0b, 0x04, 0xab, 0x8c,
+    0x6c, 0xd5, 0x80, 0x5c, 0x81, 0xc7, 0x0c, 0xb8, 0x59, 0x0d, 0x3a, 0x5b, 0x13, 0x5b, 0x34, 0xad,
+    0x15, 0xaa, 0x51, 0xd0, 0x20, 0x55, 0x13, 0x58, 0x00, 0x26, 0x8c, 0xd7, 0x71, 0x5e, 0x62, 0xa6,
+    0xb0, 0x8a, 0x87, 0xb2, 0x9c, 0x8a, 0x5a, 0xb9, 0x5a, 0xb5, 0x6a, 0x0a, 0x83, 0x60, 0xb9, 0x91,
+    0xad, 0x3c, 0xe2, 0xd5, 0xbb, 0xed, 0x59, 0x2c, 0xe0, 0xf4, 0x54, 0x95, 0xc5, 0xb0, 0x4b, 0xb5,
+    0x3d, 0xf7, 0xe0, 0xa3, 0x95, 0xd4, 0x75, 0xe8, 0x6d, 0x08, 0x7a, 0xcd, 0xf6, 0xc2, 0xa2, 0xca,
+    0x12, 0xaa, 0x9e, 0x98, 0x89, 0xa4, 0x20, 0x5e, 0x11, 0xb9, 0xb2, 0x16, 0x9e, 0x4f, 0x07, 0x17,
+    0x80, 0x50, 0xc5, 0xc1, 0xba, 0x85, 0x2d, 0x09, 0x56, 0x19, 0xf1, 0x52, 0xd9, 0xaa, 0x30, 0xd0,
+    0x50, 0x16, 0x23, 0x79, 0xa4, 0x39, 0x9d, 0xc1, 0x07, 0x2c, 0x49, 0x3f, 0xa1, 0x57, 0x2c, 0x15,
+    0xa9, 0x20, 0x55, 0x2a, 0x37, 0xe0, 0x44, 0xe2, 0x05, 0xc0, 0x3a, 0xfe, 0x53, 0x1c, 0xb8, 0x3a,
+    0x1d, 0x61, 0x6f, 0x76, 0x54, 0x30, 0xb8, 0x08, 0x2d, 0x4d, 0x61, 0x1c, 0x2f, 0xa0, 0x5b, 0xb5,
+    0x3b, 0x29, 0x9d, 0x3e, 0x4d, 0xb9, 0x31, 0x53, 0x9c, 0xfd, 0x44, 0x70, 0x58, 0x9d, 0xc1, 0xac,
+    0xbe, 0x86, 0x35, 0x9f, 0x03, 0x2c, 0x39, 0x63, 0x52, 0x97, 0x96, 0xad, 0x79, 0x9f, 0x44, 0xca,
+    0x3a, 0xef, 0x4f, 0x30, 0x58, 0x41, 0x23, 0x88, 0x3d, 0xd3, 0xe0, 0x04, 0xf0, 0x9c, 0x5c, 0x45,
+    0x44, 0xcb, 0x9d, 0x2a, 0x56, 0x3b, 0xb8, 0x55, 0x3b, 0x01, 0xcb, 0x23, 0x5e, 0x75, 0x4c, 0xb7,
+    0xb2, 0xc0, 0x6a, 0x2b, 0x1e, 0xe7, 0x52, 0x22, 0x9a, 0x0c, 0x31, 0xf4, 0x6b, 0x3e, 0x7c, 0x01,
+    0xab, 0xd9, 0x46, 0xb0, 0x1a, 0xae, 0xd5, 0x1e, 0xe3, 0xe9, 0x46, 0xb0, 0x8e, 0xff, 0xb1, 0x8a,
+    0xc9, 0x4e, 0x59, 0x4f, 0x5e, 0xa0, 0xf5, 0x78, 0x55, 0xc4, 0x14, 0xb6, 0xc5, 0xf8, 0x56, 0x0f,
+    0x56, 0x1d, 0x09, 0xb3, 0xc2, 0x10, 0x92, 0x2a, 0xb9, 0x26, 0x98, 0x57, 0x82, 0xc3, 0xd6, 0x42,
+    0xe1, 0xd2, 0x4a, 0xc3, 0xf4, 0xb1, 0x37, 0x88, 0xb4, 0x51, 0x8a, 0x20, 0x85, 0xcd, 0x9f, 0x05,
+    0x93, 0x2b, 0x5d, 0xc0, 0xc1, 0x72, 0xe3, 0x0b, 0xab, 0x13, 0xc0, 0xb8, 0x93, 0xbe, 0x64, 0x08,
+    0x9a, 0x01, 0xd9, 0x71, 0x1e, 0xb4, 0x8c, 0xb5, 0x53, 0x2f, 0x09, 0x56, 0xed, 0xf0, 0xea, 0x09,
+    0xcb, 0x22, 0x2b, 0xe6, 0x96, 0xe5, 0xac, 0xd3, 0x83, 0x20, 0x93, 0x67, 0x06, 0x53, 0xa8, 0xae,
+    0x2e, 0xab, 0x42, 0xb5, 0x6b, 0x30, 0x61, 0xb6, 0x22, 0x60, 0x15, 0x43, 0xb1, 0x82, 0x16, 0xd0,
+    0x7a, 0x16, 0x97, 0xd2, 0x16, 0xce, 0xb9, 0x17, 0xc7, 0xbf, 0xe5, 0xf1, 0xe7, 0xb0, 0x76, 0x02,
+    0xd4, 0x2b, 0x8d, 0x90, 0x25, 0x0d, 0x2f, 0x55, 0x9c, 0xa6, 0xb4, 0x85, 0x20, 0x58, 0xe0, 0x42,
+    0x4e, 0x4c, 0x87, 0xa9, 0xbf, 0x8a, 0x8d, 0x58, 0xfa, 0x55, 0x78, 0xdd, 0x66, 0x5f, 0xc1, 0xc8,
+    0x02, 0x0b, 0x47, 0xb0, 0xc0, 0x62, 0x33, 0xa6, 0x6a, 0x75, 0x5d, 0xf9, 0x16, 0x8c, 0x5c, 0x01,
+    0xeb, 0x51, 0x6b, 0x63, 0xca, 0xa5, 0xb5, 0x62, 0xdd, 0x84, 0x80, 0x25, 0x0d, 0x2f, 0xc9, 0x56,
+    0xb3, 0xd7, 0x01, 0x2d, 0x8f, 0x33, 0x28, 0x5d, 0xaa, 0x77, 0xd5, 0x3f, 0x15, 0x45, 0xe4, 0x3e,
+    0x34, 0xa2, 0x7a, 0x98, 0xc2, 0xa0, 0x53, 0xb5, 0x8f, 0x01, 0x05, 0xeb, 0xf8, 0x64, 0x5d, 0xae,
+    0xac, 0x38, 0xbb, 0x1b, 0x5b, 0x5f, 0x75, 0x45, 0x1f, 0x1d, 0xa6, 0x25, 0xd4, 0x0e, 0xda, 0x9a,
+    0xe0, 0x4c, 0x85, 0xac, 0x69, 0x78, 0x35, 0xc1, 0x56, 0xd3, 0x08, 0x3b, 0x67, 0x04, 0x83, 0xde,
+    0x95, 0x93, 0x95, 0x75, 0x51, 0x2c, 0xd7, 0x67, 0x97, 0x48, 0x59, 0x78, 0x7d, 0x62, 0xe3, 0x25,
+    0x23, 0x0e, 0xd8, 0x67, 0x07, 0xde, 0x7a, 0x70, 0xfe, 0xfc, 0x29, 0xf2, 0x14, 0xd7, 0xb3, 0x36,
+    0x6a, 0x95, 0x04, 0x4b, 0xe2, 0xd5, 0x3a, 0x9b, 0xd8, 0xb4, 0x5d, 0x52, 0xcd, 0x16, 0xad, 0x55,
+    0xbf, 0x8a, 0x61, 0xfe, 0x19, 0x1b, 0x32, 0xd6, 0x36, 0xe2, 0x88, 0x56, 0x15, 0x43, 0xb1, 0xf6,
+    0x18, 0x52, 0xaa, 0x29, 0x94, 0xd1, 0x76, 0xe0, 0xb0, 0xbb, 0x4e, 0x95, 0x15, 0x89, 0x39, 0xc7,
+    0x13, 0x3f, 0x86, 0x32, 0x9d, 0x23, 0x8c, 0x85, 0x59, 0xe9, 0xf1, 0xea, 0x33, 0x86, 0x93, 0xa1,
+    0x4f, 0xd5, 0x5e, 0x66, 0xb6, 0xf4, 0xa9, 0xd9, 0xd3, 0x11, 0x40, 0x12, 0xd2, 0xad, 0xc3, 0xc7,
+    0x8a, 0xe0, 0x15, 0x71, 0xa1, 0x82, 0x8a, 0xd5, 0xe3, 0x25, 0xc3, 0xa1, 0x96, 0x56, 0x59, 0xae,
+    0xe8, 0x89, 0x5c, 0xf5, 0x88, 0x9e, 0xaf, 0xb2, 0x78, 0x62, 0x1e, 0x60, 0x19, 0xca, 0x03, 0xa3,
+    0x09, 0xaf, 0x5e, 0xba, 0x72, 0xb7, 0x15, 0xa2, 0x19, 0x91, 0x48, 0x1c, 0x0b, 0x6d, 0x5e, 0x8a,
+    0x2c, 0x7b, 0x66, 0xd1, 0xd4, 0xad, 0x8d, 0x92, 0xba, 0xd9, 0x06, 0xa7, 0x2d, 0xec, 0x06, 0x4f,
+    0x9f, 0xc4, 0x7c, 0x2c, 0x75, 0x32, 0x28, 0x43, 0x56, 0x20, 0x58, 0xe5, 0x0a, 0xd5, 0x89, 0x90,
+    0x26, 0xc1, 0xa7, 0x30, 0xc2, 0x07, 0x8b, 0xdb, 0x13, 0x9f, 0x28, 0x34, 0x4d, 0xba, 0xfa, 0xec,
+    0xcd, 0x1e, 0xb5, 0x5e, 0xb7, 0xb2, 0x6d, 0xf2, 0xaa, 0x97, 0x78, 0xed, 0xfe, 0x6e, 0xac, 0xf9,
+    0xec, 0x16, 0x4f, 0xa5, 0xff, 0xa3, 0xde, 0x14, 0xc6, 0x17, 0x04, 0xf1, 0xac, 0x50, 0xc5, 0x0b,
+    0xcb, 0x95, 0xf4, 0xd6, 0xcb, 0xca, 0xec, 0x8f, 0x56, 0xdc, 0x4f, 0x2b, 0xbe, 0x77, 0x3b, 0x58,
+    0x32, 0x90, 0xc1, 0x2b, 0x77, 0x51, 0xfd, 0xe7, 0x7c, 0xdd, 0xf7, 0x72, 0xc8, 0x98, 0x94, 0xa8,
+    0x34, 0x9e, 0xd4, 0xd8, 0xa2, 0x8d, 0x65, 0x16, 0x23, 0x71, 0x5d, 0xe0, 0x5d, 0x51, 0x0f, 0x56,
+    0xb1, 0x85, 0xaa, 0x04, 0x90, 0xfa, 0x24, 0x26, 0x5a, 0x11, 0x9f, 0x7d, 0x95, 0xaa, 0x5b, 0x72,
+    0xf1, 0x70, 0x1c, 0x39, 0x88, 0x57, 0xd3, 0x54, 0x87, 0xb4, 0x39, 0xe9, 0x92, 0xad, 0x94, 0x78,
+    0x31, 0x64, 0xab, 0x89, 0x1d, 0xa7, 0xaa, 0xa5, 0x6b, 0xe1, 0x30, 0xd5, 0x6a, 0x22, 0x50, 0x2f,
+    0x6c, 0xe5, 0xe2, 0x63, 0x05, 0x15, 0x6b, 0x29, 0x76, 0xf5, 0x89, 0xe7, 0xb6, 0xab, 0x51, 0xab,
+    0x25, 0xaa, 0x5c, 0xa4, 0x40, 0xc8, 0x1b, 0x7f, 0x19, 0x71, 0x32, 0xc8, 0x0e, 0xb4, 0xca, 0x04,
+    0x5f, 0xeb, 0x4b, 0x97, 0x30, 0x0b, 0xaf, 0x08, 0x5b, 0x74, 0x4a, 0xdd, 0x39, 0x36, 0x62, 0xfe,
+    0x71, 0xf1, 0xb1, 0xdc, 0xc5, 0x66, 0xb0, 0xd2, 0x0c, 0x44, 0x4b, 0x82, 0xa5, 0xce, 0x04, 0xc1,
+    0x34, 0xd0, 0xda, 0xa5, 0xd4, 0xce, 0x3e, 0x67, 0xee, 0x49, 0x5c, 0xb7, 0x2c, 0xad, 0xb2, 0xc2,
+    0xfd, 0x78, 0x25, 0x20, 0x82, 0xd7, 0x64, 0x1f, 0xd9, 0xc8, 0x83, 0xcd, 0x5a, 0x00, 0xbd, 0x9d,
+    0x4a, 0x60, 0x5c, 0x83, 0xa9, 0x4b, 0xc4, 0x78, 0x6d, 0x0a, 0xf1, 0x64, 0x70, 0xbf, 0x39, 0xe6,
+    0x8e, 0xc3, 0xa1, 0x72, 0x0e, 0x68, 0xcd, 0x96, 0x83, 0x0f, 0x1c, 0x07, 0x62, 0x2d, 0x7c, 0x03,
+    0x5b, 0x4b, 0x54, 0xb9, 0x1f, 0x39, 0x70, 0xd7, 0xa7, 0xef, 0x6b, 0x27, 0x5d, 0x04, 0x55, 0x8a,
+    0x16, 0x4b, 0x51, 0xe0, 0xa1, 0x63, 0x91, 0x63, 0x2d, 0x93, 0x7f, 0x98, 0xa8, 0x6c, 0xc4, 0x05,
+    0x66, 0xc5, 0xc4, 0x7d, 0xf6, 0x25, 0xaa, 0xf6, 0x98, 0x05, 0x94, 0xb3, 0xbf, 0x08, 0x52, 0xc1,
+    0xe7, 0xcc, 0xf2, 0x46, 0x01, 0x5e, 0xd6, 0x54, 0x4e, 0x05, 0xab, 0x79, 0x56, 0xa9, 0x09, 0xb6,
+    0xf0, 0xed, 0x97, 0xd2, 0x95, 0xae, 0xe3, 0x93, 0xa0, 0x4a, 0x9d, 0xf6, 0xa8, 0x22, 0x99, 0x64,
+    0xc8, 0x14, 0x16, 0x3b, 0xf3, 0x58, 0x4d, 0x0d, 0x3d, 0xb1, 0xea, 0x8c, 0x8d, 0xa0, 0x65, 0x01,
+    0x23, 0x42, 0x85, 0x05, 0x29, 0xad, 0x28, 0xb9, 0xeb, 0xd7, 0x93, 0xe7, 0x51, 0x51, 0x78, 0x31,
+    0x4e, 0x46, 0x04, 0x38, 0x96, 0xb7, 0xd9, 0x84, 0x6e, 0x45, 0x6c, 0x22, 0xad, 0x3c, 0x9c, 0xf1,
+    0xac, 0x57, 0x1e, 0x13, 0x31, 0x5e, 0x7f, 0x79, 0x51, 0x2c, 0x10, 0x6d, 0x97, 0x48, 0xb9, 0xf1,
+    0xd2, 0x1d, 0x06, 0xae, 0xac, 0xf4, 0x3d, 0xbc, 0xeb, 0x2d, 0x88, 0x94, 0xfb, 0x60, 0x25, 0xe3,
+    0x4f, 0x09, 0xe2, 0x15, 0x07, 0x6b, 0xba, 0xb5, 0x78, 0x75, 0xa5, 0x8a, 0x78, 0x7a, 0x8b, 0xa5,
+    0x05, 0xcb, 0x6f, 0x2a, 0x34, 0xd6, 0xc1, 0x6c, 0x58, 0x00, 0x56, 0x32, 0x76, 0x19, 0x5d, 0x4e,
+    0x76, 0xf9, 0xfd, 0x31, 0x2b, 0x94, 0xdb, 0xb9, 0xf6, 0x95, 0xe5, 0xe7, 0x5d, 0x0b, 0x56, 0x01,
+    0xaa, 0x76, 0x6d, 0x81, 0xd9, 0x72, 0xd5, 0x4f, 0x20, 0x95, 0x0c, 0xdb, 0x9f, 0x62, 0x4a, 0x26,
+    0x57, 0x33, 0xf0, 0x94, 0xcd, 0xd5, 0x2a, 0x35, 0xd5, 0x2e, 0xc5, 0x16, 0x89, 0x31, 0x5e, 0x6d,
+    0x74, 0x9c, 0xc9, 0x8e, 0x32, 0xb8, 0x09, 0x0b, 0xc1, 0xa7, 0x34, 0x89, 0x64, 0x57, 0x09, 0x5f,
+    0x9a, 0x14, 0xcb, 0xda, 0x74, 0xfa, 0x6a, 0x3d, 0x8f, 0xef, 0x55, 0x20, 0x93, 0x3d, 0x62, 0x01,
+    0x23, 0xb3, 0x95, 0xe4, 0x55, 0xa2, 0x92, 0x43, 0xc0, 0xda, 0x23, 0x68, 0xe9, 0x56, 0x44, 0xb1,
+    0x9a, 0x56, 0x3e, 0x53, 0x2d, 0xbf, 0x51, 0xc7, 0xac, 0x98, 0x3a, 0xae, 0x34, 0x4f, 0x9b, 0x1f,
+    0xdd, 0xf5, 0x1f, 0x29, 0x5a, 0x0c, 0xe3, 0x6a, 0x04, 0x83, 0x76, 0x27, 0xa6, 0x81, 0x49, 0xe8,
+    0x56, 0xba, 0x14, 0x05, 0x29, 0xb1, 0x3c, 0x19, 0x57, 0xc3, 0x2c, 0xb9, 0x92, 0xfb, 0x5a, 0xc1,
+    0x8a, 0x0d, 0xa6, 0xea, 0x44, 0xf5, 0x29, 0xeb, 0xc4, 0x55, 0x2f, 0x2c, 0x5a, 0x11, 0xb9, 0xaa,
+    0x1a, 0x58, 0x56, 0x96, 0x4b, 0xea, 0x2c, 0xe3, 0x81, 0x5a, 0x8d, 0xe5, 0x20, 0x34, 0x68, 0x13,
+    0x83, 0x49, 0xeb, 0x2a, 0x55, 0x29, 0x76, 0x28, 0x7f, 0x53, 0x55, 0xac, 0xe0, 0xfa, 0x60, 0x24,
+    0xaa, 0x2e, 0x63, 0xa1, 0x41, 0xbf, 0x0a, 0xa7, 0x98, 0xc5, 0x8b, 0x4e, 0x25, 0x28, 0xe0, 0x11,
+    0xb6, 0xc8, 0xab, 0x98, 0x12, 0xa4, 0xaa, 0xda, 0xe9, 0x9d, 0xb5, 0x4b, 0x4a, 0xee, 0xf1, 0xe2,
+    0x70, 0xc0, 0x45, 0x06, 0x23, 0x40, 0xfe, 0x74, 0x64, 0x60, 0x83, 0xd6, 0xf0, 0x38, 0xf6, 0x69,
+    0xa8, 0xfb, 0x25, 0x9d, 0x1d, 0xa6, 0xb7, 0x5b, 0x6e, 0xbb, 0xb5, 0xa3, 0x10, 0x94, 0xf7, 0x00,
+    0xb1, 0x75, 0x82, 0xab, 0x57, 0x4b, 0x3c, 0x45, 0x9e, 0x30, 0xcb, 0x2c, 0x62, 0x6b, 0x08, 0xec,
+    0x60, 0x0b, 0xa8, 0x14, 0x3e, 0xfa, 0x64, 0xac, 0x9e, 0x2d, 0xd7, 0x32, 0x36, 0x11, 0x86, 0x88,
+    0x47, 0x41, 0xd5, 0xc5, 0xe6, 0x14, 0xf0, 0xae, 0x24, 0x5b, 0xfb, 0x64, 0x0a, 0x77, 0x6f, 0xd3,
+    0x84, 0x4a, 0x58, 0xa4, 0x0a, 0x83, 0x5b, 0x50, 0x20, 0x4e, 0x55, 0xbc, 0xae, 0x75, 0x5e, 0x27,
+    0x8c, 0xb5, 0x02, 0x74, 0x27, 0x14, 0x4b, 0xad, 0x4f, 0xee, 0x1e, 0xc5, 0x20, 0xac, 0x8a, 0xff,
+    0xa5, 0xc2, 0xc5, 0x47, 0x1e, 0x67, 0x06, 0xee, 0x1a, 0x17, 0xc3, 0x47, 0x37, 0xc2, 0x93, 0xce,
+    0xd6, 0xc5, 0x14, 0xee, 0xde, 0xa6, 0x09, 0x5c, 0x67, 0xc1, 0x35, 0x85, 0x91, 0x6d, 0x5b, 0x16,
+    0x55, 0xc0, 0x5b, 0xb4, 0x48, 0xca, 0xf6, 0x89, 0xc5, 0x56, 0x50, 0xb4, 0x54, 0xb0, 0x22, 0x72,
+    0x05, 0x48, 0x2a, 0x57, 0x0e, 0xa6, 0x8a, 0x01, 0x2c, 0x76, 0x89, 0x1d, 0xde, 0x18, 0x30, 0x8b,
+    0x98, 0xad, 0x3e, 0x4b, 0x3d, 0x32, 0xcb, 0x4e, 0xeb, 0xc7, 0x65, 0x0f, 0xf7, 0xde, 0xfb, 0x58,
+    0xae, 0x87, 0xae, 0x7a, 0x5a, 0xf1, 0x0c, 0xe3, 0x02, 0xf3, 0xab, 0x5c, 0xa7, 0x2a, 0x58, 0xb7,
+    0x73, 0x7a, 0x97, 0x1f, 0x31, 0x5e, 0x8f, 0x0b, 0x16, 0xa0, 0x2a, 0x5f, 0x47, 0x23, 0x77, 0x6c,
+    0x1d, 0x9c, 0xb1, 0x20, 0xac, 0x76, 0xdb, 0x60, 0x6a, 0xc0, 0x26, 0x92, 0xcd, 0x96, 0xeb, 0x5d,
+    0x25, 0x3b, 0xe6, 0x17, 0xb5, 0x0c, 0x32, 0x40, 0x5a, 0x62, 0x05, 0x89, 0x80, 0x6f, 0x1e, 0xdc,
+    0xb9, 0x15, 0xa7, 0x0a, 0xd7, 0xaf, 0x06, 0xad, 0x1c, 0xa6, 0x13, 0x6b, 0x2c, 0x64, 0x00, 0x30,
+    0x19, 0xfe, 0x87, 0x3a, 0x25, 0x94, 0x21, 0x86, 0x0a, 0x0b, 0x4b, 0xcb, 0x72, 0xc0, 0xc7, 0x83,
+    0x5e, 0x46, 0x7d, 0x2a, 0x22, 0x81, 0xae, 0x76, 0xff, 0x75, 0x0d, 0x4c, 0x15, 0x25, 0x5b, 0x3c,
+    0x4a, 0x97, 0x8a, 0xce, 0xbe, 0xd8, 0x47, 0x23, 0x5d, 0x1f, 0x8f, 0xe3, 0x18, 0x7c, 0xac, 0xc7,
+    0x3a, 0xd4, 0xc8, 0x02, 0x08, 0x59, 0xb9, 0x4e, 0x95, 0x75, 0x49, 0xa0, 0xec, 0x5d, 0xd2, 0xce,
+    0x2d, 0x8b, 0x09, 0x3c, 0x2d, 0xf2, 0xca, 0x1d, 0x52, 0xc0, 0xbb, 0x2a, 0x46, 0x82, 0xee, 0x71,
+    0x33, 0x8e, 0x1b, 0x93, 0x0c, 0xc8, 0x8a, 0xb6, 0xc1, 0xd5, 0xc5, 0xab, 0xd9, 0xba, 0x35, 0x6d,
+    0xdb, 0x22, 0xa8, 0x5b, 0xae, 0x89, 0x50, 0x1e, 0xd7, 0x8d, 0x78, 0xf7, 0x8a, 0x13, 0xc5, 0x6b,
+    0xf0, 0xb9, 0x3b, 0x6d, 0xa4, 0x5f, 0x65, 0x51, 0xa5, 0x3a, 0x8f, 0x4b, 0xed, 0x40, 0x00, 0x64,
+    0xd3, 0x0f, 0x64, 0x68, 0x10, 0x97, 0x4c, 0x61, 0xb5, 0xdb, 0x0a, 0xc9, 0x2c, 0x92, 0x69, 0x95,
+    0x76, 0xf2, 0x54, 0xa6, 0x7c, 0xdf, 0xa2, 0x55, 0x1f, 0xae, 0x63, 0xd6, 0xa8, 0x95, 0xb0, 0x3a,
+    0xb1, 0xc5, 0xb1, 0x35, 0x8c, 0x60, 0x31, 0xcb, 0xcb, 0xfb, 0x3e, 0xe9, 0xd6, 0xe1, 0xbc, 0xaf,
+    0x96, 0x37, 0x76, 0xdd, 0xa9, 0x48, 0xfc, 0xb3, 0x41, 0xaa, 0x64, 0xbd, 0xa8, 0x20, 0x4c, 0x1b,
+    0xc4, 0x4b, 0x7d, 0xce, 0x2c, 0xd1, 0x8a, 0x2b, 0x96, 0x2b, 0x57, 0xb8, 0x5f, 0x55, 0x39, 0x26,
+    0xea, 0x9a, 0x3b, 0xdc, 0xb3, 0x35, 0xfd, 0x32, 0x4d, 0x8b, 0xe0, 0x4b, 0x5f, 0x5e, 0xce, 0x2b,
+    0xfb, 0x9f, 0x59, 0x34, 0x92, 0x86, 0xf0, 0x81, 0xe7, 0x81, 0xf4, 0x78, 0xe9, 0x3e, 0x16, 0x88,
+    0x3b, 0x94, 0x30, 0x67, 0xd5, 0x2b, 0xab, 0x1a, 0xa1, 0xca, 0x2a, 0xf6, 0x0a, 0x48, 0xda, 0x3c,
+    0xbc, 0xb2, 0xed, 0xce, 0xab, 0x4b, 0xad, 0x2a, 0x5b, 0x0d, 0x2a, 0xd6, 0x89, 0x96, 0x55, 0x7b,
+    0xc7, 0xd0, 0x6e, 0xfc, 0x1a, 0xac, 0x6d, 0x3b, 0x3e, 0x6c, 0x62, 0x84, 0x2d, 0x12, 0xce, 0x96,
+    0x64, 0xcb, 0x15, 0xad, 0x5e, 0x9c, 0x8e, 0x3b, 0xb2, 0x77, 0xef, 0x87, 0x62, 0x25, 0x6c, 0x04,
+    0xcb, 0xa2, 0x5c, 0xc9, 0x2c, 0xe7, 0x48, 0x6c, 0xdd, 0xa5, 0xea, 0x60, 0x62, 0xb3, 0x79, 0xda,
+    0x0c, 0xc8, 0xb6, 0x80, 0xbf, 0x65, 0x85, 0x1e, 0xc8, 0x6b, 0x00, 0x43, 0x81, 0x10, 0x83, 0xa5,
+    0x55, 0x7b, 0x67, 0x04, 0x7b, 0xc2, 0x76, 0x1b, 0x74, 0x2b, 0x5e, 0xe0, 0xb2, 0x45, 0xc2, 0xeb,
+    0x97, 0x4b, 0x3a, 0xb5, 0x93, 0x2e, 0x4b, 0xb4, 0x26, 0x6f, 0x64, 0x17, 0x84, 0x3d, 0x18, 0xc4,
+    0x43, 0xb1, 0xf6, 0x18, 0x5e, 0x65, 0xa5, 0xe1, 0x1b, 0xd8, 0xe5, 0xad, 0x7a, 0x57, 0x56, 0x34,
+    0x41, 0xd5, 0xa7, 0xe9, 0x5d, 0xfd, 0x18, 0xd1, 0xad, 0x48, 0xdc, 0x01, 0x98, 0xc2, 0x48, 0x94,
+    0xc1, 0xd2, 0xaa, 0x7c, 0x1d, 0xc3, 0x7c, 0x1d, 0xde, 0xfe, 0x5e, 0xb2, 0xd1, 0x31, 0xa4, 0xd8,
+    0xeb, 0x33, 0x3d, 0x5b, 0x04, 0x63, 0x10, 0xaa, 0x41, 0x54, 0xc3, 0x0a, 0x7b, 0xc7, 0x7d, 0xe9,
+    0xd0, 0xd9, 0x35, 0xd1, 0xca, 0xd7, 0xbf, 0x93, 0x71, 0x76, 0x03, 0x5e, 0x3d, 0x2c, 0x81, 0x75,
+    0x40, 0xab, 0xec, 0xb3, 0x8c, 0x2c, 0xb8, 0x54, 0x59, 0x3c, 0x59, 0xe7, 0x52, 0xc3, 0x24, 0x5b,
+    0x13, 0x5e, 0x6a, 0x08, 0x27, 0xe8, 0xbc, 0xd7, 0x58, 0x47, 0xb4, 0x69, 0xb4, 0x0f, 0xb6, 0x86,
+    0xe8, 0xa2, 0x96, 0xe7, 0xc4, 0xb0, 0x7f, 0x16, 0x69, 0xb1, 0xab, 0x66, 0x2f, 0x9c, 0xf7, 0x51,
+    0x31, 0xc9, 0xd6, 0x14, 0x79, 0xd9, 0x6d, 0x6b, 0xd8, 0x23, 0xd5, 0xb3, 0xf5, 0x60, 0x0a, 0x41,
+    0xa3, 0x40, 0xab, 0xc5, 0x52, 0x59, 0x59, 0xb1, 0x71, 0xa9, 0x52, 0x27, 0x80, 0x93, 0xed, 0x53,
+    0x91, 0x92, 0x87, 0x84, 0x0c, 0xbb, 0xf3, 0x4f, 0xad, 0x58, 0xc0, 0x55, 0xef, 0xbd, 0x93, 0x1e,
+    0xac, 0xa4, 0x51, 0x85, 0xb7, 0xd0, 0x58, 0x49, 0x7f, 0x0d, 0xce, 0x39, 0xea, 0x78, 0x0b, 0xaa,
+    0xe6, 0xc5, 0xef, 0xa3, 0xf3, 0x97, 0x85, 0x68, 0xe5, 0xee, 0x72, 0x5e, 0x5f, 0x97, 0x54, 0xac,
+    0x62, 0x00, 0x14, 0x44, 0x0a, 0xe4, 0x57, 0x81, 0x28, 0xe8, 0x14, 0x5c, 0x38, 0xee, 0x77, 0x4f,
+    0x95, 0x8b, 0xd4, 0x9d, 0x87, 0x57, 0xdc, 0x1a, 0xca, 0xcc, 0x52, 0xec, 0x63, 0x55, 0xa3, 0xb0,
+    0x0a, 0xb6, 0x83, 0x45, 0x7b, 0xfa, 0x53, 0x2c, 0x73, 0xfa, 0x78, 0xed, 0x76, 0x2e, 0xbc, 0x9b,
+    0x21, 0x58, 0x35, 0xd1, 0x92, 0x9e, 0x56, 0x31, 0xf0, 0xea, 0x49, 0x9a, 0xf0, 0x42, 0x3e, 0x56,
+    0x89, 0x2d, 0xd1, 0xe0, 0xfa, 0x55, 0x80, 0x2d, 0xbc, 0x5c, 0x90, 0x05, 0x55, 0x2e, 0x4c, 0xf2,
+    0x63, 0x0e, 0xb0, 0x25, 0x83, 0x0e, 0x6e, 0x8c, 0xb4, 0xc5, 0x4c, 0x61, 0x81, 0x95, 0xcc, 0x55,
+    0xa4, 0xd4, 0x2c, 0xf2, 0xa0, 0x29, 0x6c, 0x63, 0x50, 0x94, 0xbd, 0x8d, 0xda, 0xbd, 0xd1, 0x54,
+    0x45, 0x4b, 0x06, 0x6c, 0x55, 0xb9, 0xd5, 0xf1, 0x9a, 0xd6, 0x0a, 0x8b, 0xad, 0x58, 0xd6, 0x97,
+    0xd5, 0x96, 0xab, 0xc8, 0x34, 0x10, 0xcc, 0x01, 0x2d, 0xaa, 0xee, 0x02, 0x27, 0xaa, 0x7d, 0x74,
+    0x45, 0x0b, 0x44, 0x1c, 0xf0, 0x92, 0x8e, 0x15, 0x6b, 0x70, 0xe5, 0x2a, 0x0b, 0x0f, 0x86, 0x6d,
+    0xa4, 0x96, 0x36, 0xf8, 0x93, 0x9d, 0x07, 0x21, 0x7f, 0x7f, 0x55, 0xb4, 0x7a, 0x9f, 0x6f, 0x92,
+    0xab, 0x62, 0x28, 0xd6, 0xeb, 0xef, 0xa7, 0x0c, 0xd2, 0x3d, 0xdc, 0xc5, 0x39, 0x52, 0x11, 0xb4,
+    0x86, 0x6b, 0xc3, 0x25, 0x23, 0x4c, 0x85, 0x91, 0x3a, 0xde, 0x01, 0x61, 0x58, 0xb4, 0x70, 0x98,
+    0xf4, 0x46, 0xb0, 0x8a, 0xbd, 0xc5, 0x7c, 0x92, 0x2b, 0x0c, 0x37, 0x85, 0xb3, 0xef, 0x65, 0x9a,
+    0x03, 0x19, 0xe1, 0x78, 0xe0, 0xc5, 0xf7, 0x4f, 0x45, 0xea, 0x1e, 0x83, 0x1e, 0xaf, 0x19, 0x23,
+    0xf9, 0xd1, 0xda, 0xa5, 0x63, 0xf5, 0x97, 0x2f, 0xf6, 0x8a, 0x84, 0xbb, 0x23, 0xde, 0x75, 0xd8,
+    0x7b, 0xbc, 0x2c, 0xa1, 0x9a, 0x60, 0xba, 0x13, 0xdf, 0x5b, 0xba, 0x65, 0xc5, 0xb4, 0xe2, 0xa6,
+    0x90, 0xb4, 0x9d, 0xa5, 0xae, 0x29, 0x94, 0xb1, 0x2b, 0x20, 0x57, 0x29, 0x90, 0xce, 0x8a, 0xf7,
+    0xfb, 0x37, 0xdb, 0x26, 0xe2, 0xc8, 0x96, 0x5c, 0xfc, 0x66, 0x31, 0xa5, 0x50, 0x4d, 0x61, 0xd1,
+    0x74, 0xab, 0x80, 0xec, 0x06, 0xd7, 0xa3, 0x8a, 0xc4, 0xab, 0x00, 0x55, 0x53, 0x7c, 0x21, 0x1b,
+    0x2b, 0x80, 0x9b, 0xcd, 0xd3, 0x9d, 0xcd, 0x59, 0xff, 0xaf, 0xd4, 0xc8, 0x56, 0x12, 0x52, 0x91,
+    0xa0, 0x0d, 0x8a, 0xcc, 0x0a, 0x41, 0xa3, 0xd0, 0x2a, 0xcc, 0x87, 0xf5, 0x0b, 0x70, 0x40, 0x32,
+    0xc9, 0x90, 0xcc, 0xac, 0xfd, 0x86, 0x96, 0x23, 0x3f, 0xe9, 0xae, 0x4c, 0x89, 0xae, 0xe3, 0x2c,
+    0x35, 0xc3, 0x86, 0xdf, 0xf3, 0x9f, 0x5a, 0x60, 0x05, 0x9b, 0xb9, 0xe1, 0xc6, 0x65, 0xae, 0x11,
+    0x54, 0x63, 0x57, 0x9b, 0xad, 0x58, 0x92, 0x2a, 0x40, 0x58, 0xc4, 0xcd, 0x7a, 0x33, 0x71, 0xac,
+    0xc9, 0xb5, 0xda, 0x85, 0x5c, 0x65, 0x98, 0x5e, 0xe1, 0xba, 0xea, 0xc0, 0x3a, 0xa7, 0x4e, 0xb4,
+    0x9a, 0xa7, 0x73, 0x75, 0xf4, 0xe2, 0x65, 0xf6, 0x58, 0x0a, 0x52, 0x25, 0x7d, 0x2c, 0xf7, 0xa8,
+    0x81, 0x22, 0x8e, 0x41, 0x23, 0x08, 0xdc, 0xf6, 0x4d, 0x93, 0xab, 0x1e, 0xaf, 0xf7, 0xd6, 0xc1,
+    0x0a, 0x46, 0x1c, 0x40, 0x82, 0x32, 0x36, 0x85, 0xf1, 0x8e, 0xa1, 0xae, 0x05, 0xc4, 0x9e, 0x7b,
+    0x33, 0x30, 0x02, 0x85, 0x1b, 0x58, 0xab, 0x0b, 0x87, 0xbd, 0x78, 0xe9, 0x69, 0x61, 0xd1, 0x2a,
+    0x71, 0xc5, 0x5a, 0xea, 0x3a, 0x19, 0xa9, 0xc5, 0x8b, 0xd3, 0x41, 0x5d, 0xb7, 0xfd, 0x0e, 0x52,
+    0x25, 0x09, 0xc3, 0x73, 0xc3, 0xb8, 0x25, 0x8a, 0xa7, 0xcd, 0xc4, 0x1b, 0x1c, 0xbb, 0x4b, 0x49,
+    0xc1, 0x6a, 0x6f, 0x91, 0xbd, 0xb2, 0x29, 0xe0, 0x6c, 0xb9, 0x36, 0x7d, 0x6a, 0xe8, 0xfa, 0x68,
+    0x60, 0x55, 0x2d, 0x91, 0xa8, 0x2e, 0x26, 0x85, 0x02, 0xcf, 0xdd, 0x5a, 0x0d, 0xb4, 0xd8, 0xc2,
+    0x84, 0x4d, 0xd3, 0xc3, 0x6c, 0x83, 0x65, 0x99, 0xc2, 0x73, 0xb3, 0x42, 0xd5, 0x14, 0xe6, 0x11,
+    0xac, 0xde, 0x17, 0xce, 0xe1, 0xdc, 0x68, 0xf7, 0xff, 0x75, 0x2b, 0x8e, 0xb0, 0x37, 0x3d, 0x94,
+    0xf1, 0x52, 0x55, 0xb4, 0xfa, 0xae, 0x3e, 0x18, 0xac, 0x54, 0xed, 0xfe, 0x9c, 0xd8, 0x55, 0xaf,
+    0xb0, 0x23, 0x52, 0xdc, 0x08, 0x4e, 0x12, 0x22, 0xa9, 0x52, 0xbd, 0xab, 0xf7, 0x6c, 0xbc, 0xdc,
+    0x89, 0xa1, 0xeb, 0xb9, 0xdf, 0x9e, 0x8f, 0xd5, 0x97, 0xf9, 0x9f, 0x2c, 0x60, 0x11, 0x19, 0xc0,
+    0xd8, 0x67, 0x57, 0xd5, 0x85, 0xe0, 0x76, 0xfe, 0x6c, 0x18, 0x44, 0xf6, 0xca, 0x30, 0xd5, 0xb1,
+    0x8a, 0x6e, 0x85, 0x85, 0x8f, 0x41, 0xa0, 0xae, 0x1e, 0x8a, 0x05, 0xd6, 0x4d, 0x6b, 0xec, 0x88,
+    0x94, 0x85, 0x61, 0x23, 0x83, 0x2f, 0xd9, 0x76, 0xf0, 0xce, 0x56, 0x2c, 0x15, 0x2f, 0x39, 0x37,
+    0xb4, 0x9c, 0x77, 0xa0, 0x19, 0x09, 0x6e, 0x86, 0x6e, 0xde, 0xaa, 0x8e, 0x2a, 0x5a, 0x45, 0x64,
+    0x5c, 0x81, 0xa9, 0xe8, 0xd2, 0xe6, 0x58, 0x75, 0x02, 0x31, 0xd5, 0xbd, 0x4d, 0xa2, 0x4d, 0x06,
+    0x19, 0xdb, 0x7b, 0x54, 0x4f, 0x0b, 0x43, 0xa6, 0x64, 0x60, 0x4b, 0x53, 0x58, 0x61, 0x64, 0xa1,
+    0xd8, 0x79, 0xa1, 0x35, 0xec, 0x5d, 0x31, 0x0c, 0xb5, 0x03, 0x1f, 0x4b, 0x15, 0xad, 0xf7, 0x02,
+    0x6e, 0x96, 0x3b, 0x25, 0xe4, 0x95, 0x58, 0x43, 0xc4, 0x3b, 0x91, 0x35, 0x1a, 0x64, 0x2e, 0x4a,
+    0x32, 0x32, 0xae, 0x48, 0x4b, 0x13, 0x75, 0xf7, 0x5b, 0xab, 0x41, 0xc4, 0x24, 0xce, 0x81, 0x17,
+    0x8f, 0x45, 0x4b, 0xf5, 0xdf, 0x4d, 0x5a, 0xfa, 0x6a, 0x33, 0x4b, 0x31, 0x05, 0x35, 0x2b, 0xc6,
+    0x95, 0xab, 0x04, 0x83, 0xa2, 0x56, 0x26, 0x8c, 0x1b, 0x68, 0xe8, 0x39, 0x03, 0x8a, 0x35, 0x05,
+    0xb1, 0x22, 0x11, 0xac, 0xd3, 0xdb, 0xbf, 0xaa, 0x00, 0x2b, 0x8f, 0x72, 0xb5, 0x7b, 0xd5, 0x22,
+    0x22, 0xb6, 0xef, 0xb8, 0x05, 0x9b, 0xf6, 0x65, 0x12, 0xa5, 0x4a, 0xfb, 0x2d, 0xfc, 0x11, 0xd1,
+    0x4a, 0xb1, 0x7d, 0xb6, 0xaa, 0x29, 0x4c, 0x96, 0xbd, 0x2b, 0xd0, 0x61, 0x77, 0xdb, 0x4c, 0x46,
+    0x36, 0xaf, 0xe1, 0xa0, 0xa8, 0xeb, 0xbc, 0x5b, 0x9e, 0xd6, 0x66, 0x83, 0x95, 0xb5, 0x55, 0x94,
+    0xd9, 0xc5, 0xf9, 0x9e, 0x7f, 0xf0, 0x82, 0x16, 0x5f, 0x5f, 0xfd, 0xc1, 0x7b, 0x38, 0x3d, 0x4c,
+    0x22, 0x9c, 0xed, 0x52, 0x45, 0xb0, 0xee, 0x88, 0x5a, 0xa6, 0x75, 0x72, 0xef, 0xd4, 0x00, 0x15,
+    0x8f, 0xb5, 0xda, 0xd4, 0x1d, 0xfa, 0x6d, 0xac, 0xb5, 0x64, 0x59, 0x76, 0xa0, 0x3e, 0x05, 0x54,
+    0x4d, 0x76, 0xd7, 0x01, 0x97, 0x2a, 0xa4, 0xe1, 0xcd, 0xb5, 0xd6, 0x94, 0xf0, 0x2e, 0x06, 0x99,
+    0xea, 0xbf, 0x03, 0xb0, 0xf4, 0xf0, 0xd5, 0xf7, 0x7e, 0xf7, 0xfb, 0x74, 0xf6, 0xf5, 0xe1, 0x95,
+    0xc5, 0xaf, 0xfd, 0xd0, 0xc7, 0x76, 0xc1, 0x8f, 0xb4, 0x9e, 0xb6, 0x80, 0xc3, 0xfa, 0xfd, 0xf7,
+    0xb2, 0x5f, 0xe1, 0xd4, 0xd7, 0x29, 0x32, 0x43, 0x04, 0xea, 0x1b, 0x4f, 0x0a, 0xaa, 0x17, 0xe7,
+    0xbd, 0x2e, 0x3a, 0xe9, 0x6e, 0xa3, 0xe5, 0x48, 0x89, 0x98, 0x78, 0xa0, 0xe1, 0x6e, 0xfd, 0xb0,
+    0xf2, 0x67, 0xf4, 0xf0, 0xd5, 0xbf, 0xf8, 0xf2, 0x0b, 0x7a, 0xbc, 0xd7, 0x67, 0xaf, 0x74, 0xfe,
+    0xc4, 0x0f, 0xdf, 0x6b, 0x8a, 0x15, 0xcf, 0x5c, 0x08, 0x16, 0x9e, 0x94, 0x5d, 0x0b, 0x27, 0x14,
+    0xfa, 0xae, 0x3b, 0xae, 0x68, 0x71, 0xec, 0x3f, 0xf2, 0x9d, 0xfa, 0xa3, 0xb8, 0x6d, 0xa4, 0x4c,
+    0x05, 0xf6, 0x13, 0x83, 0x7b, 0x9a, 0x53, 0x8c, 0xad, 0x1c, 0x0b, 0x65, 0x6d, 0xf6, 0xea, 0xa1,
+    0xe5, 0xb9, 0xbf, 0x96, 0xab, 0xef, 0xfb, 0xae, 0xc7, 0x44, 0x6a, 0x7a, 0xfd, 0xad, 0x2f, 0xbf,
+    0x20, 0xa2, 0x9f, 0xfc, 0x37, 0xf7, 0xa3, 0x68, 0x95, 0x98, 0x27, 0xd7, 0xc2, 0x37, 0xb8, 0x8c,
+    0x7d, 0x56, 0xb3, 0x21, 0x5a, 0x7d, 0xd1, 0x07, 0x20, 0x5a, 0x72, 0x9d, 0x2a, 0xd9, 0x00, 0x54,
+    0xe0, 0x88, 0x1f, 0x71, 0xac, 0x48, 0xbc, 0x0a, 0xb7, 0x74, 0x0b, 0xd6, 0x20, 0x74, 0x23, 0x58,
+    0x39, 0x96, 0xd3, 0x37, 0xa1, 0x06, 0xb2, 0xb2, 0x94, 0xb8, 0xe8, 0xbf, 0xfe, 0xd2, 0x07, 0xf4,
+    0x46, 0x5e, 0x7f, 0xe3, 0xbb, 0x5e, 0x10, 0xd1, 0x4f, 0xfd, 0xc8, 0x4b, 0x91, 0x57, 0x4e, 0xe1,
+    0x48, 0x55, 0xbc, 0x4c, 0x4d, 0xdf, 0x7b, 0xbc, 0x6f, 0x20, 0x2d, 0x45, 0x8b, 0x0c, 0xd1, 0x52,
+    0xed, 0x6f, 0x8a, 0x55, 0xa3, 0x50, 0x4c, 0x61, 0x5d, 0x37, 0x85, 0x35, 0xd6, 0xfd, 0x47, 0x26,
+    0xf4, 0xb1, 0xbd, 0x59, 0x1b, 0xcc, 0x0d, 0xef, 0x3c, 0xd1, 0x52, 0x73, 0xb3, 0xb2, 0x66, 0x07,
+    0xd3, 0xf7, 0x7f, 0xf1, 0x05, 0xbd, 0xd9, 0xd7, 0x5f, 0xff, 0xd2, 0x07, 0x3f, 0xfd, 0x95, 0x7b,
+    0xb1, 0xa1, 0x39, 0x82, 0x97, 0x2b, 0x57, 0x9b, 0xd6, 0x28, 0xfa, 0x38, 0x4f, 0xdd, 0xc9, 0x24,
+    0x5a, 0xa0, 0x0b, 0x0b, 0x1b, 0x6c, 0xc5, 0x4d, 0x61, 0x4d, 0xc4, 0x35, 0x70, 0xb4, 0xeb, 0xbb,
+    0x7a, 0xd0, 0xf5, 0xbd, 0x3f, 0x98, 0x98, 0xbb, 0x93, 0xe3, 0x48, 0xe3, 0x91, 0xc7, 0x63, 0x23,
+    0xde, 0xc6, 0x73, 0xf7, 0xb8, 0x0b, 0x7c, 0x79, 0xfc, 0xc0, 0xfc, 0x03, 0x6f, 0x9c, 0xaa, 0xcb,
+    0xeb, 0xaf, 0x7d, 0xf1, 0xc5, 0xf1, 0x3b, 0x88, 0xab, 0xbb, 0x0b, 0x5f, 0x97, 0x7a, 0xc8, 0xa1,
+    0x3b, 0x8e, 0x69, 0xb4, 0xa7, 0x7b, 0xd1, 0xdf, 0xa6, 0xfe, 0x38, 0xee, 0xa9, 0x7a, 0x1c, 0x3c,
+    0xa0, 0xa3, 0x37, 0x85, 0xf5, 0x94, 0x05, 0x8c, 0xaf, 0x0c, 0xe2, 0x0a, 0x13, 0x78, 0xf3, 0x20,
+    0x9e, 0x24, 0xe2, 0xb4, 0xbe, 0x07, 0xb9, 0xfa, 0xa1, 0x2f, 0x7c, 0x40, 0x9f, 0xea, 0xeb, 0xaf,
+    0x7e, 0xe7, 0xfb, 0x44, 0xf4, 0x33, 0x3f, 0xfa, 0xd2, 0x4e, 0x58, 0x88, 0xfb, 0xcb, 0xe5, 0x2a,
+    0x57, 0xc7, 0xfb, 0x34, 0x80, 0x65, 0x94, 0xab, 0xde, 0xd9, 0xe2, 0xf0, 0xea, 0xe1, 0x6a, 0xd1,
+    0xaf, 0xd7, 0x47, 0x0a, 0xcb, 0x55, 0x1d, 0x69, 0x9d, 0xb4, 0xaa, 0xd9, 0xa2, 0xc5, 0xd7, 0x67,
+    0x25, 0xc5, 0x44, 0xeb, 0x78, 0xac, 0xa7, 0x87, 0xf2, 0xc4, 0x03, 0xfd, 0x5a, 0x21, 0x7e, 0xf8,
+    0xd3, 0xa6, 0xea, 0x78, 0x7d, 0xe6, 0x0b, 0x1f, 0xd8, 0x97, 0x19, 0x94, 0xe4, 0x6c, 0x5d, 0x66,
+    0x40, 0xae, 0xa6, 0x7b, 0xa1, 0xca, 0x95, 0xbc, 0xb3, 0x55, 0x68, 0x95, 0x23, 0x5a, 0x29, 0x60,
+    0xf8, 0xaa, 0x38, 0x09, 0xda, 0x41, 0xd6, 0xd8, 0x4a, 0x23, 0x5b, 0xfd, 0x10, 0x4c, 0xc3, 0x9d,
+    0x21, 0x5e, 0x19, 0xda, 0x85, 0xfe, 0x47, 0xe5, 0x7f, 0xfb, 0xf9, 0x17, 0xf4, 0x36, 0xbd, 0xfe,
+    0xca, 0xe7, 0x5f, 0x4c, 0xbf, 0x21, 0xb4, 0xfe, 0x19, 0x22, 0x25, 0x47, 0x4c, 0x0e, 0xac, 0x1c,
+    0x7c, 0xd6, 0xcc, 0x62, 0xc4, 0x1a, 0xaa, 0x30, 0x28, 0x9c, 0x25, 0x43, 0x96, 0xe2, 0x0e, 0x56,
+    0xf3, 0xca, 0xec, 0xaa, 0x6c, 0x1d, 0x17, 0x6f, 0x89, 0x56, 0xdc, 0xdf, 0xca, 0xf6, 0x79, 0x26,
+    0xce, 0x3f, 0xf2, 0xb9, 0xb7, 0x8b, 0xaa, 0xcb, 0xeb, 0x2f, 0x7f, 0xee, 0x85, 0xc6, 0x53, 0xe4,
+    0xc9, 0x71, 0xfd, 0xaa, 0x09, 0xaf, 0x24, 0xf0, 0xb2, 0x60, 0x52, 0xa5, 0x2b, 0xee, 0x66, 0x0d,
+    0x08, 0xf5, 0x3e, 0x56, 0xb3, 0x0b, 0x91, 0xe3, 0x90, 0x55, 0x8b, 0x95, 0x0f, 0x75, 0x57, 0xa0,
+    0xc1, 0x46, 0x1d, 0x2b, 0x7c, 0x8a, 0x2b, 0xcc, 0xa4, 0xaf, 0x7c, 0xf8, 0x36, 0x52, 0x75, 0x79,
+    0xfd, 0xa5, 0xbf, 0xf7, 0xe2, 0x67, 0xbf, 0xfa, 0xf2, 0x9a, 0xa8, 0x2e, 0x5d, 0xab, 0x4d, 0xc4,
+    0x3c, 0x7b, 0x77, 0x6a, 0xeb, 0xb2, 0x71, 0xc0, 0x18, 0x16, 0xb1, 0x6c, 0xa5, 0x2e, 0xef, 0x58,
+    0x73, 0x43, 0x82, 0x1b, 0xbe, 0x9b, 0xdd, 0xab, 0xbb, 0x26, 0x4f, 0xa2, 0xaa, 0x2d, 0x51, 0xcd,
+    0x73, 0xad, 0xd8, 0x9b, 0x12, 0x62, 0x4f, 0x4b, 0x31, 0x6a, 0x96, 0xb1, 0xd3, 0x9e, 0xd7, 0xfc,
+    0xef, 0x3e, 0xfc, 0x80, 0xde, 0xee, 0xd7, 0x5f, 0xfc, 0xf0, 0x83, 0xe3, 0xb7, 0x85, 0x57, 0x8d,
+    0x07, 0xc1, 0xf5, 0xae, 0xc0, 0xc4, 0x90, 0x3d, 0x67, 0xab, 0xd9, 0x02, 0x56, 0x81, 0x80, 0x5d,
+    0xe2, 0x58, 0xcd, 0x6b, 0x52, 0xdd, 0x62, 0xc9, 0xc7, 0x38, 0x07, 0x0b, 0xd7, 0x7d, 0x74, 0xeb,
+    0xf4, 0x6d, 0x86, 0x8c, 0x81, 0xbc, 0xd0, 0xe7, 0xf0, 0xe2, 0x23, 0x71, 0x2a, 0x77, 0xa1, 0xf3,
+    0x26, 0x62, 0x9e, 0x7d, 0x84, 0xbd, 0x84, 0x2b, 0xcb, 0x59, 0xd5, 0x56, 0x6b, 0x2c, 0x07, 0xfa,
+    0x5c, 0x1b, 0xb3, 0x46, 0xd4, 0x36, 0x4a, 0x6d, 0x71, 0x99, 0xb9, 0xd9, 0xad, 0x3b, 0xdd, 0x8c,
+    0x06, 0xb6, 0x0b, 0x40, 0x66, 0x98, 0x9e, 0xa5, 0x5a, 0x3a, 0xb4, 0x3f, 0xe2, 0x47, 0x3f, 0xfb,
+    0xfe, 0xb3, 0xe0, 0xea, 0x2f, 0x7c, 0xc7, 0xfb, 0x5f, 0xff, 0xda, 0x7d, 0xc7, 0xd6, 0x71, 0x93,
+    0x72, 0x67, 0x0a, 0xb3, 0x47, 0x55, 0xf6, 0xaa, 0x44, 0xbb, 0x77, 0x04, 0x58, 0xc3, 0xc8, 0xfa,
+    0x52, 0x53, 0xc3, 0x0d, 0x96, 0xc4, 0xb5, 0xd1, 0x23, 0x73, 0x27, 0x83, 0x53, 0xc0, 0x4d, 0x06,
+    0x48, 0x93, 0x36, 0x31, 0x0c, 0x5a, 0x43, 0xdd, 0xde, 0x75, 0x27, 0xaf, 0x3f, 0xfe, 0xd8, 0x67,
+    0x5f, 0xd0, 0xf3, 0x79, 0x7d, 0xcb, 0x67, 0x5f, 0x80, 0x6b, 0x39, 0x35, 0x2c, 0x49, 0xf3, 0xd9,
+    0xa5, 0x29, 0xa4, 0xf1, 0x66, 0xb1, 0xe1, 0xc2, 0x93, 0x46, 0x48, 0x85, 0xcc, 0xb4, 0x34, 0xfe,
+    0xd5, 0x0a, 0x63, 0xeb, 0x93, 0xc5, 0x25, 0x7b, 0x4a, 0xc8, 0x06, 0x55, 0xae, 0xa7, 0x85, 0x21,
+    0x53, 0xc3, 0x13, 0xf3, 0x98, 0xfe, 0xfb, 0x6f, 0xff, 0x80, 0x9e, 0xdb, 0xeb, 0xcf, 0x7f, 0xfb,
+    0x07, 0xf8, 0xa2, 0x3c, 0xce, 0x22, 0x43, 0xca, 0x5a, 0xac, 0x81, 0xe0, 0x0c, 0x71, 0xba, 0xcb,
+    0x2a, 0x0f, 0x12, 0xb8, 0x4a, 0xdc, 0x36, 0xe2, 0x06, 0x33, 0x8c, 0xeb, 0x29, 0xd7, 0x8a, 0x44,
+    0x0d, 0xa7, 0x60, 0x5f, 0x09, 0x99, 0x85, 0x87, 0xe7, 0x8c, 0xaa, 0x27, 0xf1, 0x3c, 0x5f, 0xec,
+    0x66, 0xaa, 0xa9, 0x45, 0xa0, 0xd5, 0x71, 0x8b, 0xd4, 0xb2, 0xa7, 0x53, 0x5b, 0xcd, 0x5a, 0x0c,
+    0x95, 0x87, 0x70, 0x43, 0xf3, 0x52, 0xac, 0x64, 0xc6, 0x55, 0x5b, 0xe9, 0x53, 0xc2, 0x81, 0x3e,
+    0x2d, 0x12, 0x14, 0x75, 0xec, 0xac, 0xba, 0xdc, 0x0f, 0xc7, 0x8f, 0xff, 0xcd, 0x17, 0xcf, 0x94,
+    0xab, 0x3f, 0xf7, 0xb7, 0x5f, 0xfc, 0xdc, 0x7f, 0xfa, 0x68, 0xbc, 0xde, 0x3e, 0xd3, 0xdc, 0x1d,
+    0x13, 0xeb, 0x9b, 0x78, 0x0b, 0xe3, 0x66, 0x67, 0x2a, 0x53, 0xa0, 0x7d, 0xfa, 0xe4, 0xbc, 0x73,
+    0x64, 0xde, 0xd7, 0xbc, 0x9d, 0xdd, 0x72, 0x0b, 0x00, 0xee, 0xcd, 0x9c, 0x62, 0x65, 0xc4, 0xd5,
+    0x73, 0x3c, 0xf1, 0x79, 0xce, 0x2f, 0x53, 0xb4, 0x8a, 0x86, 0x54, 0x0a, 0x77, 0x0a, 0x4a, 0x76,
+    0x5b, 0x2f, 0x6b, 0x9f, 0x37, 0x8d, 0xbb, 0xa8, 0x2d, 0x0c, 0xcc, 0x23, 0xc1, 0x00, 0xeb, 0x52,
+    0x3a, 0x03, 0x09, 0x9b, 0x6d, 0x65, 0x37, 0xb0, 0xe1, 0x4e, 0x5a, 0xce, 0x56, 0x0a, 0x7a, 0x12,
+    0x5f, 0xfd, 0xb6, 0x17, 0xcf, 0x9a, 0xab, 0x3f, 0xfb, 0x6d, 0x2f, 0xc2, 0xde, 0x67, 0xb2, 0x07,
+    0x84, 0x8d, 0x11, 0xb6, 0xb2, 0x1b, 0x48, 0xf3, 0xe5, 0xe3, 0xc9, 0x0e, 0xfa, 0x11, 0x51, 0x2c,
+    0x99, 0x6e, 0x85, 0x37, 0xe4, 0xa8, 0x06, 0x91, 0xec, 0xce, 0xd5, 0xe9, 0x54, 0xcf, 0x41, 0x75,
+    0x1f, 0xc4, 0xf3, 0x7f, 0x31, 0x87, 0xfb, 0xd8, 0xb8, 0xcd, 0x4e, 0xad, 0x01, 0xa7, 0x95, 0x6a,
+    0xb9, 0x4d, 0x54, 0xac, 0x08, 0xe5, 0x4c, 0x5f, 0xe2, 0x58, 0x11, 0x07, 0x8b, 0x02, 0x30, 0x45,
+    0xd2, 0x66, 0xf0, 0xc6, 0x0a, 0xbe, 0x61, 0x1c, 0xd3, 0xbb, 0x00, 0x56, 0x7a, 0xc4, 0xd1, 0xc0,
+    0x46, 0xf0, 0xc4, 0xa3, 0xa8, 0x76, 0xa7, 0x8a, 0x9a, 0x42, 0xf2, 0x56, 0x6f, 0x5a, 0x6c, 0xc9,
+    0x99, 0x45, 0x8c, 0x84, 0xb5, 0x35, 0x69, 0x19, 0xe5, 0x92, 0xa9, 0x10, 0x6e, 0x8a, 0x04, 0x13,
+    0xf3, 0x7f, 0xf8, 0xd6, 0xf7, 0xdf, 0x01, 0xae, 0xfe, 0xcc, 0xb7, 0xbe, 0x6f, 0xc7, 0xfc, 0x58,
+    0x1b, 0x10, 0x3c, 0x62, 0x72, 0xd5, 0xd9, 0xba, 0x35, 0xee, 0xb2, 0x74, 0xf3, 0xd6, 0x79, 0x68,
+    0x32, 0x85, 0x64, 0x6f, 0xb3, 0xb1, 0x82, 0x0b, 0x2d, 0x66, 0x0d, 0x69, 0xa5, 0x31, 0xba, 0xd5,
+    0x51, 0xd7, 0x2d, 0xaf, 0xc0, 0xef, 0x8e, 0x1d, 0x1c, 0xac, 0x21, 0x9e, 0x44, 0x27, 0x63, 0xac,
+    0x82, 0x13, 0x40, 0x0a, 0x2f, 0xe9, 0x30, 0x64, 0xc0, 0x2c, 0x5c, 0x73, 0x31, 0x85, 0x56, 0xb8,
+    0xc2, 0x4a, 0x71, 0x8c, 0x4f, 0x09, 0x57, 0x03, 0x10, 0x6c, 0x74, 0x99, 0x07, 0x1e, 0xc3, 0x3b,
+    0x07, 0x56, 0x02, 0x7d, 0x65, 0xd9, 0xe8, 0x27, 0xe5, 0x9a, 0x3c, 0x5c, 0x42, 0x27, 0x38, 0x31,
+    0x54, 0x37, 0x37, 0xe8, 0xcc, 0x00, 0x53, 0x68, 0x45, 0xdb, 0x81, 0x11, 0x04, 0x33, 0x44, 0x90,
+    0xf8, 0xa0, 0x26, 0x37, 0x26, 0xf8, 0xa7, 0x93, 0x21, 0xe0, 0xff, 0xf8, 0x99, 0x17, 0xef, 0x0c,
+    0x57, 0x7f, 0xfa, 0x33, 0x2f, 0xe4, 0x05, 0x86, 0x47, 0x06, 0xcc, 0x01, 0xd5, 0x7b, 0x61, 0xdd,
+    0x38, 0x6c, 0x10, 0xc9, 0x03, 0xe6, 0xc1, 0x14, 0x92, 0x1d, 0xb2, 0x5a, 0xd6, 0x71, 0xad, 0x3c,
+    0x0b, 0x7b, 0x53, 0x92, 0xa0, 0x92, 0xb9, 0xcf, 0xdf, 0x93, 0xbc, 0xbe, 0xf9, 0x5b, 0xfe, 0x9f,
+    0xfc, 0xf2, 0x1b, 0x5f, 0xff, 0xa6, 0x37, 0x68, 0x0d, 0x4f, 0x8c, 0x8f, 0x3b, 0xce, 0xea, 0x3d,
+    0x3a, 0x71, 0xd3, 0xd5, 0xe0, 0x16, 0x1d, 0xe1, 0x06, 0x15, 0x26, 0xa0, 0x7e, 0xa7, 0x39, 0xb3,
+    0xda, 0xa6, 0x9f, 0x3b, 0xe8, 0x49, 0xc1, 0x52, 0x91, 0xea, 0xff, 0xe8, 0xa9, 0xf0, 0x62, 0x7e,
+    0xec, 0x21, 0xb2, 0xfc, 0x93, 0x55, 0x7a, 0x08, 0x6e, 0xf8, 0x7b, 0x0d, 0xd2, 0x26, 0x26, 0xe9,
+    0xcd, 0x0e, 0x31, 0xc4, 0xe3, 0x0e, 0xac, 0x75, 0x2d, 0x23, 0xf8, 0xf4, 0xa8, 0xc0, 0x51, 0x8c,
+    0x2a, 0x7e, 0xc3, 0x54, 0xf5, 0x7f, 0xe7, 0x49, 0xd8, 0x4a, 0xe7, 0x46, 0xc0, 0x7a, 0x68, 0x09,
+    0x3e, 0x8a, 0xc1, 0x50, 0x16, 0x41, 0x2a, 0x66, 0xc8, 0xe4, 0xac, 0x70, 0x09, 0xde, 0xa0, 0x68,
+    0xe1, 0x2f, 0xd9, 0x6e, 0x3f, 0x04, 0x1a, 0x12, 0xbd, 0x73, 0x3e, 0xbb, 0x32, 0x3c, 0x56, 0xd1,
+    0x2c, 0x77, 0x88, 0x40, 0xa9, 0x2d, 0xfc, 0xe5, 0xed, 0xf7, 0x7d, 0x88, 0x63, 0x51, 0xcc, 0x3d,
+    0x5f, 0x3d, 0x2c, 0xaf, 0xd0, 0x0a, 0xa8, 0x90, 0xbd, 0xd4, 0x60, 0xfd, 0xab, 0xeb, 0x37, 0x9f,
+    0x86, 0x5c, 0xad, 0xfe, 0xcd, 0x35, 0x53, 0xa8, 0x4f, 0x7a, 0xd4, 0x0c, 0x2a, 0x6b, 0x59, 0xc6,
+    0xfa, 0x57, 0x71, 0x57, 0x7d, 0xf5, 0x78, 0xcd, 0xcf, 0xa6, 0x81, 0x8b, 0xb3, 0x43, 0x4f, 0x3c,
+    0x7a, 0xae, 0x3f, 0xc4, 0x30, 0x5a, 0x61, 0x3d, 0x64, 0xef, 0xa8, 0x5c, 0x0d, 0x57, 0xe6, 0x5e,
+    0x72, 0x70, 0xe8, 0x5c, 0x0b, 0x70, 0xe2, 0x85, 0x5c, 0xa3, 0xcd, 0x58, 0x08, 0x69, 0xb7, 0x99,
+    0xbf, 0x25, 0xfb, 0xc8, 0xde, 0xc0, 0x71, 0x60, 0x40, 0xdf, 0xad, 0x57, 0x72, 0x1f, 0x30, 0xf6,
+    0x1e, 0x3c, 0x7e, 0xca, 0x27, 0xd0, 0xc7, 0x63, 0x7b, 0x3e, 0xb7, 0x86, 0xdf, 0x7d, 0xa1, 0x42,
+    0x24, 0x3c, 0xb3, 0xcb, 0x7f, 0x46, 0x60, 0xdd, 0x18, 0x60, 0x7b, 0xee, 0x60, 0x3d, 0xb3, 0xcb,
+    0xb7, 0x4c, 0xe1, 0x53, 0x7b, 0x33, 0x2d, 0x70, 0x3e, 0xcd, 0x66, 0xd5, 0x9f, 0xf0, 0x8e, 0x42,
+    0x96, 0xf0, 0x35, 0xe2, 0x31, 0x89, 0x8c, 0xea, 0xe3, 0x82, 0xcf, 0x41, 0xc5, 0x3a, 0x17, 0x43,
+    0x03, 0x00, 0xe1, 0x1a, 0x5a, 0xe4, 0xe5, 0xa9, 0xbe, 0x31, 0xcf, 0xef, 0x2d, 0x54, 0x2c, 0xf7,
+    0x92, 0x83, 0x43, 0xa7, 0xde, 0x85, 0xdb, 0x67, 0x66, 0xa6, 0x81, 0x4e, 0x62, 0x5a, 0xfb, 0x24,
+    0x93, 0x4f, 0xb1, 0xcc, 0x04, 0xb6, 0xfd, 0x58, 0x45, 0x6c, 0x9a, 0xb1, 0xfd, 0xba, 0x11, 0x3f,
+    0x3e, 0x61, 0xf1, 0xb0, 0xe7, 0x93, 0x04, 0x48, 0xd5, 0x6b, 0xd4, 0xf7, 0xcc, 0x58, 0x43, 0x07,
+    0xfe, 0x15, 0xbd, 0x81, 0x00, 0xd3, 0x45, 0xb1, 0x96, 0x82, 0x8d, 0x8f, 0x12, 0x58, 0xb3, 0x96,
+    0x08, 0xac, 0x07, 0x2b, 0x9e, 0xd2, 0xf3, 0x2e, 0x29, 0x16, 0x4e, 0x4d, 0x01, 0x43, 0x14, 0x59,
+    0x82, 0x7b, 0x94, 0x40, 0xb7, 0x25, 0x63, 0x2c, 0x7d, 0x2c, 0x77, 0x9d, 0xf2, 0x38, 0x6f, 0xb1,
+    0x08, 0x07, 0x19, 0xf9, 0xa8, 0xd6, 0xe6, 0x1f, 0x0a, 0xf7, 0xb5, 0x7a, 0x5a, 0xbc, 0xbe, 0xf1,
+    0xf5, 0x6f, 0x72, 0x83, 0x9f, 0x4f, 0xb5, 0x56, 0x98, 0xce, 0x8d, 0x40, 0x64, 0x3b, 0x0d, 0xc5,
+    0x6a, 0xba, 0xb8, 0xae, 0x11, 0xdb, 0xc0, 0x3c, 0xf8, 0x58, 0xc0, 0x52, 0x82, 0xd5, 0xa5, 0xa5,
+    0x00, 0x3f, 0x69, 0x97, 0x4d, 0xeb, 0x5d, 0xac, 0xdc, 0x64, 0xfc, 0x27, 0x31, 0x88, 0x9f, 0x46,
+    0x76, 0x43, 0x7b, 0xec, 0x21, 0x52, 0xbd, 0xb1, 0x76, 0x4a, 0xae, 0x40, 0xb8, 0xfb, 0x35, 0x48,
+    0xdb, 0xb8, 0x2c, 0x75, 0x7b, 0xbc, 0x24, 0xb2, 0x4e, 0xd9, 0xc2, 0xdb, 0xd3, 0xea, 0x23, 0xd5,
+    0x26, 0x79, 0x43, 0xfe, 0xd6, 0x63, 0x83, 0xb5, 0x5c, 0x8a, 0x63, 0x65, 0x9c, 0xe9, 0x06, 0xce,
+    0x40, 0x80, 0xed, 0x01, 0x24, 0x5c, 0xf0, 0x54, 0x5d, 0xce, 0x5b, 0x72, 0xd5, 0x2d, 0x27, 0x14,
+    0x57, 0xc3, 0x51, 0xeb, 0x28, 0xa9, 0xa5, 0x06, 0x1f, 0x3e, 0x7e, 0xc7, 0x47, 0xf7, 0xef, 0x8c,
+    0x7f, 0xf5, 0xbf, 0x3f, 0xba, 0x37, 0x4a, 0x24, 0x44, 0x46, 0x06, 0xd7, 0x9f, 0x6a, 0x76, 0x49,
+    0x48, 0x5a, 0x4c, 0xe7, 0xc4, 0xc0, 0xf0, 0x46, 0x89, 0x0d, 0x07, 0xcb, 0x55, 0xbf, 0xa5, 0xfd,
+    0x8d, 0x4b, 0x4f, 0x5e, 0xd5, 0x5a, 0x5b, 0x35, 0xe3, 0xe3, 0x3b, 0xe7, 0xc5, 0x27, 0xd0, 0x51,
+    0xac, 0x69, 0x55, 0xce, 0xe2, 0x85, 0x11, 0x2c, 0xc5, 0x0a, 0xa6, 0x9b, 0x83, 0xac, 0x9b, 0x99,
+    0x19, 0x39, 0x2b, 0x8c, 0xa4, 0xa6, 0xb0, 0x5d, 0x28, 0x1c, 0xc7, 0x4e, 0x22, 0xbd, 0xf6, 0xdc,
+    0xea, 0xbc, 0x2d, 0xdc, 0x14, 0xe3, 0x99, 0x4e, 0x09, 0xdd, 0xde, 0x71, 0xd5, 0x6e, 0xd2, 0x14,
+    0xa7, 0x2a, 0x58, 0xde, 0x8c, 0x20, 0x03, 0x56, 0x4a, 0x0f, 0xaa, 0xfd, 0xcd, 0x5e, 0x02, 0x46,
+    0xa4, 0x70, 0x25, 0xa8, 0x52, 0x52, 0xed, 0xe2, 0x38, 0x15, 0xd6, 0xca, 0x91, 0xb5, 0x52, 0x1b,
+    0x71, 0xfb, 0x3b, 0x3f, 0xff, 0xf1, 0x3b, 0x00, 0xd5, 0xff, 0xfa, 0xf9, 0x8f, 0xb5, 0xfa, 0x3f,
+    0x56, 0x31, 0x58, 0x77, 0xc4, 0xa6, 0x7f, 0xe2, 0xd6, 0xe9, 0x73, 0x8d, 0x20, 0xd8, 0x3d, 0xa6,
+    0x98, 0xc2, 0x78, 0x8a, 0xe6, 0x89, 0x20, 0x16, 0x36, 0x79, 0xa0, 0xe6, 0x5b, 0xbc, 0xfa, 0xfc,
+    0x71, 0xbc, 0x03, 0x76, 0xf0, 0x11, 0x47, 0xa3, 0x06, 0x4c, 0xe4, 0x69, 0x3f, 0xdd, 0x49, 0x70,
+    0xdd, 0x62, 0x79, 0xfb, 0x64, 0x64, 0xaf, 0xb7, 0x30, 0x52, 0xe4, 0x79, 0x0c, 0x27, 0xc6, 0x31,
+    0xde, 0xe1, 0xfc, 0xd9, 0xd9, 0xc1, 0x1b, 0x47, 0x03, 0x7b, 0xa5, 0xb4, 0x82, 0x17, 0x43, 0x4f,
+    0xcb, 0x3c, 0x70, 0xb5, 0x53, 0x50, 0x05, 0xd5, 0xad, 0x1e, 0x01, 0x8a, 0xc1, 0x59, 0xa5, 0xde,
+    0xd4, 0x52, 0xf4, 0xe5, 0xfa, 0x5e, 0xdc, 0x5e, 0x07, 0x1f, 0xfe, 0xc2, 0xf3, 0x9e, 0x1b, 0xfe,
+    0xdc, 0x2f, 0xdc, 0x07, 0xfa, 0x39, 0x94, 0x6e, 0x4c, 0xac, 0x86, 0x0f, 0xea, 0x08, 0x83, 0xb2,
+    0x8c, 0xf1, 0x5a, 0x2f, 0xd1, 0x23, 0xa2, 0x58, 0x74, 0x76, 0x7f, 0x23, 0x79, 0x46, 0xb0, 0xc5,
+    0x9a, 0x5a, 0x15, 0xd1, 0xea, 0x63, 0xea, 0x6e, 0xf5, 0xae, 0x58, 0x43, 0x76, 0xdb, 0xe3, 0xba,
+    0xe3, 0x83, 0x7b, 0x2b, 0x5b, 0x7d, 0x71, 0x23, 0x53, 0x42, 0xb2, 0x6b, 0x54, 0xa9, 0xa6, 0x30,
+    0xa5, 0xf0, 0x3e, 0x10, 0x99, 0xae, 0x6f, 0x75, 0x90, 0x0a, 0x06, 0x17, 0xaa, 0x46, 0x8c, 0xf5,
+    0xcd, 0xd4, 0x30, 0xbd, 0xaf, 0x4b, 0xf6, 0xba, 0x37, 0xd5, 0xdf, 0xfd, 0xc5, 0xfb, 0x1f, 0xff,
+    0x53, 0xcf, 0x72, 0xf3, 0xea, 0xff, 0xfc, 0xc5, 0x7b, 0x4e, 0xbb, 0x7d, 0xbd, 0xee, 0x98, 0x54,
+    0xd8, 0x0d, 0xbe, 0xae, 0x07, 0x99, 0xc1, 0x36, 0x0d, 0xdf, 0x20, 0x5e, 0x14, 0x2b, 0x79, 0xbb,
+    0xdd, 0xcf, 0x6d, 0x10, 0x05, 0xde, 0x95, 0xa5, 0x4f, 0xc5, 0x18, 0x3b, 0xab, 0xa9, 0xf5, 0x3b,
+    0x24, 0x5a, 0xec, 0xf6, 0x01, 0x54, 0x1b, 0xc7, 0xab, 0xe3, 0x56, 0x02, 0xd2, 0x45, 0xeb, 0x55,
+    0x3f, 0x23, 0x85, 0x11, 0x1e, 0xce, 0x41, 0x19, 0x34, 0xf6, 0xaa, 0x94, 0x10, 0x2c, 0x8a, 0x2a,
+    0x1d, 0xac, 0x0a, 0x7d, 0x29, 0xd5, 0x93, 0x98, 0x8e, 0xc9, 0xd9, 0x52, 0xff, 0x42, 0xfd, 0xdc,
+    0x2f, 0xbd, 0x7c, 0x76, 0x50, 0xfd, 0x8f, 0x5f, 0x7a, 0x89, 0x2f, 0x4a, 0x8c, 0x80, 0xfa, 0x77,
+    0xdc, 0x66, 0x5b, 0xd2, 0xd3, 0x22, 0x18, 0x68, 0x60, 0x2f, 0xda, 0x6e, 0x35, 0x88, 0xd0, 0x4d,
+    0x61, 0x82, 0x15, 0x29, 0x18, 0xce, 0x0a, 0xa7, 0xfa, 0xe0, 0xb4, 0xd8, 0xb9, 0x7a, 0xe9, 0xe8,
+    0x9b, 0xa7, 0x95, 0xbe, 0x31, 0xee, 0xe7, 0x7f, 0xf9, 0xfe, 0xc7, 0xfe, 0xe4, 0xb3, 0x31, 0x88,
+    0x5f, 0xff, 0xe5, 0x7b, 0x4e, 0xb2, 0xc7, 0x3b, 0xd0, 0x69, 0x7c, 0xc4, 0xfb, 0xc3, 0x47, 0xd6,
+    0x0a, 0x55, 0x93, 0xe7, 0x57, 0xde, 0x52, 0x4b, 0xae, 0xf3, 0x4a, 0x87, 0x0c, 0xdc, 0x2d, 0xa3,
+    0x79, 0x75, 0x9b, 0xab, 0x98, 0xe3, 0x14, 0xfb, 0xd8, 0xe1, 0xc7, 0x61, 0xba, 0xf4, 0x85, 0x5f,
+    0x79, 0x1e, 0xf1, 0xd2, 0xff, 0xfe, 0x2b, 0x1f, 0x8b, 0xc9, 0xef, 0xea, 0x25, 0x4b, 0x6d, 0x93,
+    0x73, 0xc6, 0x48, 0xf9, 0x4f, 0x50, 0xaf, 0xdf, 0xed, 0x61, 0x33, 0x53, 0xb4, 0x11, 0xa7, 0x1b,
+    0x4a, 0x71, 0x04, 0x97, 0x74, 0xdc, 0x69, 0x60, 0xe4, 0x19, 0xdd, 0xaf, 0xca, 0x74, 0x39, 0x4f,
+    0x57, 0x89, 0x4a, 0x44, 0x7b, 0xf7, 0x18, 0x95, 0xae, 0x43, 0xee, 0x73, 0x71, 0xad, 0xa4, 0x50,
+    0xed, 0xe3, 0x85, 0x4f, 0x1f, 0x0b, 0xf4, 0xbd, 0xc0, 0x3c, 0x51, 0xf5, 0xb4, 0x56, 0x5d, 0xab,
+    0x50, 0x79, 0x12, 0xa0, 0x58, 0xec, 0xf5, 0xb6, 0xe3, 0x75, 0xb9, 0x5a, 0x75, 0xaa, 0xe4, 0x93,
+    0x1a, 0x7c, 0x82, 0x2b, 0x71, 0xf9, 0xce, 0x5f, 0x7d, 0xdb, 0x9d, 0xad, 0x9f, 0xfd, 0xd5, 0x97,
+    0xd0, 0x73, 0xda, 0x63, 0x83, 0xb0, 0xe4, 0x72, 0xad, 0x8a, 0x16, 0x7b, 0x3d, 0x28, 0xd9, 0x50,
+    0xac, 0x24, 0x2b, 0xe5, 0x59, 0xc5, 0xf5, 0x40, 0xee, 0x03, 0xc5, 0x82, 0x0e, 0xd5, 0x88, 0x32,
+    0x00, 0xad, 0xda, 0xbb, 0x0e, 0x69, 0x97, 0xf3, 0x7d, 0x2c, 0x69, 0xb7, 0x1b, 0xf5, 0x36, 0x89,
+    0x88, 0xbf, 0xf8, 0x6b, 0xf7, 0x5f, 0xf9, 0x13, 0x6f, 0xa9, 0xb3, 0xf5, 0xdf, 0x7e, 0xad, 0x77,
+    0xad, 0x54, 0xa1, 0x3a, 0xe4, 0x6a, 0xef, 0x3e, 0xaa, 0x32, 0x66, 0x8d, 0x21, 0x6e, 0x11, 0xdf,
+    0x60, 0x2b, 0x24, 0x4b, 0xb7, 0xac, 0x32, 0x82, 0x03, 0x42, 0x56, 0xa1, 0x4b, 0xd0, 0x3d, 0x91,
+    0x57, 0x0a, 0x57, 0x12, 0xec, 0x9e, 0x88, 0xfd, 0xaa, 0x7d, 0x7c, 0x46, 0xad, 0xa3, 0xd8, 0xe7,
+    0x85, 0xb8, 0x7c, 0xe9, 0xd7, 0xdf, 0xc6, 0x70, 0xfc, 0x7f, 0xfd, 0xf5, 0x7b, 0x71, 0xa5, 0xe0,
+    0x5a, 0xd4, 0xab, 0x9e, 0x86, 0x08, 0xf8, 0x5b, 0x56, 0x4f, 0xd3, 0x60, 0x07, 0x53, 0xdc, 0x2f,
+    0x57, 0x47, 0x28, 0xd9, 0x3d, 0x7d, 0x2c, 0xc5, 0x8b, 0x2c, 0xef, 0xe0, 0x9e, 0x9c, 0x4d, 0x5b,
+    0xa0, 0xa8, 0xa3, 0xce, 0xab, 0x48, 0x45, 0xc6, 0x5d, 0xb1, 0x1d, 0x7f, 0xff, 0x37, 0xde, 0x2e,
+    0xb6, 0xfe, 0xcb, 0x6f, 0xdc, 0xdb, 0xc6, 0x2e, 0xfe, 0xe4, 0xec, 0xc6, 0x88, 0x55, 0x6d, 0x11,
+    0xac, 0x79, 0xfd, 0x72, 0x83, 0xcb, 0x38, 0x2a, 0x0c, 0x0a, 0x67, 0xc1, 0xe6, 0x3e, 0xc9, 0xa8,
+    0x47, 0x48, 0xb0, 0xd1, 0x0f, 0x48, 0x7d, 0xc4, 0xde, 0xd5, 0x0e, 0x91, 0xba, 0x1c, 0xaf, 0xe0,
+    0x03, 0xbd, 0x4f, 0xc3, 0xfd, 0xe5, 0xdf, 0x7c, 0x5b, 0xfc, 0xad, 0x9f, 0xf9, 0xcd, 0x97, 0xf6,
+    0x65, 0xaa, 0xc7, 0x2b, 0x88, 0xda, 0x0e, 0x27, 0xc8, 0x56, 0x1c, 0xab, 0x06, 0xe6, 0x83, 0xfd,
+    0x9d, 0x4d, 0xb0, 0x6a, 0xb5, 0x72, 0x6c, 0x63, 0x61, 0xf1, 0x48, 0x9d, 0x7e, 0xb5, 0xfd, 0x6b,
+    0x0b, 0xa7, 0xcd, 0x4c, 0x0e, 0x56, 0x86, 0xae, 0x55, 0xff, 0x8e, 0x7f, 0x37, 0x5c, 0xe6, 0xaf,
+    0x11, 0xe5, 0xef, 0xfe, 0xad, 0x97, 0x4c, 0xe9, 0x07, 0xff, 0xf8, 0xa7, 0x56, 0xb5, 0xfb, 0x3f,
+    0xff, 0xd6, 0xc7, 0x4c, 0x75, 0xf4, 0xab, 0x26, 0x9f, 0xc9, 0x3d, 0x5e, 0x69, 0x2e, 0xd7, 0x6e,
+    0x47, 0xb3, 0x0a, 0xcc, 0xa2, 0x69, 0x2b, 0xf3, 0x41, 0xb7, 0x9a, 0xf5, 0x70, 0x6c, 0x46, 0xff,
+    0x16, 0xd0, 0xfd, 0x81, 0x63, 0xc1, 0xd2, 0xd6, 0x7d, 0x8f, 0xd9, 0x3a, 0xc2, 0x04, 0x47, 0x1c,
+    0x21, 0x8f, 0xe7, 0xc9, 0xeb, 0x6b, 0x65, 0xcd, 0x2a, 0x64, 0x0c, 0x30, 0xff, 0xc3, 0x6f, 0xdc,
+    0xff, 0xc0, 0x37, 0x7f, 0x0a, 0xee, 0xfc, 0x4f, 0x7f, 0xe3, 0x9e, 0xb9, 0xf7, 0xaf, 0x7b, 0x26,
+    0x5e, 0x79, 0x0c, 0xe1, 0x03, 0xb8, 0xf3, 0x2e, 0x55, 0xee, 0x2a, 0x61, 0xa4, 0xb1, 0x37, 0x02,
+    0x2b, 0xaf, 0x77, 0x40, 0xa8, 0xa3, 0x62, 0x59, 0x73, 0x43, 0xee, 0x90, 0xe2, 0x6e, 0xc1, 0xb8,
+    0x5c, 0xcf, 0x4b, 0x17, 0xa0, 0x4a, 0x63, 0x98, 0x4a, 0xce, 0x01, 0x53, 0x20, 0x05, 0x43, 0x05,
+    0xeb, 0xe8, 0x5f, 0x9a, 0xff, 0xd1, 0x6f, 0xbf, 0xfc, 0xfe, 0x3f, 0xf6, 0x46, 0x7b, 0x1a, 0xfe,
+    0xd4, 0x6f, 0xbf, 0x4c, 0x5c, 0xb4, 0x48, 0xd5, 0x44, 0xd2, 0x2b, 0xed, 0xa4, 0x3f, 0x26, 0xe6,
+    0x8a, 0xc0, 0x4b, 0x86, 0xb2, 0x8a, 0x11, 0xc4, 0x22, 0x38, 0x1f, 0x5c, 0x26, 0x69, 0x6a, 0x1a,
+    0xd5, 0x9b, 0x42, 0xb7, 0x0f, 0xe0, 0x44, 0x95, 0x64, 0xcb, 0xba, 0xaf, 0x3c, 0x2a, 0x16, 0x6b,
+    0x72, 0x75, 0x04, 0x0e, 0x26, 0xb0, 0x52, 0xc0, 0x08, 0x52, 0x0c, 0xaf, 0xd7, 0x6c, 0xfd, 0xe3,
+    0xdf, 0xf9, 0x88, 0x29, 0xfd, 0xab, 0x3f, 0xfa, 0xe4, 0xd2, 0xf5, 0x93, 0xbf, 0x73, 0xdf, 0x99,
+    0xbf, 0x6a, 0x47, 0x13, 0x26, 0x68, 0x26, 0x92, 0x22, 0x4a, 0x36, 0xd9, 0x56, 0x90, 0xe9, 0xe0,
+    0xee, 0xf5, 0x3d, 0x61, 0x01, 0x67, 0x78, 0x36, 0xe2, 0x1c, 0x68, 0xec, 0x96, 0xb4, 0xfe, 0x08,
+    0x17, 0xb6, 0xda, 0x28, 0x1b, 0x0d, 0xba, 0x59, 0x93, 0x68, 0x4d, 0x78, 0xf5, 0x54, 0x4d, 0x11,
+    0xf6, 0x48, 0x6f, 0x63, 0x95, 0x24, 0x69, 0x88, 0x2f, 0x6c, 0x25, 0xa2, 0xf4, 0x3d, 0xbf, 0xfb,
+    0x11, 0x53, 0xfa, 0x97, 0x7f, 0xe4, 0x49, 0xf0, 0xfa, 0x89, 0xdf, 0xbd, 0x67, 0xaa, 0x89, 0x77,
+    0x2d, 0x93, 0x4c, 0x95, 0xab, 0x89, 0x27, 0x2c, 0x5a, 0x7b, 0x20, 0x22, 0xef, 0x26, 0x66, 0xb9,
+    0xae, 0x95, 0xda, 0xf5, 0xc9, 0xe5, 0xe4, 0xb5, 0x29, 0xcc, 0xeb, 0xa6, 0xd0, 0x5a, 0xde, 0x61,
+    0xd0, 0x06, 0xc3, 0x10, 0x2d, 0x16, 0xd1, 0xce, 0x7d, 0xa5, 0x4b, 0xb6, 0x95, 0x89, 0x0f, 0xa8,
+    0xaa, 0xfd, 0xf5, 0xfe, 0xd3, 0xdf, 0xfb, 0x88, 0x89, 0x13, 0xa5, 0x7f, 0xf6, 0x87, 0x1f, 0xc1,
+    0xaf, 0xff, 0xda, 0xef, 0x7d, 0x9c, 0xa8, 0x32, 0x35, 0xe6, 0xdd, 0x58, 0xb3, 0xb2, 0xbc, 0xf5,
+    0x57, 0xeb, 0x87, 0x15, 0x3e, 0x2d, 0x50, 0xae, 0x2c, 0xb6, 0x5c, 0xd7, 0x2a, 0x6e, 0x0a, 0x73,
+    0xef, 0xbc, 0xeb, 0xed, 0xe0, 0x61, 0x8b, 0xa9, 0xe0, 0xf4, 0x50, 0x52, 0xc5, 0xb6, 0x68, 0xf5,
+    0x6c, 0x71, 0xa0, 0xa3, 0x55, 0x04, 0xa9, 0x69, 0xd2, 0xf0, 0x5a, 0xb4, 0xfa, 0x8b, 0xfa, 0xe7,
+    0xbf, 0x7f, 0x21, 0x8c, 0xff, 0xc9, 0x1f, 0x5a, 0xd6, 0xb0, 0xaf, 0xfe, 0xfe, 0x7d, 0xa2, 0xd6,
+    0xf1, 0xd4, 0xbc, 0xc4, 0x8d, 0x1d, 0x2a, 0xd6, 0x27, 0x9e, 0x50, 0xa9, 0xce, 0x16, 0xce, 0x71,
+    0xa8, 0x81, 0xf9, 0x20, 0xe0, 0x89, 0x6d, 0xb3, 0x96, 0x35, 0x53, 0x98, 0x2c, 0xb9, 0x9a, 0xfe,
+    0x4d, 0x9f, 0xa6, 0xd2, 0xdf, 0xf2, 0xaa, 0x39, 0x3a, 0x2d, 0x60, 0x98, 0x0e, 0xb9, 0xe2, 0xce,
+    0xcd, 0x4a, 0xe3, 0xa2, 0x32, 0x83, 0xe5, 0x1a, 0x48, 0x15, 0xc1, 0x3d, 0x9f, 0xf5, 0x6a, 0xc7,
+    0x75, 0x5e, 0xbf, 0xef, 0xff, 0xfe, 0x9f, 0x2e, 0x7a, 0x43, 0x3c, 0x26, 0x43, 0x5e, 0x4f, 0x1a,
+    0x13, 0x3d, 0xc0, 0x44, 0x8d, 0xd3, 0x0e, 0x77, 0x1f, 0x4d, 0x46, 0xb0, 0x18, 0x72, 0xb5, 0x8f,
+    0x54, 0x7d, 0x12, 0x10, 0x2a, 0xe0, 0xbc, 0x1f, 0xe7, 0x2d, 0x26, 0x57, 0x6c, 0xf7, 0xc5, 0xb5,
+    0xa8, 0xb0, 0xd4, 0x27, 0xf7, 0xb3, 0xc2, 0xa0, 0x62, 0x25, 0xcd, 0xcd, 0x6a, 0xde, 0x16, 0xd6,
+    0xc9, 0x08, 0xf2, 0xa8, 0x5b, 0x45, 0xa6, 0x20, 0x8e, 0x78, 0x81, 0x48, 0x15, 0xc7, 0xa8, 0xda,
+    0x3a, 0xb9, 0xca, 0xd7, 0xdf, 0x3c, 0xc3, 0x16, 0xb7, 0xae, 0xa9, 0x25, 0x5b, 0x1a, 0x9b, 0x6d,
+    0x04, 0x2d, 0xcf, 0x3d, 0x6e, 0xfe, 0x5e, 0x69, 0x01, 0xad, 0x09, 0xaf, 0x13, 0xdb, 0x99, 0xfa,
+    0x81, 0x0d, 0x36, 0x4c, 0x34, 0x9b, 0xc0, 0x5f, 0x9c, 0x77, 0xd0, 0x24, 0x3d, 0x0b, 0xd1, 0x9a,
+    0x1e, 0xf7, 0xda, 0xfd, 0x2a, 0xcd, 0x58, 0x93, 0xee, 0x27, 0xb7, 0x13, 0x5b, 0x93, 0x6e, 0xf1,
+    0x28, 0x5a, 0x1c, 0xbb, 0xd9, 0xcd, 0x36, 0xbb, 0xb5, 0xa3, 0x6a, 0x1b, 0x07, 0x3a, 0x8d, 0x17,
+    0x22, 0x55, 0x89, 0x8c, 0x3d, 0x95, 0x6a, 0xbb, 0xd1, 0x6a, 0x2c, 0xb4, 0xab, 0xde, 0x15, 0x56,
+    0x2c, 0x20, 0x5a, 0xbb, 0xe7, 0xc2, 0xc7, 0x57, 0xa0, 0xf1, 0x34, 0x10, 0x74, 0x83, 0x0f, 0xd1,
+    0x72, 0x80, 0x95, 0x8c, 0x06, 0xf1, 0x11, 0xa7, 0xbe, 0x85, 0x45, 0x8b, 0x84, 0x6e, 0x95, 0x0e,
+    0xaf, 0x48, 0xbb, 0x3d, 0x82, 0x61, 0x05, 0x10, 0x89, 0xdd, 0xae, 0x72, 0xb5, 0x75, 0xbd, 0xbb,
+    0x8b, 0xd7, 0x0c, 0xd1, 0xfa, 0xef, 0x64, 0x31, 0xa6, 0x0a, 0xed, 0xe0, 0xe5, 0x36, 0xef, 0xd0,
+    0x73, 0x97, 0xa2, 0x85, 0x4d, 0xe1, 0x2b, 0x68, 0x0a, 0x65, 0x04, 0xab, 0x2d, 0xca, 0x55, 0xc8,
+    0x49, 0x37, 0x62, 0xd7, 0xf9, 0x88, 0x63, 0x01, 0x53, 0x38, 0x89, 0x96, 0x6a, 0x10, 0x83, 0xa2,
+    0xd5, 0xdf, 0x86, 0xe3, 0x32, 0x8a, 0x38, 0x89, 0xdb, 0x3e, 0x0b, 0x29, 0x35, 0xb5, 0x30, 0x77,
+    0x78, 0x15, 0xcd, 0xdc, 0x33, 0x0c, 0xe5, 0x5b, 0x8a, 0x05, 0xf2, 0x82, 0xac, 0x0c, 0xbe, 0x5d,
+    0xc4, 0xdc, 0x81, 0x35, 0x8c, 0x88, 0x56, 0x3c, 0x82, 0x75, 0x4e, 0xae, 0xac, 0x78, 0xd5, 0x82,
+    0x29, 0xcc, 0x06, 0x64, 0xa9, 0xf3, 0x4e, 0x4a, 0xe7, 0xa6, 0x4c, 0xa2, 0x75, 0x70, 0x16, 0x59,
+    0x3d, 0xac, 0x01, 0xa4, 0x18, 0x6e, 0xf3, 0x8f, 0x64, 0x7d, 0xf5, 0xde, 0x55, 0x15, 0xba, 0x5d,
+    0xbc, 0xc5, 0xab, 0xb8, 0x8f, 0x65, 0x6d, 0x40, 0xc2, 0x01, 0xf7, 0x73, 0x6e, 0x56, 0x3c, 0xd0,
+    0x10, 0x5f, 0x19, 0x0c, 0x4e, 0xfd, 0x2c, 0x25, 0xca, 0xaa, 0x29, 0x8c, 0x1c, 0x65, 0xf4, 0xb4,
+    0x12, 0x8c, 0x3b, 0x60, 0xd1, 0x3a, 0x14, 0x0b, 0xb0, 0x45, 0xa7, 0x76, 0x9b, 0x81, 0xfd, 0xe9,
+    0xb9, 0x33, 0x82, 0xd6, 0x04, 0x05, 0x83, 0xc5, 0x46, 0x7b, 0x3e, 0x90, 0xc6, 0x18, 0x89, 0x35,
+    0xec, 0x81, 0xc5, 0x9c, 0x4f, 0x62, 0x61, 0x52, 0x49, 0x55, 0x0d, 0x7b, 0x57, 0x20, 0x6a, 0x85,
+    0xf5, 0x49, 0x05, 0x2b, 0xc5, 0xc1, 0xca, 0x63, 0x3e, 0x82, 0x25, 0x5a, 0x13, 0x0d, 0xcd, 0x76,
+    0x4d, 0xea, 0x78, 0x6d, 0xc5, 0x6b, 0xd9, 0xc8, 0x5e, 0x4a, 0x71, 0x91, 0x4b, 0x00, 0x00, 0x0d,
+    0x57, 0x49, 0x44, 0x41, 0x54, 0xfc, 0x13, 0x2b, 0xc7, 0xe6, 0xcd, 0x7c, 0xd5, 0x74, 0xd9, 0xa0,
+    0x62, 0xd5, 0x98, 0xe7, 0x0e, 0x9c, 0x77, 0x0c, 0xd6, 0xc4, 0xd3, 0x2b, 0x63, 0x25, 0x67, 0x29,
+    0x9d, 0x21, 0x12, 0x05, 0xcd, 0xb6, 0xe7, 0x7e, 0x52, 0xb1, 0x36, 0xf1, 0x7c, 0x03, 0x53, 0x98,
+    0xc6, 0xdf, 0xde, 0xcd, 0xa5, 0x21, 0x23, 0xfa, 0x50, 0xbc, 0xcd, 0xdd, 0xae, 0x50, 0x35, 0x63,
+    0x13, 0xec, 0x71, 0x39, 0x9b, 0x18, 0xac, 0x48, 0xba, 0x04, 0xaf, 0xc4, 0x1a, 0x2c, 0x53, 0x28,
+    0x33, 0x11, 0x76, 0x81, 0x0b, 0x20, 0x6c, 0xb7, 0xe3, 0x58, 0xc7, 0x0f, 0x07, 0x33, 0x41, 0x37,
+    0x43, 0x66, 0x35, 0xa6, 0x90, 0xbb, 0xf1, 0x8c, 0x82, 0x65, 0x51, 0x95, 0xb5, 0xfd, 0xc7, 0x07,
+    0x58, 0xb5, 0x73, 0xe1, 0xb1, 0x68, 0x51, 0x37, 0xe1, 0x27, 0x91, 0x61, 0x5d, 0x60, 0x6c, 0xbd,
+    0x05, 0x7c, 0xf6, 0x49, 0xa8, 0x6a, 0x47, 0x55, 0xd1, 0x7c, 0xcf, 0xa0, 0x62, 0x01, 0x53, 0x28,
+    0x15, 0xab, 0x68, 0xa2, 0x15, 0x99, 0x18, 0x5a, 0x02, 0x36, 0xfd, 0xe9, 0x1e, 0xd8, 0x21, 0x0d,
+    0xd8, 0xb2, 0xb6, 0xd9, 0x60, 0x57, 0x3d, 0xca, 0x96, 0x04, 0x6b, 0xeb, 0xb6, 0x83, 0x1e, 0x1f,
+    0x27, 0xce, 0xa6, 0x34, 0xbd, 0xde, 0x73, 0xef, 0x4f, 0x40, 0xa8, 0x49, 0x3a, 0x5b, 0x24, 0x44,
+    0x8b, 0x3c, 0xc1, 0x6b, 0x61, 0xdf, 0xb9, 0x18, 0x4f, 0x4b, 0x8a, 0x85, 0x49, 0x83, 0xb3, 0x42,
+    0x35, 0x34, 0x8a, 0x4d, 0x61, 0x31, 0xb2, 0x1b, 0x00, 0x4c, 0xaf, 0xec, 0xb0, 0x7b, 0x7c, 0x0d,
+    0x07, 0x2f, 0x36, 0xbb, 0x3c, 0x6d, 0x82, 0xa7, 0x6d, 0xc2, 0x6b, 0xf2, 0xb1, 0xa6, 0xa1, 0xdf,
+    0x04, 0x61, 0x79, 0x14, 0x80, 0x0a, 0xa7, 0x87, 0x74, 0xbd, 0x36, 0xb7, 0xb2, 0x43, 0xb5, 0x23,
+    0x2b, 0x40, 0xae, 0xf0, 0xbe, 0xc5, 0x32, 0xca, 0x95, 0xaa, 0xc1, 0xaa, 0x8f, 0xf5, 0x58, 0x60,
+    0x61, 0xe7, 0xbd, 0x78, 0xcb, 0x7f, 0xe0, 0x04, 0x87, 0x46, 0x97, 0x26, 0x83, 0x91, 0x75, 0xc0,
+    0x34, 0x62, 0xb4, 0xd9, 0x5a, 0xb5, 0xa9, 0x8a, 0x25, 0x31, 0x2a, 0x1a, 0x52, 0x75, 0x3c, 0xaf,
+    0xe3, 0x0a, 0x49, 0x0b, 0x7b, 0xf1, 0xdc, 0xc5, 0xe2, 0x55, 0x98, 0x22, 0x7e, 0x15, 0xde, 0x10,
+    0x3b, 0x6d, 0xc6, 0x07, 0x61, 0x94, 0x88, 0x29, 0x64, 0x3b, 0x3a, 0x0a, 0x4c, 0xa1, 0x0b, 0x56,
+    0x81, 0xe9, 0x56, 0xaf, 0x02, 0xb9, 0xa3, 0xd8, 0x6d, 0xa7, 0x15, 0x9f, 0x3d, 0x6b, 0x7e, 0xd5,
+    0xa6, 0xc9, 0xd2, 0x66, 0x68, 0xd5, 0x36, 0x81, 0xb5, 0x8d, 0x18, 0x4d, 0xe7, 0xf2, 0x71, 0xaf,
+    0xa3, 0xa7, 0x95, 0x85, 0x35, 0x3c, 0x2e, 0x29, 0x75, 0xe8, 0x80, 0xf6, 0x54, 0x35, 0xe0, 0xaa,
+    0xe3, 0xb4, 0x85, 0xc9, 0x73, 0x5f, 0x95, 0x2b, 0x35, 0xf8, 0x1e, 0x5c, 0xed, 0xae, 0x81, 0xe5,
+    0x67, 0x2c, 0x5a, 0x65, 0x05, 0x26, 0x39, 0x1f, 0x3c, 0x31, 0x13, 0x04, 0x42, 0xe5, 0x4e, 0x00,
+    0x37, 0x8d, 0xb3, 0x81, 0xb9, 0xc9, 0xc7, 0x02, 0x78, 0x4d, 0x2e, 0xf0, 0x04, 0x56, 0x33, 0x44,
+    0xeb, 0x08, 0x71, 0x11, 0xec, 0xe6, 0x55, 0x3b, 0xf7, 0xbf, 0x1f, 0x82, 0x3d, 0xe6, 0x5d, 0x4d,
+    0x19, 0x13, 0xfd, 0x6f, 0x8b, 0xe5, 0x2a, 0xc7, 0xb2, 0xfb, 0x83, 0xb3, 0x42, 0x50, 0xa1, 0x09,
+    0x80, 0x65, 0xe1, 0x05, 0xa6, 0x7e, 0x3d, 0x55, 0x72, 0xf5, 0xc6, 0x9d, 0x0c, 0x02, 0xd7, 0x2a,
+    0x41, 0xa7, 0xaa, 0x07, 0x08, 0xcb, 0xd8, 0x83, 0x8f, 0xb5, 0x89, 0x09, 0xb9, 0x54, 0xac, 0x7e,
+    0x86, 0x25, 0xad, 0x61, 0x7f, 0x31, 0x52, 0xb4, 0x18, 0x6e, 0x98, 0x26, 0xdb, 0xd3, 0xb2, 0x3a,
+    0x10, 0x11, 0xcc, 0xb5, 0xaa, 0xa3, 0x50, 0x6d, 0x31, 0x3b, 0xf8, 0x74, 0x71, 0x2c, 0x50, 0x8d,
+    0x02, 0x98, 0xc5, 0x62, 0x23, 0xb5, 0x1b, 0xe9, 0xed, 0xae, 0x77, 0x15, 0x89, 0x5a, 0x45, 0x90,
+    0xda, 0xa0, 0x65, 0xcc, 0x44, 0x9b, 0xaa, 0x58, 0x45, 0x9c, 0x4c, 0x54, 0xf5, 0xab, 0x25, 0x6e,
+    0xd1, 0xfa, 0xd4, 0x25, 0x35, 0x90, 0xcd, 0x56, 0x1d, 0x8d, 0xe6, 0x92, 0x29, 0xdc, 0xba, 0xdb,
+    0x99, 0xc7, 0x38, 0xfb, 0xb6, 0x22, 0x57, 0x4f, 0xa1, 0x58, 0xd5, 0xab, 0x74, 0x22, 0x23, 0x5b,
+    0x25, 0xc0, 0x13, 0xa0, 0xaa, 0x06, 0xa8, 0x4a, 0x70, 0x26, 0x78, 0x40, 0xb3, 0x8d, 0xe7, 0xf2,
+    0x1b, 0x8b, 0x33, 0xe4, 0x63, 0x6d, 0xe3, 0x88, 0xf4, 0xa6, 0x30, 0x0b, 0xc5, 0xc2, 0xc9, 0xaf,
+    0xad, 0xcb, 0x0a, 0x24, 0xdb, 0x2c, 0xaa, 0x6c, 0x35, 0x2f, 0x82, 0x55, 0xc7, 0x8c, 0xab, 0x6d,
+    0x8c, 0xb3, 0x4f, 0x01, 0xf7, 0x14, 0xb3, 0x83, 0x69, 0x3d, 0xa3, 0xb0, 0xc6, 0xac, 0xa1, 0x15,
+    0xd3, 0x2a, 0x36, 0x46, 0x53, 0x62, 0x7b, 0x85, 0xde, 0x7a, 0x8d, 0x99, 0x3f, 0xf6, 0x84, 0x0a,
+    0xcc, 0xfb, 0x24, 0x6d, 0xaa, 0x8f, 0x95, 0x26, 0x50, 0x54, 0xa4, 0xac, 0x0d, 0x90, 0x9b, 0x76,
+    0x61, 0x87, 0xa7, 0x25, 0x35, 0x09, 0x44, 0xb6, 0xd8, 0x66, 0x8b, 0xba, 0xfd, 0x5b, 0x04, 0x27,
+    0x83, 0xdb, 0x98, 0xca, 0x97, 0xe1, 0xfa, 0x60, 0x36, 0x52, 0xae, 0xdd, 0x44, 0x9d, 0x06, 0x45,
+    0x0b, 0xac, 0x18, 0xba, 0xba, 0x65, 0xf1, 0xe4, 0x0a, 0xd5, 0x44, 0x55, 0x8b, 0x59, 0xc0, 0xec,
+    0x2d, 0x2d, 0xab, 0x8a, 0xb5, 0x45, 0xf0, 0xb2, 0x02, 0xa4, 0x9b, 0x20, 0x4c, 0xb5, 0x86, 0xc0,
+    0x02, 0x66, 0xc3, 0xd8, 0x57, 0x11, 0x6e, 0x00, 0x6c, 0x35, 0xa3, 0xc5, 0x23, 0x98, 0x1b, 0x66,
+    0x91, 0x2c, 0x0a, 0xb4, 0x2a, 0xdb, 0xf5, 0x52, 0x6e, 0xcc, 0xc7, 0x52, 0x83, 0x0e, 0xd5, 0xab,
+    0xab, 0x13, 0xa9, 0xd6, 0x57, 0x8c, 0x5c, 0x2b, 0x40, 0x15, 0x79, 0x99, 0x30, 0x29, 0x80, 0x11,
+    0xb6, 0x8c, 0x59, 0x04, 0x48, 0x79, 0x32, 0x6a, 0xbd, 0xd5, 0xab, 0xc6, 0xc5, 0xb8, 0xa2, 0x25,
+    0xd9, 0xa2, 0x71, 0x9d, 0x87, 0x63, 0x6c, 0xb1, 0x97, 0xa6, 0x62, 0x1d, 0x38, 0xcb, 0x71, 0x1a,
+    0x53, 0x5e, 0x74, 0xb0, 0x82, 0x6e, 0x56, 0x33, 0xea, 0x66, 0x97, 0xc5, 0x32, 0x90, 0x15, 0xee,
+    0x9a, 0x6f, 0x61, 0xaa, 0xac, 0xbc, 0xd0, 0x14, 0x88, 0x29, 0x44, 0x8e, 0xe1, 0x2f, 0x6f, 0xc4,
+    0xdb, 0x78, 0x27, 0x36, 0x1b, 0x2f, 0xb7, 0x31, 0x44, 0xb3, 0x4b, 0x5c, 0xaa, 0xab, 0x84, 0xaa,
+    0xa7, 0xc5, 0x62, 0x07, 0xa2, 0xe5, 0xbf, 0x67, 0xaf, 0x2a, 0x04, 0xf6, 0xab, 0x5c, 0xb9, 0x5a,
+    0x52, 0xac, 0x88, 0x68, 0x01, 0xdd, 0xaa, 0xb0, 0x3c, 0x5f, 0x89, 0x75, 0xe5, 0x68, 0x76, 0x78,
+    0x9d, 0x63, 0xb3, 0x3f, 0x97, 0x9e, 0x3b, 0x88, 0x94, 0xb2, 0xa4, 0xb3, 0xd9, 0xf5, 0xb1, 0x6b,
+    0xa0, 0xce, 0xb3, 0xdb, 0xb5, 0x6c, 0xba, 0xe6, 0xc9, 0xde, 0x59, 0xde, 0x7a, 0x1f, 0x03, 0xb3,
+    0xa6, 0x9c, 0x4d, 0x04, 0xd5, 0xa6, 0xdc, 0x9e, 0x3e, 0x5f, 0x14, 0xf8, 0xec, 0x53, 0xf2, 0x24,
+    0xad, 0x2c, 0xe9, 0x90, 0xd1, 0x62, 0xa4, 0x7a, 0xa3, 0x0a, 0x4e, 0xf0, 0x53, 0xdd, 0xc2, 0xbb,
+    0x4f, 0xdd, 0x60, 0xd5, 0xb6, 0x2e, 0x4e, 0xbe, 0x7a, 0x1d, 0x3e, 0x56, 0x15, 0xfc, 0xba, 0x5d,
+    0x0f, 0xac, 0x16, 0x70, 0xaa, 0xbf, 0xa5, 0x42, 0x63, 0xb1, 0x65, 0xe1, 0x45, 0x86, 0x27, 0x97,
+    0x0c, 0xc8, 0x92, 0x91, 0x82, 0xbc, 0x54, 0xf5, 0x64, 0x75, 0x97, 0x4e, 0xa4, 0x13, 0x4e, 0xb1,
+    0x9f, 0x5e, 0xfc, 0x24, 0xb7, 0x70, 0xd1, 0x18, 0x10, 0x5e, 0x57, 0x63, 0xeb, 0x9b, 0x16, 0x6b,
+    0xb0, 0xe4, 0xea, 0x4e, 0x13, 0x2d, 0x3d, 0xbb, 0xa1, 0x6a, 0xe1, 0x83, 0x1a, 0x58, 0x33, 0x6f,
+    0x81, 0x36, 0x79, 0xd6, 0xab, 0xc2, 0x18, 0x84, 0x14, 0xb9, 0x23, 0x2a, 0x36, 0x89, 0x56, 0xea,
+    0xa2, 0xfc, 0x49, 0x20, 0x55, 0xec, 0x6c, 0x7d, 0x5c, 0x0b, 0xf3, 0x76, 0xb0, 0x22, 0x3d, 0x5d,
+    0x4a, 0xac, 0x8b, 0x49, 0xbc, 0x03, 0x28, 0xaf, 0x58, 0x40, 0x6c, 0x07, 0xef, 0xc6, 0x03, 0x58,
+    0xc3, 0x19, 0xb2, 0x23, 0xf2, 0xae, 0xc6, 0xd3, 0xe3, 0x1d, 0xa7, 0xb0, 0x77, 0x45, 0x76, 0xc5,
+    0x9c, 0xde, 0xdf, 0xb2, 0x6a, 0x21, 0xb5, 0x71, 0x7f, 0x6c, 0x13, 0x79, 0x85, 0x6d, 0xdc, 0xd9,
+    0x7c, 0xec, 0xa0, 0xaf, 0x63, 0xd1, 0x91, 0xe4, 0x19, 0xc1, 0x14, 0xde, 0x11, 0x84, 0x97, 0x01,
+    0x82, 0xfd, 0x82, 0x6a, 0xac, 0x1f, 0x4e, 0xd5, 0xf2, 0x63, 0x41, 0xb9, 0x18, 0x40, 0x55, 0x1a,
+    0x97, 0x96, 0x81, 0x2c, 0xdd, 0x05, 0x7c, 0x2c, 0xa0, 0x5b, 0x0f, 0x91, 0xf7, 0x29, 0xba, 0xb8,
+    0xad, 0x34, 0xc5, 0x6b, 0x86, 0xbd, 0x6f, 0x46, 0xbc, 0x80, 0x6c, 0x7f, 0xab, 0xd9, 0x5d, 0x9f,
+    0xfa, 0x48, 0xd8, 0xb4, 0x40, 0xd4, 0xba, 0x89, 0xe4, 0xb4, 0x93, 0x36, 0x05, 0x78, 0x8a, 0xcb,
+    0x15, 0x7b, 0xa9, 0x3b, 0x58, 0xb4, 0xda, 0xe2, 0xb3, 0xaa, 0x46, 0x13, 0xda, 0x59, 0xaa, 0x80,
+    0xcf, 0x1e, 0xe4, 0xe6, 0x2e, 0x40, 0xd5, 0xd6, 0x2f, 0x42, 0xa7, 0xd1, 0x14, 0x5a, 0x6c, 0xb5,
+    0x70, 0x7b, 0x45, 0xf2, 0xaa, 0xe4, 0x58, 0x36, 0xd1, 0x1a, 0x32, 0x55, 0xe7, 0x78, 0x94, 0x2e,
+    0x36, 0x08, 0x93, 0x43, 0xcc, 0xf6, 0x0e, 0x55, 0x7e, 0x0c, 0xc5, 0x02, 0x09, 0xf8, 0xcd, 0xeb,
+    0x5b, 0xe9, 0xf2, 0xb4, 0x54, 0x28, 0x46, 0x45, 0xca, 0x5a, 0x93, 0x51, 0x8d, 0x9d, 0xb4, 0x83,
+    0x92, 0x30, 0x3d, 0x9a, 0x75, 0x51, 0xac, 0x36, 0xae, 0xfd, 0x55, 0x5b, 0xb7, 0xda, 0xe2, 0x01,
+    0x5c, 0x72, 0x16, 0xac, 0x60, 0x98, 0x26, 0xb3, 0xc8, 0x23, 0x5b, 0x7d, 0x00, 0xac, 0xc7, 0x2b,
+    0x52, 0x60, 0xdc, 0xdd, 0xc5, 0x6f, 0x85, 0x1b, 0x08, 0x36, 0xbd, 0xae, 0x01, 0xf5, 0x6a, 0x36,
+    0x52, 0xcd, 0xae, 0xc1, 0xb7, 0x44, 0x95, 0xea, 0xa7, 0x6f, 0x01, 0x53, 0x68, 0x1d, 0x9b, 0xb7,
+    0x7a, 0xf8, 0xda, 0xc7, 0x6a, 0x5a, 0xcc, 0xb3, 0x9d, 0xf2, 0xb1, 0x54, 0xad, 0x0a, 0x4a, 0xd7,
+    0x94, 0xe0, 0x80, 0xb9, 0x6c, 0x23, 0x5b, 0xac, 0xc5, 0x57, 0xd5, 0x8a, 0xe4, 0x96, 0xf9, 0x4b,
+    0xda, 0xee, 0xa0, 0x08, 0x58, 0x24, 0x46, 0xa0, 0xc2, 0xc9, 0x8d, 0xaa, 0x49, 0x52, 0x9f, 0xe2,
+    0x9d, 0xba, 0xd8, 0xcb, 0x84, 0xc9, 0x46, 0x8a, 0xcb, 0x66, 0x48, 0xd1, 0x5d, 0xc0, 0x43, 0xdf,
+    0xf0, 0xc4, 0x70, 0x52, 0x2c, 0x35, 0x5f, 0x60, 0x49, 0x9f, 0x9a, 0xbd, 0xdf, 0x8b, 0xbc, 0x1d,
+    0x38, 0x6d, 0x1d, 0x2f, 0x1a, 0x7d, 0x2f, 0x1e, 0x77, 0xfa, 0x57, 0x51, 0x7c, 0x30, 0xc5, 0xda,
+    0xba, 0x50, 0xa0, 0x13, 0x76, 0x44, 0xb4, 0x2c, 0xf5, 0x6a, 0x01, 0x71, 0x0a, 0x0a, 0x15, 0x19,
+    0xa5, 0xf7, 0xb2, 0xb1, 0x5c, 0x93, 0xed, 0xa9, 0x9f, 0x75, 0x1e, 0x91, 0x2e, 0x25, 0xbb, 0x21,
+    0x8d, 0x09, 0x7a, 0x7d, 0x32, 0x8c, 0xeb, 0x5d, 0x61, 0xbc, 0xdc, 0x66, 0xc3, 0x65, 0xfc, 0x58,
+    0x85, 0xbf, 0xd5, 0x3c, 0xb6, 0x1a, 0x2c, 0x01, 0xc7, 0xa2, 0xa4, 0xa5, 0xd5, 0x38, 0x88, 0x3c,
+    0xef, 0xca, 0x55, 0x2c, 0xd2, 0x06, 0xa1, 0xc2, 0x76, 0xeb, 0xf1, 0xc1, 0x5c, 0xad, 0x65, 0xe5,
+    0xae, 0x28, 0xdf, 0x41, 0xb9, 0xda, 0xc2, 0x46, 0x50, 0x2a, 0xd6, 0xd6, 0x6f, 0xb1, 0xb7, 0x2e,
+    0x7b, 0xf3, 0x1a, 0xef, 0x82, 0x99, 0x20, 0xc1, 0xe2, 0x13, 0xf8, 0x4b, 0x90, 0xf4, 0x17, 0xc1,
+    0x6b, 0xca, 0x12, 0x69, 0x63, 0xd5, 0x24, 0x5e, 0x29, 0x3a, 0xb2, 0x0a, 0x16, 0x2d, 0xfa, 0xa0,
+    0xa0, 0x07, 0x38, 0xc5, 0x0a, 0x78, 0x44, 0x2c, 0xe0, 0x14, 0x5e, 0x57, 0x01, 0xda, 0x02, 0xca,
+    0xa4, 0x06, 0xb4, 0xb2, 0x6a, 0x0d, 0x2f, 0x45, 0x41, 0xb2, 0x36, 0x85, 0xd9, 0x6c, 0x19, 0xc7,
+    0xcf, 0x96, 0xbb, 0x37, 0x52, 0x1a, 0xc4, 0x32, 0x8e, 0x54, 0x15, 0xe5, 0x43, 0xc8, 0xfe, 0xc9,
+    0x2a, 0x5e, 0x4d, 0x9c, 0xb8, 0x5d, 0x89, 0x2d, 0xaa, 0x38, 0xb0, 0x11, 0x0d, 0xb3, 0x45, 0xeb,
+    0x32, 0x1f, 0x19, 0x43, 0x86, 0x75, 0x41, 0x71, 0xce, 0x42, 0xd0, 0xd8, 0xdd, 0x19, 0x73, 0xc3,
+    0x3b, 0x1c, 0x76, 0xef, 0x7d, 0xac, 0x1c, 0x7b, 0xaa, 0x22, 0xc3, 0x11, 0xef, 0x06, 0x4b, 0x62,
+    0xf7, 0x33, 0x8f, 0x96, 0x71, 0x0a, 0x43, 0x2c, 0xe1, 0xd5, 0xbc, 0xce, 0xd6, 0xa0, 0x94, 0x0d,
+    0x7b, 0x5b, 0x86, 0x9a, 0x87, 0x97, 0xa5, 0x40, 0x60, 0xe8, 0x22, 0x48, 0x91, 0xdd, 0x93, 0xd2,
+    0x4a, 0x5a, 0x97, 0x60, 0xc5, 0xa9, 0xb2, 0x20, 0x03, 0xd9, 0x0d, 0xaf, 0xab, 0xcd, 0x1c, 0x8a,
+    0x95, 0xbd, 0xf0, 0x49, 0xbd, 0x19, 0x2c, 0x86, 0xf5, 0xc4, 0x4b, 0xf7, 0x65, 0x5f, 0x35, 0xa4,
+    0x05, 0x82, 0x11, 0x2a, 0x5e, 0xcd, 0x40, 0x07, 0x9c, 0x44, 0xa8, 0x3a, 0xc1, 0x96, 0x7b, 0x42,
+    0x01, 0x97, 0x14, 0xb8, 0xea, 0x20, 0x07, 0x46, 0x1a, 0xc1, 0x5b, 0xa8, 0x52, 0x03, 0xa4, 0x4a,
+    0xda, 0xf7, 0xc5, 0x14, 0xf6, 0xab, 0xb9, 0xf9, 0xb6, 0x69, 0x20, 0xad, 0x50, 0x25, 0xcf, 0x2d,
+    0x9b, 0x68, 0x45, 0x31, 0x28, 0x70, 0xcb, 0x31, 0x3d, 0xd8, 0xa3, 0x72, 0x0b, 0xdd, 0xb4, 0x80,
+    0x3b, 0x8f, 0xbf, 0x8c, 0x20, 0x45, 0xb1, 0xf6, 0x10, 0xd9, 0xd8, 0x5f, 0x1a, 0x91, 0xab, 0xf7,
+    0xc4, 0xbb, 0x4a, 0xd5, 0x9d, 0x46, 0xd5, 0x26, 0xf7, 0xa7, 0x5c, 0x14, 0xab, 0x79, 0xd6, 0x10,
+    0xf8, 0x52, 0xab, 0x72, 0x05, 0xdc, 0x1d, 0xab, 0x02, 0x5b, 0xed, 0xa4, 0xcb, 0xca, 0xcc, 0x21,
+    0xcf, 0xd9, 0x6f, 0x01, 0x2f, 0x2a, 0xa8, 0x55, 0x11, 0xdd, 0xc2, 0x1e, 0x18, 0xc5, 0x7c, 0x06,
+    0xb6, 0x67, 0x7f, 0x6e, 0xce, 0x02, 0x58, 0x57, 0xde, 0x0c, 0xaa, 0x4e, 0xe8, 0x56, 0x36, 0x14,
+    0xeb, 0x01, 0xac, 0x3e, 0xa9, 0xbc, 0xc1, 0x2d, 0x31, 0x74, 0x83, 0x47, 0xa5, 0xee, 0x4d, 0x60,
+    0xcd, 0x1a, 0xc6, 0xd9, 0x8a, 0xdc, 0x24, 0xb0, 0xf8, 0x08, 0xa6, 0x7e, 0x4b, 0x9d, 0x7f, 0x9b,
+    0x37, 0x61, 0x5c, 0xe2, 0x09, 0x3f, 0x84, 0x4b, 0x54, 0x65, 0x63, 0x95, 0x66, 0xd3, 0xa8, 0x8a,
+    0x88, 0xd6, 0x9d, 0xb1, 0x8c, 0xb3, 0x4d, 0xbf, 0xc3, 0x01, 0x56, 0xbf, 0x55, 0x81, 0xbc, 0x49,
+    0x0d, 0x10, 0x79, 0x10, 0x6b, 0x21, 0x38, 0x23, 0x3b, 0x86, 0x4c, 0xad, 0x7b, 0x2b, 0xd9, 0xaa,
+    0x5d, 0x8a, 0x73, 0xf0, 0x9e, 0x81, 0x84, 0xd5, 0xa7, 0x00, 0x8b, 0x62, 0x86, 0x1b, 0x23, 0x45,
+    0x5a, 0x5c, 0x17, 0xd4, 0xaf, 0xda, 0x0c, 0xc5, 0x72, 0x63, 0x54, 0xef, 0x9d, 0xf2, 0xd9, 0x81,
+    0x62, 0xa5, 0x34, 0xae, 0xe6, 0x4e, 0x93, 0x44, 0xf2, 0xd6, 0x01, 0x5b, 0x38, 0x5e, 0xc5, 0xd0,
+    0x5d, 0xb0, 0x44, 0xab, 0xc7, 0xab, 0x75, 0x6c, 0x71, 0x97, 0xdc, 0xcc, 0xe3, 0x52, 0xf4, 0x12,
+    0x61, 0x4d, 0x84, 0xfe, 0x79, 0x85, 0x03, 0x2c, 0x8d, 0xf1, 0x97, 0xe5, 0xf9, 0xb1, 0xdd, 0x55,
+    0x39, 0x7b, 0x39, 0x0b, 0x11, 0xb9, 0x9a, 0x90, 0x02, 0x72, 0x85, 0xd3, 0x91, 0xe7, 0xad, 0xbf,
+    0xdb, 0xb5, 0x38, 0x3e, 0x89, 0x84, 0xcf, 0x60, 0xb0, 0x4e, 0x12, 0x06, 0x2c, 0x1d, 0xc1, 0x06,
+    0xe8, 0x32, 0x2c, 0x5e, 0x3b, 0xbc, 0x6a, 0x27, 0x66, 0xad, 0x4b, 0x70, 0xa8, 0x63, 0x76, 0x03,
+    0xad, 0xdf, 0x5d, 0xcb, 0x1b, 0xbb, 0x85, 0xaa, 0x25, 0x9e, 0x4e, 0x08, 0x15, 0x08, 0x84, 0x82,
+    0x99, 0x20, 0x98, 0x0f, 0x2e, 0xb9, 0x59, 0xd6, 0x64, 0x70, 0xee, 0xa5, 0xe3, 0x3e, 0x70, 0xd6,
+    0x5a, 0x4d, 0xb3, 0x13, 0x16, 0x38, 0xb0, 0x04, 0xc1, 0x5a, 0x49, 0xf7, 0x34, 0xf6, 0x6c, 0x9a,
+    0x9a, 0x0c, 0xb0, 0x58, 0x6f, 0x66, 0x4d, 0x4d, 0xf9, 0x36, 0xfd, 0x38, 0x47, 0xc9, 0x2d, 0x3c,
+    0xb9, 0x1e, 0xd5, 0x52, 0x91, 0x05, 0xec, 0xb3, 0xbb, 0x8a, 0xe5, 0x1a, 0xc1, 0xec, 0xe2, 0xb5,
+    0x3d, 0x34, 0xf5, 0x20, 0x57, 0xb7, 0x00, 0x6d, 0xc0, 0x08, 0xb2, 0xd7, 0x4f, 0xd1, 0x72, 0x4b,
+    0x79, 0xec, 0x86, 0x52, 0x45, 0xfb, 0x9d, 0x09, 0x2f, 0x8b, 0xad, 0x1b, 0x09, 0x7b, 0x33, 0x3c,
+    0xd1, 0x62, 0x47, 0xd3, 0x0c, 0x2b, 0x0d, 0x65, 0x3b, 0x51, 0xfd, 0x84, 0x8f, 0x65, 0xe5, 0x60,
+    0x81, 0x26, 0x84, 0x4c, 0xc4, 0x1b, 0xa5, 0x9e, 0x2a, 0xd7, 0x51, 0x88, 0xcf, 0x04, 0x39, 0x46,
+    0x55, 0xd2, 0x5a, 0xe8, 0xf4, 0xa3, 0x59, 0x84, 0x74, 0x59, 0x78, 0x59, 0x07, 0x68, 0x6b, 0xd0,
+    0xde, 0x20, 0x4c, 0x41, 0x9e, 0x22, 0xed, 0x27, 0xb3, 0x96, 0x0f, 0x03, 0x72, 0xad, 0xee, 0x6e,
+    0x0b, 0xb8, 0xdf, 0x45, 0xf2, 0x64, 0x26, 0xb6, 0x0e, 0x1f, 0xab, 0x8e, 0x1d, 0x00, 0x9a, 0xbd,
+    0xab, 0xfd, 0x1c, 0x49, 0x56, 0x89, 0x7a, 0xb9, 0x3a, 0xb1, 0x8b, 0x31, 0xed, 0xfb, 0x65, 0xaa,
+    0x09, 0x61, 0xc9, 0x4b, 0x92, 0xee, 0x4f, 0x78, 0xf4, 0xd3, 0x1f, 0x57, 0xcf, 0x18, 0x4a, 0x14,
+    0x88, 0xfb, 0x73, 0xcc, 0xa9, 0xc2, 0x7b, 0x6c, 0x36, 0x63, 0x32, 0xb8, 0xad, 0x24, 0xc3, 0xa8,
+    0xeb, 0x83, 0x77, 0x20, 0xc8, 0xae, 0x56, 0x17, 0xdb, 0xae, 0x97, 0xdc, 0xf7, 0x4d, 0x3d, 0x5e,
+    0x79, 0x25, 0x94, 0xc7, 0x31, 0xe6, 0x92, 0x5d, 0xf0, 0x64, 0xef, 0xbc, 0xae, 0xa9, 0x6b, 0x61,
+    0xe9, 0x92, 0xd9, 0x0b, 0x64, 0x2b, 0xc1, 0xfd, 0x1d, 0x53, 0x65, 0x25, 0xd9, 0x71, 0x98, 0x6f,
+    0x60, 0x8b, 0x3d, 0xa4, 0x68, 0x65, 0x12, 0x93, 0xc2, 0xc5, 0xd6, 0x37, 0x6f, 0xb1, 0x79, 0x5b,
+    0xcf, 0xb8, 0xda, 0x8c, 0x88, 0xa8, 0x6a, 0x07, 0x65, 0x49, 0x44, 0xba, 0x98, 0xc2, 0xe3, 0x95,
+    0x6e, 0x9b, 0x2d, 0x9f, 0x30, 0x82, 0x72, 0x04, 0xf7, 0xb1, 0x8d, 0xef, 0xd1, 0xd1, 0xbe, 0x74,
+    0x84, 0x81, 0xf2, 0x3d, 0x35, 0xcc, 0x16, 0x09, 0xce, 0x08, 0xd6, 0xe4, 0x5d, 0x92, 0x28, 0xf2,
+    0x56, 0x90, 0xb0, 0x47, 0x85, 0x37, 0xd8, 0x4c, 0x21, 0x2b, 0xd7, 0x67, 0xdf, 0x0c, 0x5c, 0x80,
+    0x50, 0x6d, 0x90, 0xaa, 0x0d, 0x3b, 0x58, 0x17, 0x53, 0x28, 0x87, 0x23, 0x79, 0x0b, 0x14, 0x41,
+    0xe9, 0xc2, 0x31, 0x05, 0x50, 0x56, 0x55, 0x76, 0x1d, 0x2f, 0xdd, 0xc8, 0x96, 0x0e, 0x2f, 0x6b,
+    0x33, 0x42, 0xf2, 0x12, 0x9e, 0x22, 0xcb, 0x2c, 0xc1, 0xb8, 0x03, 0x2f, 0xba, 0xe7, 0x04, 0x7b,
+    0xd7, 0x2c, 0x59, 0x40, 0x2c, 0x57, 0x41, 0xb0, 0xb6, 0xd8, 0x9a, 0xa0, 0x13, 0x5f, 0x98, 0x1e,
+    0x95, 0xde, 0x14, 0x1e, 0xa2, 0x55, 0x47, 0x77, 0x9e, 0xc6, 0xdd, 0xcc, 0x6e, 0x70, 0x6f, 0x49,
+    0xe7, 0x01, 0x58, 0xb2, 0x39, 0xf4, 0xa1, 0x5b, 0xd9, 0xeb, 0xd2, 0x5e, 0xc7, 0xbd, 0x15, 0x11,
+    0xf5, 0xa2, 0xf0, 0x1e, 0x21, 0x2c, 0x57, 0x71, 0xdb, 0x67, 0xcd, 0xfe, 0x18, 0x96, 0x9a, 0x4d,
+    0x76, 0x29, 0x6c, 0xd7, 0x6d, 0x07, 0x84, 0x6d, 0x2b, 0x42, 0x25, 0x8b, 0x5f, 0xcc, 0x35, 0x2f,
+    0xb6, 0x6e, 0x70, 0x58, 0x33, 0x88, 0x27, 0x62, 0xc7, 0xbc, 0x1e, 0x98, 0x51, 0xc1, 0x9a, 0xa8,
+    0x2a, 0x23, 0x55, 0x69, 0xf4, 0xae, 0xac, 0x1d, 0xc3, 0x35, 0x9c, 0x9d, 0xd1, 0x4e, 0xad, 0xc3,
+    0xb0, 0x17, 0xed, 0xa4, 0x1b, 0x1c, 0x83, 0x1c, 0xdb, 0x14, 0xbf, 0x05, 0x1c, 0x2c, 0x80, 0xd7,
+    0x16, 0xd8, 0xe8, 0x9c, 0x57, 0x14, 0x8b, 0x2e, 0x3e, 0x96, 0x35, 0x8b, 0x49, 0x2b, 0x39, 0x30,
+    0xbc, 0xee, 0x46, 0x80, 0x11, 0x3c, 0xf4, 0x69, 0xef, 0xcc, 0x62, 0x11, 0xe5, 0xb5, 0x4b, 0x57,
+    0xa9, 0xa1, 0xac, 0x6f, 0xcd, 0x8b, 0xb0, 0x15, 0x07, 0xeb, 0x34, 0x55, 0x58, 0xab, 0x56, 0x8d,
+    0x60, 0xb6, 0x13, 0xa7, 0xee, 0x02, 0xef, 0x6a, 0xf2, 0xc2, 0x66, 0x57, 0x70, 0x35, 0x5b, 0x74,
+    0x6f, 0xc2, 0x8b, 0xe0, 0xce, 0x20, 0xa6, 0x53, 0x13, 0xec, 0xb8, 0x4f, 0x2a, 0xf1, 0xda, 0xc5,
+    0x79, 0xe9, 0x08, 0x93, 0x6c, 0xd5, 0x11, 0xaf, 0xc8, 0xce, 0xf4, 0x78, 0xbe, 0xc6, 0x89, 0x3c,
+    0xb3, 0x20, 0x58, 0x91, 0xb0, 0x02, 0xee, 0xb9, 0xb5, 0xc5, 0x6a, 0xc5, 0xdc, 0x05, 0xf0, 0xda,
+    0x62, 0x49, 0xa1, 0x80, 0xaa, 0x24, 0xc3, 0x02, 0x1b, 0x71, 0x33, 0x96, 0x5f, 0x00, 0x5b, 0x6c,
+    0x47, 0x68, 0x82, 0x11, 0xbf, 0x20, 0x61, 0x07, 0x52, 0xd9, 0x68, 0x1d, 0x53, 0xbd, 0xd2, 0x89,
+    0xd5, 0xd8, 0x0c, 0x42, 0x8b, 0x36, 0xd1, 0x5a, 0x0c, 0x0d, 0x6a, 0x15, 0x69, 0x41, 0x3b, 0x30,
+    0x1a, 0x39, 0x10, 0x5f, 0x00, 0xe1, 0xab, 0xcd, 0xd3, 0x2d, 0xb7, 0x74, 0x8c, 0xb2, 0xf1, 0x06,
+    0x52, 0x35, 0xbf, 0x2e, 0x60, 0x49, 0x5f, 0xa1, 0x41, 0xb6, 0x82, 0xe1, 0x3e, 0x5e, 0x9c, 0xf2,
+    0x64, 0xcd, 0x14, 0xf6, 0x6c, 0x45, 0x4a, 0x27, 0x82, 0x2a, 0x4b, 0x6d, 0x71, 0xaa, 0x78, 0xc2,
+    0x14, 0xc6, 0x27, 0x80, 0x6e, 0x14, 0x34, 0xd8, 0x76, 0x6b, 0x0b, 0x6f, 0x6e, 0xb6, 0x2a, 0x32,
+    0x6c, 0x76, 0x15, 0xe4, 0x60, 0x6f, 0x47, 0x65, 0x4f, 0xc0, 0x46, 0xa9, 0x5f, 0xf4, 0x88, 0xb3,
+    0x05, 0x3c, 0x77, 0x32, 0x90, 0x0a, 0xf6, 0x1b, 0xee, 0xf1, 0xca, 0x5d, 0x10, 0x6b, 0x87, 0x35,
+    0x14, 0x4b, 0xac, 0x82, 0x57, 0x44, 0xb7, 0x08, 0x96, 0x23, 0x5c, 0x5d, 0xa8, 0x01, 0x5a, 0x15,
+    0xec, 0xe4, 0x86, 0xed, 0x20, 0x2e, 0x9d, 0x6d, 0x99, 0x39, 0xac, 0x52, 0xc1, 0x08, 0x7b, 0x02,
+    0xe5, 0x0e, 0x2f, 0x8a, 0x75, 0x82, 0x2d, 0x69, 0x01, 0x29, 0x26, 0x5a, 0x6e, 0xfd, 0x93, 0x7d,
+    0xec, 0xab, 0x9b, 0xc7, 0x18, 0xe9, 0x69, 0xd1, 0xba, 0xc5, 0xd9, 0x5a, 0x02, 0x2b, 0xe8, 0x5a,
+    0x3d, 0xae, 0x5c, 0xdd, 0x58, 0x8f, 0x2f, 0x1b, 0x65, 0x6a, 0x93, 0x3d, 0x01, 0x4c, 0xb8, 0x88,
+    0xe6, 0x05, 0xac, 0x6a, 0x58, 0xca, 0x88, 0x4d, 0x2c, 0xe1, 0x5c, 0x86, 0x74, 0x56, 0xae, 0x7a,
+    0xaa, 0x76, 0x4f, 0xb1, 0xca, 0x59, 0xb0, 0x82, 0x39, 0xb1, 0x27, 0x62, 0x78, 0x71, 0xb0, 0xb2,
+    0xa7, 0x58, 0x5b, 0x6c, 0x56, 0xb8, 0x54, 0x88, 0x36, 0x87, 0xfd, 0x74, 0x97, 0xaa, 0x83, 0xad,
+    0xba, 0x51, 0xaa, 0x23, 0x37, 0x1c, 0x60, 0x8b, 0xbd, 0xd4, 0x75, 0x90, 0x74, 0x85, 0xa5, 0x4b,
+    0x95, 0xab, 0x2c, 0xd6, 0x76, 0x56, 0xad, 0xe1, 0xb9, 0xe8, 0x83, 0x25, 0x5a, 0x1c, 0xde, 0xd0,
+    0x76, 0x22, 0x86, 0x77, 0xc2, 0x0e, 0x06, 0xf1, 0xca, 0x31, 0x95, 0x0a, 0x76, 0x09, 0x25, 0xa3,
+    0x47, 0xe9, 0xc3, 0x08, 0x6f, 0xc4, 0xf5, 0xea, 0x07, 0x80, 0x59, 0x4f, 0xd3, 0x72, 0x1f, 0xac,
+    0x70, 0xb3, 0xb5, 0xfd, 0x6d, 0xca, 0x5f, 0x00, 0x48, 0xed, 0x86, 0x8f, 0x95, 0x63, 0x6e, 0x56,
+    0x39, 0x5b, 0x74, 0x0a, 0x80, 0xd5, 0x16, 0xd3, 0x16, 0x96, 0xa2, 0x56, 0x41, 0xb9, 0x72, 0xd9,
+    0x02, 0x78, 0x65, 0xcf, 0x97, 0xda, 0xbc, 0xce, 0x1d, 0x6a, 0xf9, 0x7b, 0x49, 0x55, 0xbb, 0x2a,
+    0x16, 0xd7, 0x6e, 0x07, 0x5f, 0x0a, 0xac, 0xad, 0x02, 0x97, 0x4b, 0x6e, 0x6b, 0x9e, 0xc6, 0x74,
+    0xd7, 0xd8, 0x2a, 0x63, 0x94, 0x21, 0x8f, 0x3c, 0x65, 0x11, 0x14, 0x75, 0x7d, 0xac, 0x60, 0xe8,
+    0xa1, 0x3e, 0xc6, 0x1e, 0xa4, 0x88, 0x83, 0x95, 0x56, 0x42, 0x0c, 0x11, 0x1f, 0x6b, 0xf3, 0x9a,
+    0x72, 0xb9, 0x30, 0x6d, 0xb6, 0xf7, 0x16, 0x69, 0x8a, 0x46, 0x36, 0x55, 0x75, 0x52, 0xac, 0xec,
+    0xb1, 0x35, 0xad, 0xf9, 0x34, 0xb8, 0x09, 0xc7, 0x9a, 0x0f, 0xaa, 0x90, 0x15, 0x11, 0x5c, 0xc8,
+    0x42, 0xa5, 0x76, 0x18, 0x6e, 0x70, 0xc1, 0xc2, 0x95, 0xa8, 0x56, 0x03, 0x5a, 0x27, 0x42, 0xed,
+    0x91, 0x40, 0x71, 0x5c, 0xb1, 0x5c, 0x83, 0xe8, 0xbe, 0xab, 0x2a, 0x85, 0x3b, 0xa2, 0x2d, 0x50,
+    0x45, 0x54, 0x2e, 0x3e, 0x16, 0x19, 0x6c, 0xad, 0x4a, 0xd7, 0x34, 0xb8, 0x55, 0x23, 0x2c, 0x8d,
+    0x0b, 0xcc, 0xd6, 0x7b, 0x0e, 0x50, 0xf5, 0x14, 0x60, 0x61, 0x37, 0x2b, 0x18, 0xcf, 0x7b, 0x03,
+    0x60, 0x65, 0xd0, 0xd2, 0x4d, 0xc3, 0x08, 0xf4, 0xdb, 0x4d, 0x2b, 0xdd, 0x1b, 0xc9, 0xc8, 0x28,
+    0x1e, 0xa8, 0xba, 0x98, 0xc2, 0x32, 0x66, 0xf6, 0xd5, 0x71, 0x8b, 0x48, 0xf3, 0xd8, 0x6a, 0xf6,
+    0xbe, 0xd3, 0x02, 0xe7, 0x86, 0xbb, 0x48, 0x92, 0x99, 0x16, 0x70, 0x5c, 0xaa, 0x40, 0x3b, 0x90,
+    0xa7, 0x70, 0xb3, 0x1e, 0x11, 0x2c, 0xd7, 0xc1, 0x5a, 0xea, 0x74, 0x0a, 0xf0, 0xca, 0x61, 0xc3,
+    0x97, 0x63, 0xed, 0xf5, 0x54, 0xaa, 0xfa, 0x21, 0x7d, 0x18, 0xf9, 0x09, 0x2c, 0xea, 0x1a, 0x3c,
+    0xd7, 0x00, 0x5b, 0xdc, 0xa5, 0xa6, 0xa8, 0x43, 0x5c, 0xe0, 0x64, 0x70, 0xd7, 0x72, 0xb0, 0xca,
+    0x18, 0x11, 0x0d, 0x52, 0x55, 0x16, 0xdb, 0x1d, 0x44, 0x3a, 0xb5, 0xc4, 0x8b, 0x06, 0xd0, 0x63,
+    0xac, 0x0c, 0x5a, 0x0e, 0x16, 0x66, 0x0b, 0x75, 0xfc, 0x86, 0xd1, 0x4e, 0xb5, 0x5f, 0x95, 0x34,
+    0x2f, 0x74, 0x82, 0x2a, 0xa2, 0xf2, 0xff, 0x01, 0x7d, 0x35, 0x3e, 0xa0, 0x92, 0x83, 0xc8, 0x2f,
+    0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+};
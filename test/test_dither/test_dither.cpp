@@ -0,0 +1,111 @@
+// Copyright (c) 2023 @dheijl (danny.heijl@telenet.be)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#include <chrono>
+#include <stdio.h>
+#include <unity.h>
+
+#include "imgdither.h"
+
+#include "cover_images.h"
+
+///
+/// decode, downscale and dither the test covers into the 300x300 cover box and
+/// report the time and working memory, run natively with "pio test -e native"
+///
+
+static const int BOX = 300;
+static const int ROUNDS = 20;
+
+void setUp() { }
+void tearDown() { }
+
+// mean ink level (0 white ... 15 black) of a square around (cx, cy)
+static double mean_level(const Gray4Framebuffer& fb, int cx, int cy, int r)
+{
+    int sum = 0;
+    int n = 0;
+    for (int y = cy - r; y <= cy + r; ++y) {
+        for (int x = cx - r; x <= cx + r; ++x) {
+            sum += fb.get(x, y);
+            ++n;
+        }
+    }
+    return (double)sum / n;
+}
+
+static void bench(const char* name, const uint8_t* data, size_t len, int src_size)
+{
+    Gray4Framebuffer fb(BOX, BOX);
+    ImageDither dither(&fb);
+    IMAGE_STATS stats;
+    TEST_ASSERT_TRUE(dither.draw(data, len, BOX, BOX, stats));
+    TEST_ASSERT_EQUAL(src_size, stats.src_width);
+    TEST_ASSERT_EQUAL(src_size, stats.src_height);
+    TEST_ASSERT_LESS_OR_EQUAL(BOX, stats.width);
+    TEST_ASSERT_LESS_OR_EQUAL(BOX, stats.height);
+    TEST_ASSERT_EQUAL(stats.width, stats.height);
+    // the dark centre and the light disc around it survive the dither
+    int c = stats.width / 2;
+    TEST_ASSERT_GREATER_THAN(11.0, mean_level(fb, c, c, stats.width / 50));
+    TEST_ASSERT_LESS_OR_EQUAL(7.0, mean_level(fb, c + stats.width / 10, c, stats.width / 50));
+
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < ROUNDS; ++round) {
+        dither.draw(data, len, BOX, BOX, stats);
+    }
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    char msg[120];
+    snprintf(msg, sizeof(msg), "%s %dx%d -> %dx%d (scale 1/%d): %.2f ms, %u bytes working memory", name, stats.src_width,
+        stats.src_height, stats.width, stats.height, stats.scale, us / (ROUNDS * 1000.0), (unsigned)stats.peak_bytes);
+    TEST_MESSAGE(msg);
+}
+
+void test_jpeg()
+{
+    bench("jpeg", cover_jpg, sizeof(cover_jpg), 500);
+}
+
+void test_png()
+{
+    bench("png", cover_png, sizeof(cover_png), 200);
+}
+
+void test_not_an_image()
+{
+    static const uint8_t garbage[] = "GIF89a not supported";
+    Gray4Framebuffer fb(BOX, BOX);
+    ImageDither dither(&fb);
+    IMAGE_STATS stats;
+    TEST_ASSERT_FALSE(ImageDither::is_jpeg(garbage, sizeof(garbage)));
+    TEST_ASSERT_FALSE(ImageDither::is_png(garbage, sizeof(garbage)));
+    TEST_ASSERT_FALSE(dither.draw(garbage, sizeof(garbage), BOX, BOX, stats));
+    // a cut off download
+    TEST_ASSERT_FALSE(dither.draw(cover_png, 100, BOX, BOX, stats));
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_jpeg);
+    RUN_TEST(test_png);
+    RUN_TEST(test_not_an_image);
+    return UNITY_END();
+}
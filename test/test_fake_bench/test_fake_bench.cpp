@@ -0,0 +1,166 @@
+// Copyright (c) 2023 @dheijl (danny.heijl@telenet.be)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#include <stdio.h>
+#include <unity.h>
+
+#include "mpdconnection.h"
+#include "mpdfake.h"
+#include "mpdsession.h"
+
+///
+/// wall time, bytes on the wire and round trips of the MPD exchanges of a wake,
+/// against FakeMpdServer at different RTTs, run natively with "pio test -e native".
+/// The operations run the MpdSession sequences of show_mpd_status(),
+/// toggle_mpd_status() and play_favourite(); what MPD_Client adds around them
+/// (starting wifi, the display, the cover lookup on the SD card) needs the device.
+///
+
+static const int ROUNDS = 5;
+
+typedef bool (*MpdOperation)(MpdSession& session, MpdStatusLines& lines);
+
+static bool show_status(MpdSession& session, MpdStatusLines& lines)
+{
+    if (!session.open("fake", 6600)) {
+        return false;
+    }
+    // returns whether the player plays, a failure leaves one line after the connect line
+    session.status(lines);
+    return lines.size() > 2;
+}
+
+static bool toggle_status(MpdSession& session, MpdStatusLines& lines)
+{
+    return session.open("fake", 6600) && session.toggle(lines);
+}
+
+static bool play_favourite(MpdSession& session, MpdStatusLines& lines)
+{
+    return session.open("fake", 6600) && session.play_url("http://radio.example/stream.mp3", lines);
+}
+
+static const struct {
+    const char* name;
+    MpdOperation op;
+} operations[] = {
+    // play first, so that the status has a current song
+    { "play", play_favourite },
+    { "status", show_status },
+    { "toggle", toggle_status },
+};
+
+void setUp() { }
+void tearDown() { }
+
+///
+/// runs every operation ROUNDS times, reports the averages and returns the
+/// round trips of the last run of each
+///
+static void bench(const char* name, const FAKE_MPD_CFG& cfg, bool persistent, uint32_t round_trips[])
+{
+    FakeMpdServer fake(cfg);
+    MpdConnection con(&fake);
+    MpdSession session(con);
+    session.set_persistent(persistent);
+    int i = 0;
+    for (auto& operation : operations) {
+        uint32_t elapsed_us = 0;
+        uint32_t bytes = 0;
+        for (int round = 0; round < ROUNDS; ++round) {
+            MpdStatusLines lines;
+            session.begin_op();
+            uint32_t start = mpd_micros();
+            TEST_ASSERT_TRUE(operation.op(session, lines));
+            elapsed_us += mpd_micros() - start;
+            auto& stats = session.end_op();
+            bytes += stats.bytes_sent + stats.bytes_received;
+            round_trips[i] = stats.round_trips;
+        }
+        char msg[120];
+        snprintf(msg, sizeof(msg), "%s %s: %.2f ms, %u bytes, %u round trips", name, operation.name,
+            elapsed_us / (ROUNDS * 1000.0), bytes / ROUNDS, round_trips[i]);
+        TEST_MESSAGE(msg);
+        ++i;
+    }
+}
+
+void test_lan()
+{
+    FAKE_MPD_CFG cfg = { 2, 1460, 40, NULL, 10, 0 };
+    uint32_t round_trips[3];
+    bench("lan", cfg, false, round_trips);
+    // greeting plus one command list, the toggle needs the status first
+    TEST_ASSERT_EQUAL(2, round_trips[0]);
+    TEST_ASSERT_EQUAL(2, round_trips[1]);
+    TEST_ASSERT_EQUAL(3, round_trips[2]);
+}
+
+void test_persistent()
+{
+    // on USB power: the connection stays open and idles between operations
+    FAKE_MPD_CFG cfg = { 2, 1460, 40, NULL, 10, 0 };
+    uint32_t round_trips[3];
+    bench("usb", cfg, true, round_trips);
+    // noidle instead of the greeting
+    TEST_ASSERT_EQUAL(2, round_trips[1]);
+}
+
+void test_slow_wifi()
+{
+    // a weak signal: long round trips and small segments
+    FAKE_MPD_CFG cfg = { 30, 256, 40, NULL, 10, 0 };
+    uint32_t round_trips[3];
+    bench("slow", cfg, false, round_trips);
+    TEST_ASSERT_EQUAL(2, round_trips[1]);
+}
+
+void test_long_titles()
+{
+    FAKE_MPD_CFG cfg = { 2, 1460, 1000, NULL, 10, 0 };
+    uint32_t round_trips[3];
+    bench("titles", cfg, false, round_trips);
+    TEST_ASSERT_EQUAL(2, round_trips[1]);
+}
+
+void test_ack()
+{
+    FAKE_MPD_CFG cfg = { 0, 1460, 40, "add", 10, 0 };
+    FakeMpdServer fake(cfg);
+    MpdConnection con(&fake);
+    MpdSession session(con);
+    session.set_persistent(true);
+    MpdStatusLines lines;
+    TEST_ASSERT_FALSE(play_favourite(session, lines));
+    // the kept connection is still usable after an ACK
+    lines.clear();
+    TEST_ASSERT_TRUE(show_status(session, lines));
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_lan);
+    RUN_TEST(test_persistent);
+    RUN_TEST(test_slow_wifi);
+    RUN_TEST(test_long_titles);
+    RUN_TEST(test_ack);
+    return UNITY_END();
+}
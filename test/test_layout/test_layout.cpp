@@ -0,0 +1,177 @@
+// Copyright (c) 2023 @dheijl (danny.heijl@telenet.be)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#include <chrono>
+#include <stdio.h>
+#include <unity.h>
+
+#include "textlayout.h"
+
+///
+/// layout of UTF-8 titles for the built-in font, run natively with "pio test -e native"
+///
+
+// the built-in font at text size 3 is 18 pixels wide
+class FixedMeasure : public GlyphMeasure {
+public:
+    int glyph_width(uint8_t) override { return 18; }
+};
+
+static const int WIDTH = 18 * 10;
+static const int LINE_HEIGHT = 30;
+
+// titles as MPD sends them, mixed scripts and punctuation
+static const char* const corpus[] = {
+    "Stra\xc3\x9f" "e der Tr\xc3\xa4ume",
+    "Caf\xc3\xa9 del Mar \xe2\x80\x93 Volumen Dos",
+    "Sigur R\xc3\xb3s \xe2\x80\x94 Hopp\xc3\xadpolla",
+    "\xe2\x80\x9cQuoted\xe2\x80\x9d and \xe2\x80\x98single\xe2\x80\x99",
+    "Dvo\xc5\x99\xc3\xa1k: Symphony No. 9 \xe2\x80\x9c" "From the New World\xe2\x80\x9d",
+    "\xce\x9c\xce\xb9\xce\xba\xce\xb7\xcf\x82 \xce\x98\xce\xb5\xce\xbf\xce\xb4\xcf\x89\xcf\x81\xce\xac\xce\xba\xce\xb7\xcf\x82",
+    "\xe5\x9d\x82\xe6\x9c\xac\xe9\xbe\x8d\xe4\xb8\x80",
+    "Supercalifragilisticexpialidocious",
+    "a b c d e f g h i j k l m n o p q r s t u v w x y z",
+    "10 \xc2\xb5s at 20\xc2\xb0" "C \xc2\xbd way\xe2\x80\xa6",
+    "",
+    "   ",
+    "tab\there\x01\x7f",
+    "broken \xc3 \xe2\x82 utf8 \xff",
+};
+
+void setUp() { }
+void tearDown() { }
+
+void test_glyphs()
+{
+    // code page 437 glyphs: these must reach the canvas undecoded
+    TEST_ASSERT_EQUAL_STRING("Stra\xe1" "e", TextLayout::to_glyphs("Stra\xc3\x9f" "e").c_str());
+    TEST_ASSERT_EQUAL_STRING("10 \xe6s", TextLayout::to_glyphs("10 \xc2\xb5s").c_str());
+    TEST_ASSERT_EQUAL_STRING("Caf\x82", TextLayout::to_glyphs("Caf\xc3\xa9").c_str());
+    TEST_ASSERT_EQUAL_STRING("Dvor\xa0k", TextLayout::to_glyphs("Dvo\xc5\x99\xc3\xa1k").c_str());
+    TEST_ASSERT_EQUAL_STRING("a - b...", TextLayout::to_glyphs("a \xe2\x80\x93 b\xe2\x80\xa6").c_str());
+    TEST_ASSERT_EQUAL_STRING("\"q\" 'q'", TextLayout::to_glyphs("\xe2\x80\x9cq\xe2\x80\x9d \xe2\x80\x98q\xe2\x80\x99").c_str());
+    TEST_ASSERT_EQUAL_STRING("??", TextLayout::to_glyphs("\xe5\x9d\x82\xe6\x9c\xac").c_str());
+    // control characters are dropped, malformed sequences shown as '?'
+    TEST_ASSERT_EQUAL_STRING("a  b", TextLayout::to_glyphs("a\x01 \tb").c_str());
+    TEST_ASSERT_EQUAL_STRING("?x", TextLayout::to_glyphs("\xc3x").c_str());
+}
+
+void test_tail()
+{
+    const char* s = "ab\xc3\xa9" "cd";
+    TEST_ASSERT_EQUAL_STRING("\xc3\xa9" "cd", TextLayout::utf8_tail(s, 3));
+    TEST_ASSERT_EQUAL_STRING(s, TextLayout::utf8_tail(s, 10));
+}
+
+void test_wrap()
+{
+    FixedMeasure measure;
+    TextLayout layout(&measure, LINE_HEIGHT);
+    TextRuns runs;
+    int y = layout.layout("aaaa bbbb cccc", 10, 0, WIDTH, 4, runs);
+    TEST_ASSERT_EQUAL(2, runs.size());
+    TEST_ASSERT_EQUAL_STRING("aaaa bbbb", runs[0].text.c_str());
+    TEST_ASSERT_EQUAL_STRING("cccc", runs[1].text.c_str());
+    TEST_ASSERT_EQUAL(10, runs[1].x);
+    TEST_ASSERT_EQUAL(LINE_HEIGHT, runs[1].y);
+    TEST_ASSERT_EQUAL(2 * LINE_HEIGHT, y);
+}
+
+void test_long_word()
+{
+    FixedMeasure measure;
+    TextLayout layout(&measure, LINE_HEIGHT);
+    TextRuns runs;
+    layout.layout("Supercalifragilistic", 0, 0, WIDTH, 4, runs);
+    TEST_ASSERT_EQUAL(2, runs.size());
+    TEST_ASSERT_EQUAL_STRING("Supercalif", runs[0].text.c_str());
+    TEST_ASSERT_EQUAL_STRING("ragilistic", runs[1].text.c_str());
+}
+
+void test_ellipsis()
+{
+    FixedMeasure measure;
+    TextLayout layout(&measure, LINE_HEIGHT);
+    TextRuns runs;
+    int y = layout.layout("one two three four five six", 0, 0, WIDTH, 2, runs);
+    TEST_ASSERT_EQUAL(2, runs.size());
+    TEST_ASSERT_EQUAL_STRING("one two", runs[0].text.c_str());
+    TEST_ASSERT_EQUAL_STRING("three f...", runs[1].text.c_str());
+    TEST_ASSERT_EQUAL(2 * LINE_HEIGHT, y);
+}
+
+void test_empty()
+{
+    FixedMeasure measure;
+    TextLayout layout(&measure, LINE_HEIGHT);
+    TextRuns runs;
+    // an empty line still takes its place
+    TEST_ASSERT_EQUAL(LINE_HEIGHT, layout.layout("", 0, 0, WIDTH, 2, runs));
+    TEST_ASSERT_EQUAL(1, runs.size());
+}
+
+///
+/// every title of the corpus fits its width and line budget, and the time it takes
+///
+void test_corpus()
+{
+    FixedMeasure measure;
+    TextLayout layout(&measure, LINE_HEIGHT);
+    const int rounds = 1000;
+    size_t lines = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; ++round) {
+        for (auto title : corpus) {
+            TextRuns runs;
+            int max_lines = 1 + (round % 3);
+            int y = layout.layout(title, 0, 0, WIDTH, max_lines, runs);
+            if (round == 0) {
+                TEST_ASSERT_LESS_OR_EQUAL(max_lines, runs.size());
+                TEST_ASSERT_EQUAL((int)runs.size() * LINE_HEIGHT, y);
+                for (auto& run : runs) {
+                    TEST_ASSERT_LESS_OR_EQUAL(WIDTH, layout.text_width(run.text));
+                    for (auto c : run.text) {
+                        // no control characters reach the font
+                        TEST_ASSERT_TRUE((uint8_t)c >= 0x20);
+                    }
+                }
+            }
+            lines += runs.size();
+        }
+    }
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    char msg[80];
+    snprintf(msg, sizeof(msg), "%d layouts, %u lines, %.2f us per layout", rounds * (int)(sizeof(corpus) / sizeof(corpus[0])),
+        (unsigned)lines, (double)us / (rounds * (sizeof(corpus) / sizeof(corpus[0]))));
+    TEST_MESSAGE(msg);
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_glyphs);
+    RUN_TEST(test_tail);
+    RUN_TEST(test_wrap);
+    RUN_TEST(test_long_word);
+    RUN_TEST(test_ellipsis);
+    RUN_TEST(test_empty);
+    RUN_TEST(test_corpus);
+    return UNITY_END();
+}
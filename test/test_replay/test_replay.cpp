@@ -0,0 +1,222 @@
+// Copyright (c) 2023 @dheijl (danny.heijl@telenet.be)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#include <new>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <unity.h>
+
+#include "mpdconnection.h"
+#include "mpdfake.h"
+#include "mpdrecord.h"
+#include "mpdsession.h"
+
+///
+/// record status sessions against the fake server and replay them through
+/// MpdConnection, run natively with "pio test -e native". A session file recorded
+/// on the device (DEBUGMPDRECORD) is replayed too if MPD_REPLAY_FILE names it.
+///
+
+static const int WAKES = 50;
+
+// every heap allocation of the test, for the replay report
+static size_t allocations = 0;
+
+void* operator new(size_t size)
+{
+    ++allocations;
+    void* p = malloc(size);
+    if (p == NULL) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void* p) noexcept
+{
+    free(p);
+}
+
+static size_t count_allocations()
+{
+    return allocations;
+}
+
+void setUp() { }
+void tearDown() { }
+
+///
+/// one status read per wake, as show_mpd_status() does, the shown lines of every wake appended
+///
+static void record_sessions(const char* path, MpdStatusLines& lines)
+{
+    FAKE_MPD_CFG cfg = { 1, 1460, 60, NULL, 10, 0 };
+    FakeMpdServer fake(cfg);
+    RecordingTransport recorder(&fake);
+    TEST_ASSERT_TRUE(recorder.open(path));
+    MpdConnection con(&recorder);
+    MpdSession session(con);
+    for (int wake = 0; wake < WAKES; ++wake) {
+        MpdStatusLines response;
+        if (session.open("fake", 6600)) {
+            session.status(response);
+        }
+        MpdSession::format(response, lines);
+    }
+    recorder.close();
+}
+
+static void print_report(const char* name, const MPD_REPLAY_REPORT& report)
+{
+    char msg[160];
+    double sessions = report.sessions > 0 ? report.sessions : 1;
+    snprintf(msg, sizeof(msg), "%s: %u sessions, %.1f us and %.1f allocations per session replayed, %u ms on the wire",
+        name, report.sessions, report.elapsed_us / sessions, report.allocations / sessions, report.recorded_ms);
+    TEST_MESSAGE(msg);
+}
+
+void test_replay_matches_live()
+{
+    char path[] = "/tmp/mpdrecXXXXXX";
+    int fd = mkstemp(path);
+    TEST_ASSERT_TRUE(fd >= 0);
+    close(fd);
+    remove(path);
+    MpdStatusLines live;
+    record_sessions(path, live);
+
+    FILE* in = fopen(path, "rb");
+    TEST_ASSERT_NOT_NULL(in);
+    MPD_REPLAY_REPORT report;
+    bool ok = replay_status_sessions(in, report, count_allocations);
+    fclose(in);
+    remove(path);
+    TEST_ASSERT_TRUE(ok);
+    TEST_ASSERT_EQUAL(WAKES, report.sessions);
+    TEST_ASSERT_EQUAL(0, report.mismatches);
+    TEST_ASSERT_TRUE(report.allocations > 0);
+    // the replayed client decodes exactly what it decoded live
+    TEST_ASSERT_EQUAL(live.size(), report.lines.size());
+    for (size_t i = 0; i < live.size(); ++i) {
+        TEST_ASSERT_EQUAL_STRING(live[i].c_str(), report.lines[i].c_str());
+    }
+    print_report("fake", report);
+}
+
+void test_truncated_recording()
+{
+    char path[] = "/tmp/mpdrecXXXXXX";
+    int fd = mkstemp(path);
+    TEST_ASSERT_TRUE(fd >= 0);
+    close(fd);
+    remove(path);
+    MpdStatusLines live;
+    record_sessions(path, live);
+    // a power off in the middle of the last record
+    FILE* f = fopen(path, "rb");
+    TEST_ASSERT_NOT_NULL(f);
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fclose(f);
+    TEST_ASSERT_EQUAL(0, truncate(path, size - 3));
+
+    FILE* in = fopen(path, "rb");
+    MPD_REPLAY_REPORT report;
+    bool ok = replay_status_sessions(in, report);
+    fclose(in);
+    remove(path);
+    TEST_ASSERT_TRUE(ok);
+    TEST_ASSERT_EQUAL(WAKES, report.sessions);
+}
+
+///
+/// a player that refuses the connection
+///
+class RefusingServer : public FakeMpdServer {
+public:
+    RefusingServer(const FAKE_MPD_CFG& cfg)
+        : FakeMpdServer(cfg)
+    {
+    }
+    bool connect(const char*, uint16_t) override
+    {
+        return false;
+    }
+};
+
+void test_failed_connect_stops_once()
+{
+    char path[] = "/tmp/mpdrecXXXXXX";
+    int fd = mkstemp(path);
+    TEST_ASSERT_TRUE(fd >= 0);
+    close(fd);
+    remove(path);
+    FAKE_MPD_CFG cfg = { 1, 1460, 60, NULL, 10, 0 };
+    RefusingServer refusing(cfg);
+    RecordingTransport recorder(&refusing);
+    TEST_ASSERT_TRUE(recorder.open(path));
+    MpdConnection con(&recorder);
+    TEST_ASSERT_FALSE(con.Connect("fake", 6600));
+    con.Disconnect();
+    recorder.close();
+
+    FILE* in = fopen(path, "rb");
+    TEST_ASSERT_NOT_NULL(in);
+    ReplayTransport replay;
+    bool ok = replay.load(in);
+    fclose(in);
+    remove(path);
+    TEST_ASSERT_TRUE(ok);
+    auto& records = replay.get_records();
+    TEST_ASSERT_EQUAL(2, records.size());
+    TEST_ASSERT_EQUAL(MpdRecConnect, records[0].type);
+    TEST_ASSERT_EQUAL(MpdRecStop, records[1].type);
+}
+
+void test_device_recording()
+{
+    const char* path = getenv("MPD_REPLAY_FILE");
+    if (path == NULL) {
+        TEST_MESSAGE("MPD_REPLAY_FILE not set, no device recording replayed");
+        return;
+    }
+    FILE* in = fopen(path, "rb");
+    TEST_ASSERT_NOT_NULL(in);
+    MPD_REPLAY_REPORT report;
+    bool ok = replay_status_sessions(in, report, count_allocations);
+    fclose(in);
+    TEST_ASSERT_TRUE(ok);
+    TEST_ASSERT_EQUAL(0, report.mismatches);
+    print_report(path, report);
+    for (auto& line : report.lines) {
+        TEST_MESSAGE(line.c_str());
+    }
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_replay_matches_live);
+    RUN_TEST(test_truncated_recording);
+    RUN_TEST(test_failed_connect_stops_once);
+    RUN_TEST(test_device_recording);
+    return UNITY_END();
+}